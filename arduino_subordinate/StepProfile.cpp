@@ -0,0 +1,24 @@
+#include "StepProfile.h"
+#include <stdint.h>
+#include <math.h>
+#include <Arduino.h>
+
+void StepProfile::init(float start_speed, float max_speed, float acceleration) {
+  if (max_speed < start_speed) {
+    max_speed = start_speed;
+  }
+  // v^2 = v0^2 + 2 a s
+  float steps = (max_speed * max_speed - start_speed * start_speed) / (2 * acceleration);
+  uint32_t max_ramp_steps = (uint32_t)STEP_RAMP_TABLE_SIZE << STEP_RAMP_SHIFT;
+  ramp_steps = steps < max_ramp_steps ? (uint32_t)ceil(steps) : max_ramp_steps;
+  cruise_half_period = STEP_TIMER_HZ / (2 * max_speed);
+  for (uint16_t i = 0; i < STEP_RAMP_TABLE_SIZE; i++) {
+    // Speed halfway through the steps of the entry
+    float s = ((float)i + 0.5f) * (1 << STEP_RAMP_SHIFT);
+    float speed = sqrt(start_speed * start_speed + 2 * acceleration * s);
+    if (speed > max_speed) {
+      speed = max_speed;
+    }
+    ramp[i] = STEP_TIMER_HZ / (2 * speed);
+  }
+}
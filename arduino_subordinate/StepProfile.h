@@ -0,0 +1,43 @@
+// StepProfile.h file
+// Trapezoidal speed profile of the gantry steppers: accelerate from the start speed, cruise, decelerate
+// The step timing of the ramp is computed once (init) into a table, so the step interrupt only looks it up
+// Times are in half periods: the pulse pin is high for one, low for the other (like stepper_square_wave)
+// Also compiled on a PC by host/motor_sim to time moves
+
+#ifndef STEP_PROFILE_H
+#define STEP_PROFILE_H
+#include <stdint.h>
+#include <Arduino.h>
+
+// Step timer ticks per second (Timer1 at 16 MHz with a prescaler of 8)
+#define STEP_TIMER_HZ 2000000UL
+// Each ramp table entry covers 1 << STEP_RAMP_SHIFT steps (a shift instead of a division in the interrupt)
+#define STEP_RAMP_SHIFT 6
+#define STEP_RAMP_TABLE_SIZE 128
+
+class StepProfile {
+  public:
+    // Timer ticks per half period at each point of the ramp (entry i is for steps i << STEP_RAMP_SHIFT and up)
+    uint16_t ramp[STEP_RAMP_TABLE_SIZE];
+    // Steps it takes to reach the cruise speed
+    uint32_t ramp_steps;
+    // Timer ticks per half period at the cruise speed
+    uint16_t cruise_half_period;
+
+    // Speeds in steps/s, acceleration in steps/s^2 (the ramp is cut short if it doesn't fit in the table)
+    // A start speed equal to the max speed gives a constant speed, like stepping without a profile
+    void init(float start_speed, float max_speed, float acceleration);
+
+    // Timer ticks per half period of step index (0 to count - 1) of a move of count steps
+    // Moves too short to reach the cruise speed turn around halfway (a triangle instead of a trapezoid)
+    uint16_t half_period(uint32_t index, uint32_t count) const {
+      uint32_t from_end = count - 1 - index;
+      uint32_t from_edge = index < from_end ? index : from_end;
+      if (from_edge >= ramp_steps) {
+        return cruise_half_period;
+      }
+      return ramp[from_edge >> STEP_RAMP_SHIFT];
+    }
+};
+
+#endif
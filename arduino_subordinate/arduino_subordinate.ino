@@ -1,5 +1,6 @@
 #include <Wire.h>
 #include <Servo.h>
+#include "StepProfile.h"
 
 #define SUBORDINATE_ADDR 8
 
@@ -28,6 +29,8 @@ const uint8_t LIMIT_PINS[4] = {4, 5, 2, 3}; // x-, x+, y-, y+
 const uint8_t DIR_PINS[2] = {9, 11};   // x, y
 const uint8_t PUL_PINS[2] = {10, 12};   // x, y
 const uint8_t PICKER_PIN = 7;
+const uint8_t DONE_PIN = 6; // high while the queue is empty, the ESP32 waits for its rising edge
+const uint8_t JOYSTICK_EVENT_PIN = 8; // high while joystick events are queued, the ESP32 reads them on its rising edge
 
 // Disable motor for testing
 const uint8_t DISABLE_MOTOR = 0;
@@ -37,7 +40,9 @@ Servo piece_picker;
 const uint8_t STEPS_PER_MM = 80;
 const float MM_PER_SQUARE = 66.7; // width of chessboard squares in mm
 const uint8_t GRAVEYARD_GAP = 10.0;   // gap between graveyard and chessboard in mm
-const uint8_t STEP_DELAY = 40; // in us, is half the period of square wave
+const uint8_t STEP_DELAY = 40; // in us, is half the period of square wave, also the start speed of a move
+const float MAX_STEP_RATE = 25000; // in steps/s, cruise speed of a move (312 mm/s)
+const float STEP_ACCELERATION = 60000; // in steps/s^2, the cruise speed is reached after about 3900 steps (49 mm)
 const uint8_t SLOW_STEP_DELAY = 100; // in us
 const uint16_t MOVE_DELAY = 400; // in ms, delay between piece picker and gantry movement
 const uint8_t PICKER_ANGLE[2] {60, 120}; // down angle, up angle  
@@ -58,11 +63,158 @@ enum {
   XY_AXIS
 };
 
-uint8_t x_0, x_1, y_0, y_1, motor_mode; // DO NOT use except for passing into motor_move_piece
+// Queue of segments from the ESP32 (MotorQueue.h on that side): each is (y0 << 4) | (x0 + 3), (y1 << 4) | (x1 + 3), motor_mode
+// (0 direct, 1 taxicab, 2 calibrate, 3 waypoint of the next segment)
+// A transaction is the segment count, then 3 bytes per segment (up to 10, the Wire buffer is 32 bytes)
+#define MOTOR_QUEUE_SIZE 32 // same as the ESP32's
+#define MOTOR_QUEUE_MAX_BATCH 10
+uint8_t queue[MOTOR_QUEUE_SIZE][3];
+volatile uint8_t queue_start = 0;
+volatile uint8_t queue_count = 0;
 
-uint8_t state = 0; // 0: idle/button poll, 1: motor, 2: motor done
+volatile uint8_t state = 0; // 0: idle, 1: motor
 int16_t motor_coord[2] = {-(floor(MM_PER_SQUARE*3) + GRAVEYARD_GAP), 0}; // x, y in mm
 
+// Joystick events: Timer2 samples the DPAD pins every ms, a pin that reads the same for JOYSTICK_DEBOUNCE_MS samples
+// after changing is a press or release, queued with its time until the ESP32 asks for them
+// An event is DPAD_PINS index | 0x80 if pressed, then the time in ms (2 bytes, LSB first)
+#define JOYSTICK_DEBOUNCE_MS 5 // up to 8 samples (3 bit counters)
+#define JOYSTICK_QUEUE_SIZE 32
+#define JOYSTICK_MAX_BATCH 9 // 3 + 3 * 9 bytes, the Wire buffer is 32 bytes
+#define DPAD_MAX_PORTS 3 // the DPAD pins are on ports C, G and L
+volatile uint16_t dpad_levels = 0x3FF; // debounced, bit i for DPAD_PINS[i], high is released (pull-ups)
+// Per port: input register, bits of DPAD pins, DPAD_PINS index of each bit, debounced levels, and a vertical counter
+// (bit b of dpad_counts[p][k] is bit k of the count of pin b) of the samples in a row that differed from the level
+uint8_t dpad_port_count = 0;
+volatile uint8_t* dpad_port_inputs[DPAD_MAX_PORTS];
+uint8_t dpad_port_masks[DPAD_MAX_PORTS];
+uint8_t dpad_port_pins[DPAD_MAX_PORTS][8];
+uint8_t dpad_port_levels[DPAD_MAX_PORTS];
+uint8_t dpad_counts[DPAD_MAX_PORTS][3];
+volatile uint8_t* joystick_event_port;
+uint8_t joystick_event_mask;
+volatile uint16_t joystick_ms = 0;
+uint8_t joystick_events[JOYSTICK_QUEUE_SIZE][3];
+volatile uint8_t joystick_start = 0;
+volatile uint8_t joystick_count = 0;
+
+// One read and a few byte-wide operations per port, the pins are only looked at one by one when one settles:
+// about 250 cycles (15 us) without an event, counted from the instructions rather than measured (it took 25 to 30 us
+// with a port read and shifts per pin). The step interrupt keeps its edges on time when this one holds it up
+ISR(TIMER2_COMPA_vect) {
+  joystick_ms++;
+  for (uint8_t p = 0; p < dpad_port_count; p++) {
+    uint8_t levels = dpad_port_levels[p];
+    uint8_t differs = (*dpad_port_inputs[p] ^ levels) & dpad_port_masks[p];
+    // A pin that reads its level again starts counting over
+    uint8_t c0 = dpad_counts[p][0] & differs;
+    uint8_t c1 = dpad_counts[p][1] & differs;
+    uint8_t c2 = dpad_counts[p][2] & differs;
+    // Pins that differed for JOYSTICK_DEBOUNCE_MS - 1 samples already: this one settles them
+    uint8_t settled = differs & ((JOYSTICK_DEBOUNCE_MS - 1) & 1 ? c0 : ~c0) & ((JOYSTICK_DEBOUNCE_MS - 1) & 2 ? c1 : ~c1) &
+                      ((JOYSTICK_DEBOUNCE_MS - 1) & 4 ? c2 : ~c2);
+    dpad_counts[p][2] = (c2 ^ (c1 & c0 & differs)) & ~settled;
+    dpad_counts[p][1] = (c1 ^ (c0 & differs)) & ~settled;
+    dpad_counts[p][0] = (c0 ^ differs) & ~settled;
+    if (!settled) continue;
+    levels ^= settled;
+    dpad_port_levels[p] = levels;
+    for (uint8_t b = 0; b < 8; b++) {
+      if (!(settled & (1 << b))) continue;
+      uint8_t i = dpad_port_pins[p][b];
+      dpad_levels ^= 1 << i;
+      // A full queue drops the event, the levels sent with every batch still have it
+      if (joystick_count < JOYSTICK_QUEUE_SIZE) {
+        uint8_t slot = (joystick_start + joystick_count) % JOYSTICK_QUEUE_SIZE;
+        joystick_events[slot][0] = i | ((levels & (1 << b)) ? 0 : 0x80);
+        joystick_events[slot][1] = joystick_ms & 0xFF;
+        joystick_events[slot][2] = joystick_ms >> 8;
+        joystick_count++;
+      }
+    }
+    *joystick_event_port |= joystick_event_mask;
+  }
+}
+
+// Waypoints of the next move (motor mode 3 segments, PathRouter.h on the ESP32), in mm
+#define MAX_WAYPOINTS 4 // same as ROUTE_MAX_WAYPOINTS
+int16_t waypoints[MAX_WAYPOINTS][2];
+uint8_t waypoint_count = 0;
+
+// Step generator: Timer1 (the Servo library takes Timer5 first on the Mega) interrupts at every edge of the pulse,
+// so the loop and the I2C handlers aren't blocked while the gantry moves
+// The timer runs free and each edge moves OCR1A on by a half period, so the edges keep to their times even when
+// another interrupt holds this one up. An edge that is already late is taken right away (in CTC mode the counter would
+// have run past OCR1A to 0xFFFF, a 32 ms gap)
+// Lines are interpolated Bresenham style: the axis with more steps (major) steps every time, the other one whenever
+// its error builds up, and the profile runs over the major axis' steps
+StepProfile step_profile;
+volatile uint8_t* step_port; // both pulse pins are on port B
+uint8_t step_major_mask;
+uint8_t step_minor_mask;
+volatile uint32_t step_index;
+uint32_t step_count; // major axis steps
+uint16_t step_half_period; // timer ticks, of the current step
+int32_t step_minor_count;
+int32_t step_error;
+volatile uint8_t step_high;
+volatile uint8_t stepping = 0;
+
+// Next edge ticks after the last one, or right away if the counter is past that already
+static inline void step_timer_next(uint16_t ticks) {
+  uint16_t next = OCR1A + ticks;
+  OCR1A = next;
+  if ((int16_t)(TCNT1 - next) >= 0) {
+    OCR1A = TCNT1 + 2;
+    TIFR1 = _BV(OCF1A);
+  }
+}
+
+ISR(TIMER1_COMPA_vect) {
+  if (step_high) {
+    *step_port &= ~(step_major_mask | step_minor_mask);
+    step_high = 0;
+    if (++step_index >= step_count) {
+      TIMSK1 &= ~_BV(OCIE1A);
+      stepping = 0;
+      return;
+    }
+    step_half_period = step_profile.half_period(step_index, step_count);
+  } else {
+    uint8_t mask = step_major_mask;
+    step_error -= step_minor_count;
+    if (step_error < 0) {
+      mask |= step_minor_mask;
+      step_error += (int32_t)step_count;
+    }
+    *step_port |= mask;
+    step_high = 1;
+  }
+  step_timer_next(step_half_period);
+}
+
+void stepper_start(uint32_t x_steps, uint32_t y_steps) {
+  uint8_t x_mask = digitalPinToBitMask(PUL_PINS[X_AXIS]);
+  uint8_t y_mask = digitalPinToBitMask(PUL_PINS[Y_AXIS]);
+  uint32_t count = max(x_steps, y_steps);
+  if (count == 0) return;
+
+  step_major_mask = x_steps >= y_steps ? x_mask : y_mask;
+  step_minor_mask = x_steps >= y_steps ? y_mask : x_mask;
+  step_minor_count = min(x_steps, y_steps);
+  step_error = count / 2;
+  step_index = 0;
+  step_count = count;
+  step_high = 0;
+  stepping = 1;
+  step_half_period = step_profile.half_period(0, count);
+  noInterrupts();
+  OCR1A = TCNT1 + step_half_period;
+  TIFR1 = _BV(OCF1A);
+  TIMSK1 |= _BV(OCIE1A);
+  interrupts();
+}
+
 void stepper_square_wave(uint8_t mode, uint8_t delay) { // delay in us
   if (mode == XY_AXIS) {
     digitalWrite(PUL_PINS[X_AXIS], HIGH);
@@ -82,53 +234,24 @@ void stepper_square_wave(uint8_t mode, uint8_t delay) { // delay in us
 //   piece_picker.write(angle + BED_LEVEL_OFFSET[floor(x/MM_PER_SQUARE)][floor(y/MM_PER_SQUARE)]);
 // }
 
-void motor_move_line(int8_t x_dir, int8_t y_dir, uint16_t dist, uint8_t delay) { // (x, y) -> [-1, 1], dist in mm, both x, y, cannot be 0
-  uint8_t mode = -1; // init to invalid value
-
-  digitalWrite(DIR_PINS[X_AXIS], x_dir < 0);
-  digitalWrite(DIR_PINS[Y_AXIS], y_dir > 0);
+void motor_move_line(int16_t x_dist, int16_t y_dist) { // in mm, any direction
+  digitalWrite(DIR_PINS[X_AXIS], x_dist < 0);
+  digitalWrite(DIR_PINS[Y_AXIS], y_dist > 0);
 
-  if (x_dir != 0 && y_dir != 0) {
-    mode = XY_AXIS;
-  } else if (x_dir != 0) {
-    mode = X_AXIS;
-  } else if (y_dir != 0) {
-    mode = Y_AXIS;
-  }
-
-  for (int i = 0; i < dist*STEPS_PER_MM; i++) {
-    stepper_square_wave(mode, delay);
-    // servo_bed_level(motor_coord[0]+i*x_dir, motor_coord[1]+i*y_dir, angle);
-  }
+  // Both axes together in a straight line, accelerates, cruises and decelerates along it (step_profile),
+  // returns once the last step is out
+  stepper_start((uint32_t)abs(x_dist)*STEPS_PER_MM, (uint32_t)abs(y_dist)*STEPS_PER_MM);
+  while (stepping);
 }
 
-void motor_move(int16_t x, int16_t y, uint8_t delay, uint8_t taxicab) { // in mm
-  uint16_t x_mag = abs(x-motor_coord[0]), y_mag = abs(y-motor_coord[1]);
-  int8_t x_dir = (x-motor_coord[0]) > 0 ? 1 : -1, y_dir = (y-motor_coord[1]) > 0 ? 1 : -1;
+void motor_move(int16_t x, int16_t y, uint8_t taxicab) { // in mm
+  int16_t x_dist = x-motor_coord[0], y_dist = y-motor_coord[1];
 
   if (taxicab) {
-    Serial.println("taxicab");
-    motor_move_line(x_dir, 0, x_mag, delay);
-    motor_move_line(0, y_dir, y_mag, delay);
-  } else if (x_mag == y_mag) {
-    Serial.println("x == y");
-    motor_move_line(x_dir, y_dir, x_mag, delay);
-  } else if (x_mag > y_mag) {
-    Serial.println("x > y");
-    motor_move_line(x_dir, y_dir, y_mag, delay);
-    motor_move_line(x_dir, 0, x_mag-y_mag, delay);
+    motor_move_line(x_dist, 0);
+    motor_move_line(0, y_dist);
   } else {
-    Serial.println("x < y");
-
-    Serial.println(x);
-    Serial.println(y);
-    Serial.println(x_dir);
-    Serial.println(y_dir);
-    Serial.println(x_mag);
-    Serial.println(y_mag);
-
-    motor_move_line(x_dir, y_dir, x_mag, delay);
-    motor_move_line(0, y_dir, y_mag-x_mag, delay);
+    motor_move_line(x_dist, y_dist);
   }
 
   motor_coord[0] = x;
@@ -136,27 +259,30 @@ void motor_move(int16_t x, int16_t y, uint8_t delay, uint8_t taxicab) { // in mm
 }
 
 // the chessboard has bottom left at (0,0) and is 8x8 squares, the entire playing area has bottom left at(-3,0) and is 14x8 squares
-void motor_move_piece(int16_t x_0, int16_t y_0, int16_t x_1, int16_t y_1, int8_t taxicab) { // in squares, but converted to mm
-  if (x_0 < 0) {
-    x_0 *= MM_PER_SQUARE;
-    x_0 -= GRAVEYARD_GAP;
-  } else if (x_0 > 7) {
-    x_0 *= MM_PER_SQUARE;
-    x_0 += GRAVEYARD_GAP;
-  } else {
-    x_0 *= MM_PER_SQUARE;
+int16_t square_x_mm(int16_t x) { // x in squares
+  int16_t mm = x * MM_PER_SQUARE;
+  if (x < 0) {
+    mm -= GRAVEYARD_GAP;
+  } else if (x > 7) {
+    mm += GRAVEYARD_GAP;
   }
+  return mm;
+}
 
-  if (x_1 < 0) {
-    x_1 *= MM_PER_SQUARE;
-    x_1 -= GRAVEYARD_GAP;
-  } else if (x_1 > 7) {
-    x_1 *= MM_PER_SQUARE;
-    x_1 += GRAVEYARD_GAP;
-  } else {
-    x_1 *= MM_PER_SQUARE;
-  }
+// A waypoint is a square, and whether the point is half a square further on each axis (halfway across the graveyard
+// gap between the board and a graveyard)
+void waypoint_add(int8_t x, int8_t y, uint8_t half_x, uint8_t half_y) {
+  if (waypoint_count >= MAX_WAYPOINTS) return;
+  int16_t x_mm = square_x_mm(x);
+  if (half_x) x_mm = (x_mm + square_x_mm(x + 1)) / 2;
+  waypoints[waypoint_count][0] = x_mm;
+  waypoints[waypoint_count][1] = (y + (half_y ? 0.5 : 0)) * MM_PER_SQUARE;
+  waypoint_count++;
+}
 
+void motor_move_piece(int16_t x_0, int16_t y_0, int16_t x_1, int16_t y_1, int8_t taxicab) { // in squares, but converted to mm
+  x_0 = square_x_mm(x_0);
+  x_1 = square_x_mm(x_1);
   y_0 *= MM_PER_SQUARE;
   y_1 *= MM_PER_SQUARE;
 
@@ -167,11 +293,16 @@ void motor_move_piece(int16_t x_0, int16_t y_0, int16_t x_1, int16_t y_1, int8_t
   Serial.println(motor_coord[1]);
   Serial.println(x_0);
   Serial.println(y_0);
-  motor_move(x_0, y_0, STEP_DELAY, false);
+  motor_move(x_0, y_0, false);
   piece_picker.write(PICKER_ANGLE[1]);
   delay(MOVE_DELAY);
 
-  if (taxicab) {
+  // Routed around the other pieces: straight lines through the waypoints
+  for (uint8_t i = 0; i < waypoint_count; i++) {
+    motor_move(waypoints[i][0], waypoints[i][1], false);
+  }
+
+  if (taxicab && waypoint_count == 0) {
     int x_a, y_a, x_b, y_b;
     x_a = x_0 <= x_1 ? x_0 + (MM_PER_SQUARE/2) : x_0 - (MM_PER_SQUARE/2);
     y_a = y_0 <= y_1 ? y_0 + (MM_PER_SQUARE/2) : y_0 - (MM_PER_SQUARE/2);
@@ -183,8 +314,8 @@ void motor_move_piece(int16_t x_0, int16_t y_0, int16_t x_1, int16_t y_1, int8_t
     x_b = min(max(x_b, (int)(-2.5*MM_PER_SQUARE)), (int)(9.5*MM_PER_SQUARE));
     y_b = min(max(y_b, (int)(MM_PER_SQUARE/2)), (int)(6.5*MM_PER_SQUARE));
 
-    motor_move(x_a, y_a, STEP_DELAY, false);
-    motor_move(x_b, y_b, STEP_DELAY, true);
+    motor_move(x_a, y_a, false);
+    motor_move(x_b, y_b, true);
   }
 
   Serial.println("Second move");
@@ -192,15 +323,16 @@ void motor_move_piece(int16_t x_0, int16_t y_0, int16_t x_1, int16_t y_1, int8_t
   Serial.println(motor_coord[1]);
   Serial.println(x_1);
   Serial.println(y_1);
-  motor_move(x_1, y_1, STEP_DELAY, false);
+  motor_move(x_1, y_1, false);
   piece_picker.write(PICKER_ANGLE[0]);
   delay(MOVE_DELAY);
+  waypoint_count = 0;
 }
 
 void motor_move_calibrate() {
   piece_picker.write(PICKER_ANGLE[0]);
   delay(MOVE_DELAY);
-  motor_move(-3*MM_PER_SQUARE, 0, STEP_DELAY, false);
+  motor_move(-3*MM_PER_SQUARE, 0, false);
 
   digitalWrite(DIR_PINS[X_AXIS], 1); // default x, y, to go to origin (to fix mis-wired drivers)
   digitalWrite(DIR_PINS[Y_AXIS], 0);
@@ -215,7 +347,7 @@ void motor_move_calibrate() {
 
   motor_coord[0] = CALIBRATE_COORD[0];
   motor_coord[1] = CALIBRATE_COORD[1];
-  motor_move(-3*MM_PER_SQUARE, 0, STEP_DELAY, false);
+  motor_move(-3*MM_PER_SQUARE, 0, false);
 }
 
 void setup() {
@@ -224,65 +356,129 @@ void setup() {
   for (uint8_t i = 0; i < 2; i++) pinMode(DIR_PINS[i], OUTPUT);
   for (uint8_t i = 0; i < 2; i++) pinMode(PUL_PINS[i], OUTPUT);
   pinMode(PICKER_PIN, OUTPUT);
+  pinMode(DONE_PIN, OUTPUT);
+  digitalWrite(DONE_PIN, HIGH);
+  pinMode(JOYSTICK_EVENT_PIN, OUTPUT);
+  digitalWrite(JOYSTICK_EVENT_PIN, LOW);
+  for (uint8_t i = 0; i < 10; i++) {
+    volatile uint8_t* input = portInputRegister(digitalPinToPort(DPAD_PINS[i]));
+    uint8_t p = 0;
+    while (p < dpad_port_count && dpad_port_inputs[p] != input) p++;
+    if (p == dpad_port_count) {
+      if (p == DPAD_MAX_PORTS) continue;
+      dpad_port_inputs[p] = input;
+      dpad_port_levels[p] = 0xFF;
+      dpad_port_count++;
+    }
+    uint8_t mask = digitalPinToBitMask(DPAD_PINS[i]);
+    dpad_port_masks[p] |= mask;
+    for (uint8_t b = 0; b < 8; b++) {
+      if (mask == 1 << b) dpad_port_pins[p][b] = i;
+    }
+  }
+  joystick_event_port = portOutputRegister(digitalPinToPort(JOYSTICK_EVENT_PIN));
+  joystick_event_mask = digitalPinToBitMask(JOYSTICK_EVENT_PIN);
 
   Serial.begin(9600);
 
   piece_picker.attach(PICKER_PIN);
 
+  step_port = portOutputRegister(digitalPinToPort(PUL_PINS[X_AXIS]));
+  step_profile.init(1000000.0/(2*STEP_DELAY), MAX_STEP_RATE, STEP_ACCELERATION);
+  TCCR1A = 0;
+  TCCR1B = _BV(CS11); // normal mode (runs free), 16 MHz / 8 (STEP_TIMER_HZ)
+  TCCR2A = _BV(WGM21); // CTC mode, 16 MHz / 64 / 250 = 1 kHz joystick sampling
+  TCCR2B = _BV(CS22);
+  OCR2A = 249;
+  TIMSK2 |= _BV(OCIE2A);
+
   Wire.begin(SUBORDINATE_ADDR);
   Wire.onRequest(requestEvent);
   Wire.onReceive(receiveEvent);
 }
 
-// 0: idle/button poll, 1: motor, 2: motor done
+// 0: idle, 1: motor
 void loop() {
   if (state == 1) {
-    if (!DISABLE_MOTOR) {
-      if (motor_mode == 2) {
-        motor_move_calibrate();
+    // Run the segments back to back, the queue can grow while one is running
+    while (queue_count > 0) {
+      noInterrupts();
+      uint8_t x_0 = queue[queue_start][0];
+      uint8_t x_1 = queue[queue_start][1];
+      uint8_t motor_mode = queue[queue_start][2];
+      interrupts();
+      uint8_t y_0 = x_0 >> 4;
+      uint8_t y_1 = x_1 >> 4;
+      x_0 &= 0x0F;
+      x_1 &= 0x0F;
+
+      if (motor_mode == 3) {
+        waypoint_add(x_0 - 3, y_0, x_1 - 3, y_1); // the next segment's, nothing moves yet
+      } else if (!DISABLE_MOTOR) {
+        if (motor_mode == 2) {
+          motor_move_calibrate();
+        } else {
+          motor_move_piece(x_0 - 3, y_0, x_1 - 3, y_1, motor_mode); // -3 for shifting unsigned to signed
+        }
       } else {
-        motor_move_piece(x_0 - 3, y_0, x_1 - 3, y_1, motor_mode); // -3 for shifting unsigned to signed
+        delay(100);
+        waypoint_count = 0;
       }
-    } else {
-      delay(100);
+
+      noInterrupts();
+      queue_start = (queue_start + 1) % MOTOR_QUEUE_SIZE;
+      queue_count--;
+      interrupts();
     }
-    state = 2;
+    // Nothing more came in while finishing the last one: tell the ESP32
+    noInterrupts();
+    if (queue_count == 0) {
+      state = 0;
+      digitalWrite(DONE_PIN, HIGH);
+    }
+    interrupts();
   }
 }
 
-// 0: idle/button poll, 1: motor, 2: motor done
+// 0: idle, 1: motor
 void receiveEvent(int bytes) {
-  // Read coordinate pair (x0, y0) to (xf, yf) and grid
+  // Read a batch of segments: count, then (x0, y0) to (xf, yf) and motor mode for each
   // Received x coordinates will be +3 of their true value
-  // Receive motor argument in 17 bits
-  if (bytes < 3) return;
+  if (bytes < 1) return;
+  uint8_t count = Wire.read();
+  if (count == 0 || count > MOTOR_QUEUE_MAX_BATCH || bytes != 1 + 3 * count) {
+    while (Wire.available()) Wire.read(); // not a batch, drop it
+    return;
+  }
 
-  x_0 = Wire.read();
-  y_0 = x_0 >> 4;
-  x_0 &= 0x0F;
-  x_1 = Wire.read();
-  y_1 = x_1 >> 4;
-  x_1 &= 0x0F;
-  motor_mode = Wire.read();
+  for (uint8_t i = 0; i < count; i++) {
+    uint8_t segment[3];
+    for (uint8_t j = 0; j < 3; j++) segment[j] = Wire.read();
+    if (queue_count < MOTOR_QUEUE_SIZE) { // the ESP32 never sends more than the queue holds
+      uint8_t slot = (queue_start + queue_count) % MOTOR_QUEUE_SIZE;
+      for (uint8_t j = 0; j < 3; j++) queue[slot][j] = segment[j];
+      queue_count++;
+    }
+  }
 
+  digitalWrite(DONE_PIN, LOW);
   state = 1;
 } 
 
-// 0: idle/button poll, 1: motor, 2: motor done
+// Joystick events, oldest first: the number of events (up to JOYSTICK_MAX_BATCH), the debounced levels of the pins now
+// (2 bytes, LSB first), then the events. The event line goes low once the queue is empty
 void requestEvent() {
-  if (state == 0) {
-    // Read pin states and pack into 10 bits (LSB = pin 31)
-    uint16_t value = 0;
-    for (uint8_t i = 0; i < 10; i++) {
-      if (digitalRead(DPAD_PINS[i])) {
-        value |= (1 << i);
-      }
-    }
-    // Send as 2 bytes, LSB first
-    Wire.write(value & 0xFF);        // Send LSB
-    Wire.write((value >> 8) & 0xFF); // Send MSB
-  } else if (state == 2) {
-    Wire.write(0x96); // Magic number
-    state = 0; 
-  } 
-}
\ No newline at end of file
+  uint8_t reply[3 + 3 * JOYSTICK_MAX_BATCH];
+  uint8_t count = joystick_count < JOYSTICK_MAX_BATCH ? joystick_count : JOYSTICK_MAX_BATCH;
+  // The sampling interrupt can't run inside this one
+  reply[0] = count;
+  reply[1] = dpad_levels & 0xFF;
+  reply[2] = dpad_levels >> 8;
+  for (uint8_t i = 0; i < count; i++) {
+    for (uint8_t j = 0; j < 3; j++) reply[3 + 3 * i + j] = joystick_events[joystick_start][j];
+    joystick_start = (joystick_start + 1) % JOYSTICK_QUEUE_SIZE;
+  }
+  joystick_count -= count;
+  if (joystick_count == 0) digitalWrite(JOYSTICK_EVENT_PIN, LOW);
+  Wire.write(reply, 3 + 3 * count);
+}
@@ -0,0 +1,82 @@
+#include "Bitbase.h"
+#include "BitbaseData.h"
+#include "PieceType.h"
+#include <stdint.h>
+#include <Arduino.h>
+
+// Index of each square of the a1-d1-d4 triangle (rows 1 to 4 start at 0, 4, 7 and 9), -1 outside of it
+static const int8_t KING_TRIANGLE[64] = {
+   0,  1,  2,  3, -1, -1, -1, -1,
+  -1,  4,  5,  6, -1, -1, -1, -1,
+  -1, -1,  7,  8, -1, -1, -1, -1,
+  -1, -1, -1,  9, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+};
+
+uint32_t kpk_index(bool side_to_move, int8_t white_king, int8_t pawn, int8_t black_king) {
+  uint32_t pawn_index = (pawn / 8 - 1) * 4 + pawn % 8;
+  return ((side_to_move * 24UL + pawn_index) * 64 + white_king) * 64 + black_king;
+}
+
+uint32_t kxk_index(int8_t white_king, int8_t piece, int8_t black_king) {
+  return ((uint32_t)KING_TRIANGLE[white_king] * 64 + piece) * 64 + black_king;
+}
+
+// Flips along the a1-h8 diagonal (x and y swapped)
+static int8_t transpose_square(int8_t square) {
+  return (square % 8) * 8 + square / 8;
+}
+
+void kxk_normalize(int8_t &white_king, int8_t &piece, int8_t &black_king) {
+  // Mirror left-right (x ^ 7) and up-down (y ^ 7, square ^ 56) to bring the king to a1-d4, then flip along the diagonal
+  if (white_king % 8 > 3) {
+    white_king ^= 7;
+    piece ^= 7;
+    black_king ^= 7;
+  }
+  if (white_king / 8 > 3) {
+    white_king ^= 56;
+    piece ^= 56;
+    black_king ^= 56;
+  }
+  if (white_king / 8 > white_king % 8) {
+    white_king = transpose_square(white_king);
+    piece = transpose_square(piece);
+    black_king = transpose_square(black_king);
+  }
+}
+
+static bool bitbase_bit(const uint8_t* table, uint32_t index) {
+  return (table[index >> 3] >> (index & 7)) & 1;
+}
+
+bool bitbase_strong_side_wins(PieceType type, bool strong_color, int8_t strong_king, int8_t piece, int8_t weak_king, bool side_to_move) {
+  if (type == PAWN) {
+    // Flip the board so the pawn is white and moves up
+    if (strong_color == 1) {
+      strong_king ^= 56;
+      piece ^= 56;
+      weak_king ^= 56;
+      side_to_move = !side_to_move;
+    }
+    if (piece % 8 > 3) {
+      strong_king ^= 7;
+      piece ^= 7;
+      weak_king ^= 7;
+    }
+    return bitbase_bit(KPK_BITBASE, kpk_index(side_to_move, strong_king, piece, weak_king));
+  }
+  if (type != ROOK && type != QUEEN) {
+    return false;
+  }
+  // With the rook / queen side to move it always wins. Otherwise the table is for the lone king to move: the colors
+  // can be swapped without flipping the board, since there are no pawns
+  if (side_to_move == strong_color) {
+    return true;
+  }
+  kxk_normalize(strong_king, piece, weak_king);
+  return bitbase_bit(type == ROOK ? KRK_BITBASE : KQK_BITBASE, kxk_index(strong_king, piece, weak_king));
+}
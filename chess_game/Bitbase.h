@@ -0,0 +1,45 @@
+// Bitbase.h file
+
+#ifndef BITBASE_H
+#define BITBASE_H
+#include "PieceType.h"
+#include <stdint.h>
+#include <Arduino.h>
+
+// Win/draw bitbases of the king and one piece against a lone king endgames: KPK, KRK and KQK
+// One bit per position (1 = the side with the piece wins with perfect play, 0 = draw), generated by host/bitbase_gen
+// into BitbaseData.h and read in place from flash
+//
+// Positions are looked up with the side with the piece turned into white (for KPK the board is flipped, so the pawn
+// moves up) and folded with the board's symmetries:
+//   KPK: pawn on columns a-d (mirrored left-right), both sides to move
+//        index = ((side_to_move * 24 + pawn) * 64 + white_king) * 64 + black_king, pawn = (y - 1) * 4 + x
+//        2 * 24 * 64 * 64 bits = 24 KB
+//   KRK, KQK: white king in the a1-d1-d4 triangle (mirrored and flipped along the diagonal), black to move only:
+//        with white to move every legal position is a win (the generator checks it)
+//        index = (white_king_triangle * 64 + piece) * 64 + black_king
+//        10 * 64 * 64 bits = 5 KB each
+
+// Results of Board::probe_bitbase, from the side to move's point of view
+#define BITBASE_LOSS -1
+#define BITBASE_DRAW 0
+#define BITBASE_WIN 1
+#define BITBASE_NOT_FOUND 2  // not a KPK, KRK or KQK position
+
+#define KPK_POSITIONS (2UL * 24 * 64 * 64)
+#define KXK_POSITIONS (10UL * 64 * 64)
+
+// Index of a KPK position already turned so white has the pawn, on columns a-d
+uint32_t kpk_index(bool side_to_move, int8_t white_king, int8_t pawn, int8_t black_king);
+
+// Index of a KRK / KQK position with black to move, already folded so the white king is in the a1-d1-d4 triangle
+uint32_t kxk_index(int8_t white_king, int8_t piece, int8_t black_king);
+
+// Folds the squares of a KRK / KQK position so the white king is in the a1-d1-d4 triangle
+void kxk_normalize(int8_t &white_king, int8_t &piece, int8_t &black_king);
+
+// Checks if the side with the piece (strong_color) wins a KPK / KRK / KQK position (type is the piece's type)
+// The position has to be legal
+bool bitbase_strong_side_wins(PieceType type, bool strong_color, int8_t strong_king, int8_t piece, int8_t weak_king, bool side_to_move);
+
+#endif
@@ -0,0 +1,2195 @@
+// BitbaseData.h file
+// Generated by host/bitbase_gen, do not edit
+// Only included by Bitbase.cpp, see Bitbase.h for the layout
+
+#ifndef BITBASE_DATA_H
+#define BITBASE_DATA_H
+#include <stdint.h>
+#include <Arduino.h>
+
+const uint8_t KPK_BITBASE[24576] PROGMEM = {
+  0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE2, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC6, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8E, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1E, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3E, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF0, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE2, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC6, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8E, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1E, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3E, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFC, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xF0, 0xF0, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE2, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xC6, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x8E, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0x1E, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x3E, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFE, 0xFC, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xFF, 0xFE, 0xF8, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFE, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFE, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFE, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFE, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFE, 0xFC, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xFF, 0xFE, 0xFC, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xFF, 0xFE, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFE, 0xFC, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0,
+  0xFF, 0xFE, 0xF8, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0xFE, 0xF0, 0x80, 0x80, 0x80, 0xC0, 0xC0,
+  0xFF, 0xFE, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFE, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+  0xFF, 0xFE, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xFE, 0xFC, 0xF0, 0xE0, 0xE0, 0xE0, 0xF0,
+  0xFF, 0xFE, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF, 0xFE, 0xF0, 0xC0, 0x80, 0x80, 0x80, 0xC0,
+  0xFF, 0xFE, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFE, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+  0xFF, 0xFE, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFE, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFE, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFE, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFE, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFE, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80,
+  0xFF, 0xFE, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00,
+  0xFF, 0xFE, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFE, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8,
+  0xFF, 0xFE, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFE, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xFF, 0xFE, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xFF, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80,
+  0xFF, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+  0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xE3, 0xE1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF,
+  0xC7, 0xC5, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8D, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF,
+  0x1F, 0x1D, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0x3F, 0x3D, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0,
+  0xFC, 0xFC, 0xF8, 0xFC, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF1, 0xF1, 0xF0, 0xF9, 0xFF, 0xF9, 0xFF, 0xFF, 0xE3, 0xE1, 0xE0, 0xF1, 0xFD, 0xF1, 0xFF, 0xFF,
+  0xC7, 0xC5, 0xC0, 0xE0, 0xF8, 0xE0, 0xFF, 0xFF, 0x8F, 0x8D, 0x80, 0xC0, 0xF0, 0xC0, 0xF0, 0xFF,
+  0x1F, 0x1D, 0x00, 0x80, 0xE0, 0x80, 0xE0, 0xE0, 0x3F, 0x3D, 0x00, 0x80, 0xC0, 0x80, 0xC0, 0xC0,
+  0xFF, 0xFC, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF0, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xE1, 0xF5, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC5, 0xC0, 0xC0, 0xE8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8D, 0x80, 0x80, 0xD0, 0xF0, 0xF0, 0xFF,
+  0xFF, 0x1D, 0x00, 0x00, 0xA0, 0xE0, 0xE0, 0xE0, 0xFF, 0x3D, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFD, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFD, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xE0, 0xE1, 0xE1, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFD, 0xC0, 0xC0, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x80, 0x80, 0xF0, 0xF0, 0xFF,
+  0xFF, 0xFD, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFD, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xFD, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xE1, 0xE1, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xFD, 0xF8, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFD, 0xF0, 0x80, 0x80, 0x80, 0xF0, 0xFF,
+  0xFF, 0xFD, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFD, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+  0xFF, 0xFD, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xFD, 0xF8, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFD, 0xF8, 0xF0, 0xE1, 0xE1, 0xE3, 0xFF,
+  0xFF, 0xFD, 0xF8, 0xE0, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFD, 0xF0, 0xC0, 0x80, 0x80, 0x80, 0xFF,
+  0xFF, 0xFD, 0xE0, 0x80, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFD, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xC0,
+  0xFF, 0xFD, 0xF0, 0xF0, 0xF0, 0xFC, 0xFC, 0xFC, 0xFF, 0xFD, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFD, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xFF, 0xFD, 0xF0, 0xF0, 0xF0, 0xE1, 0xE1, 0xE3,
+  0xFF, 0xFD, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC7, 0xFF, 0xFD, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x8F,
+  0xFF, 0xFD, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+  0xFF, 0xFD, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xFF, 0xFD, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8,
+  0xFF, 0xFD, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xFF, 0xFD, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1,
+  0xFF, 0xFD, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xFF, 0xFD, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80,
+  0xFF, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0xFF, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xFF,
+  0xC7, 0xC3, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xFF, 0x8F, 0x8B, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xFF,
+  0x1F, 0x1B, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x3F, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+  0xFC, 0xF8, 0xF0, 0xF8, 0xFB, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF9, 0xFF, 0xF9, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0xE1, 0xF3, 0xFF, 0xF3, 0xFF, 0xFF,
+  0xC7, 0xC3, 0xC1, 0xE3, 0xFB, 0xE3, 0xFF, 0xFF, 0x8F, 0x8B, 0x81, 0xC1, 0xF1, 0xC1, 0xFF, 0xFF,
+  0x1F, 0x1B, 0x00, 0x80, 0xE0, 0x80, 0xE0, 0xFF, 0x3F, 0x3B, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0xC0,
+  0xFF, 0xF8, 0xF0, 0xF8, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE3, 0xF7, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC3, 0xC1, 0xC3, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x81, 0x81, 0xD1, 0xF1, 0xFF, 0xFF,
+  0xFF, 0x1B, 0x00, 0x00, 0xA0, 0xE0, 0xE0, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x40, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFB, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFB, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFB, 0xC1, 0xC3, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x81, 0x81, 0x81, 0xF1, 0xFF, 0xFF,
+  0xFF, 0xFB, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFB, 0xF1, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xFB, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xFB, 0xF1, 0xC3, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+  0xFF, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFB, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+  0xFF, 0xFB, 0xF1, 0xF0, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xFB, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xFB, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFB, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xFB, 0xF1, 0xE1, 0xC3, 0xC3, 0xC7, 0xFF, 0xFF, 0xFB, 0xF1, 0xC1, 0x81, 0x81, 0x8F, 0xFF,
+  0xFF, 0xFB, 0xE0, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFB, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0,
+  0xFF, 0xFB, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFC, 0xFF, 0xFB, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFB, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xFF, 0xFB, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFB, 0xE0, 0xE0, 0xE0, 0xC3, 0xC3, 0xC7, 0xFF, 0xFB, 0xC0, 0xC0, 0xC0, 0x81, 0x81, 0x8F,
+  0xFF, 0xFB, 0x80, 0x80, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFB, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xFF, 0xFB, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8,
+  0xFF, 0xFB, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1, 0xF1, 0xFF, 0xFB, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3,
+  0xFF, 0xFB, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0xC3, 0xFF, 0xFB, 0xC0, 0xC0, 0xC0, 0xC0, 0x81, 0x81,
+  0xFF, 0xFB, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xF4, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF0, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xFF,
+  0xF1, 0xF1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xC7, 0xC7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0x8F, 0x87, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF,
+  0x1F, 0x17, 0x83, 0x83, 0x83, 0x83, 0x83, 0xFF, 0x3F, 0x37, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF,
+  0xFC, 0xF4, 0xE0, 0xE0, 0xE3, 0xE0, 0xFF, 0xFF, 0xF8, 0xF0, 0xE0, 0xF1, 0xF7, 0xF1, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xE1, 0xF3, 0xFF, 0xF3, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xC7, 0xC7, 0xC3, 0xE7, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0x87, 0x83, 0xC7, 0xF7, 0xC7, 0xFF, 0xFF,
+  0x1F, 0x17, 0x03, 0x83, 0xE3, 0x83, 0xFF, 0xFF, 0x3F, 0x37, 0x01, 0x01, 0xC1, 0x01, 0xC1, 0xFF,
+  0xFF, 0xF4, 0xE0, 0xE0, 0xE2, 0xE3, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xF0, 0xF5, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xE1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF7, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC7, 0xC3, 0xC7, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x83, 0x87, 0xD7, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x17, 0x03, 0x03, 0xA3, 0xE3, 0xFF, 0xFF, 0xFF, 0x37, 0x01, 0x01, 0x41, 0xC1, 0xC1, 0xFF,
+  0xFF, 0xF7, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xF7, 0xE0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF7, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF7, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x83, 0x87, 0x87, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF7, 0x03, 0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xF7, 0x01, 0x01, 0x01, 0xC1, 0xC1, 0xFF,
+  0xFF, 0xF7, 0xE3, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xF0, 0xF0, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xF7, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xF7, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0x87, 0x87, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xF7, 0xE3, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xF7, 0xC1, 0x01, 0x01, 0x01, 0xC1, 0xFF,
+  0xFF, 0xF7, 0xE3, 0xE0, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xF7, 0xE3, 0xE1, 0xF0, 0xF0, 0xF8, 0xFF,
+  0xFF, 0xF7, 0xE3, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF7, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xF7, 0xE3, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF7, 0xE3, 0xC3, 0x87, 0x87, 0x8F, 0xFF,
+  0xFF, 0xF7, 0xE3, 0x83, 0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xF7, 0xC1, 0x01, 0x01, 0x01, 0x01, 0xFF,
+  0xFF, 0xF7, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFC, 0xFF, 0xF7, 0xC1, 0xC1, 0xC1, 0xF0, 0xF0, 0xF8,
+  0xFF, 0xF7, 0xC1, 0xC1, 0xC1, 0xF1, 0xF1, 0xF1, 0xFF, 0xF7, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xF7, 0xC1, 0xC1, 0xC1, 0xC7, 0xC7, 0xC7, 0xFF, 0xF7, 0xC1, 0xC1, 0xC1, 0x87, 0x87, 0x8F,
+  0xFF, 0xF7, 0x81, 0x81, 0x81, 0x03, 0x03, 0x1F, 0xFF, 0xF7, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3F,
+  0xFF, 0xF7, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xE0, 0xFF, 0xF7, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xF0,
+  0xFF, 0xF7, 0x80, 0x80, 0x80, 0x80, 0xF1, 0xF1, 0xFF, 0xF7, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3,
+  0xFF, 0xF7, 0x80, 0x80, 0x80, 0x80, 0xC7, 0xC7, 0xFF, 0xF7, 0x80, 0x80, 0x80, 0x80, 0x87, 0x87,
+  0xFF, 0xF7, 0x80, 0x80, 0x80, 0x80, 0x03, 0x03, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFC, 0xFC, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xF1, 0xF0, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE3, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x8F, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0x1F, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFE, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xFF, 0xFF, 0xFE, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xFF, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xF0,
+  0xFF, 0xFF, 0xF0, 0xE0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF, 0xFF, 0xE0, 0xC0, 0x80, 0x80, 0x80, 0xC0,
+  0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+  0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+  0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xE1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xC7, 0xC7, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFC, 0xFC, 0xF8, 0xFC, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF1, 0xF1, 0xF0, 0xF9, 0xFF, 0xF9, 0xFF, 0xFF, 0xE3, 0xE1, 0xE0, 0xF1, 0xFD, 0xF1, 0xFF,
+  0xFF, 0xC7, 0xC0, 0xC0, 0xE0, 0xF8, 0xE0, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0xC0, 0xF0, 0xC0, 0xF0,
+  0xFF, 0x1F, 0x00, 0x00, 0x80, 0xE0, 0x80, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x80, 0xC0, 0x80, 0xC0,
+  0xFF, 0xFF, 0xFC, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFD, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF1, 0xF0, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xE1, 0xF5, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xE8, 0xF8, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xD0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA0, 0xE0, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFD, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFD, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xE0, 0xE1, 0xE1, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xF8, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xE1, 0xE1, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xC0, 0x80, 0x80, 0x80, 0xF0,
+  0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0xC0,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xE1, 0xE1, 0xE3,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xFC, 0xFC, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xE1, 0xE1,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80,
+  0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+  0xFC, 0xFC, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1,
+  0xC7, 0xC7, 0xC3, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0x8F, 0x8F, 0x81, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+  0x1F, 0x1F, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFC, 0xF8, 0xF0, 0xF8, 0xFB, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF9, 0xFF, 0xF9, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xE3, 0xE1, 0xF3, 0xFF, 0xF3, 0xFF,
+  0xFF, 0xC7, 0xC3, 0xC1, 0xE3, 0xFB, 0xE3, 0xFF, 0xFF, 0x8F, 0x81, 0x81, 0xC1, 0xF1, 0xC1, 0xFF,
+  0xFF, 0x1F, 0x00, 0x00, 0x80, 0xE0, 0x80, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0,
+  0xFF, 0xFF, 0xF8, 0xF0, 0xF8, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF8, 0xFD, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE3, 0xF7, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC3, 0xC1, 0xC3, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0xD1, 0xF1, 0xFF,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA0, 0xE0, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x40, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xF9, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFB, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF3, 0xC1, 0xC3, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x81, 0x81, 0x81, 0xF1, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xF1, 0xF0, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xF1, 0xE1, 0xC3, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xE1, 0xC1, 0x81, 0x81, 0x81, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xC0,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xE0, 0xE0, 0xF1, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xF1, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE1, 0xC3, 0xC3, 0xC7, 0xFF, 0xFF, 0xC0, 0xC0, 0xC1, 0x81, 0x81, 0x8F,
+  0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xE0, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xE0, 0xF1, 0xF1, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xE0, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xE0, 0xC3, 0xC3, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x81, 0x81,
+  0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xE3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xC7, 0xC7, 0xE3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x8F, 0x8F, 0x83, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x1F, 0x1F, 0x83, 0x81, 0x81, 0x81, 0x81, 0x81, 0x3F, 0x3F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF0, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1,
+  0xF1, 0xF1, 0xF1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xC7, 0xC7, 0xC7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x8F, 0x8F, 0x87, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0x1F, 0x1F, 0x03, 0x83, 0x83, 0x83, 0x83, 0x83, 0x3F, 0x3F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0xFF, 0xFC, 0xE0, 0xE0, 0xE0, 0xE3, 0xE0, 0xFF, 0xFF, 0xF8, 0xF0, 0xE0, 0xF1, 0xF7, 0xF1, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xE1, 0xF3, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xC7, 0xC7, 0xC3, 0xE7, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0x87, 0x83, 0xC7, 0xF7, 0xC7, 0xFF,
+  0xFF, 0x1F, 0x03, 0x03, 0x83, 0xE3, 0x83, 0xFF, 0xFF, 0x3F, 0x01, 0x01, 0x01, 0xC1, 0x01, 0xC1,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE2, 0xE3, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xF0, 0xF5, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF1, 0xE1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF7, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC7, 0xC3, 0xC7, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x83, 0x87, 0xD7, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x03, 0x03, 0x03, 0xA3, 0xE3, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x41, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xE1, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3, 0xE0, 0xF0, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF7, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF7, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x83, 0x87, 0x87, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC3, 0x03, 0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xF0, 0xF0, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xC3, 0x87, 0x87, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xC3, 0x83, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0x81, 0x01, 0x01, 0x01, 0x01, 0xC1,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xC1, 0xC1, 0xE1, 0xF0, 0xF0, 0xF8,
+  0xFF, 0xFF, 0xC1, 0xC1, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xC1, 0xC1, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xC1, 0xC1, 0xC3, 0x87, 0x87, 0x8F,
+  0xFF, 0xFF, 0x81, 0x81, 0x83, 0x03, 0x03, 0x1F, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xE0, 0xE0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC1, 0xF0, 0xF0,
+  0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC1, 0xF1, 0xF1, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC1, 0xE3, 0xE3,
+  0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC1, 0xC7, 0xC7, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC1, 0x87, 0x87,
+  0xFF, 0xFF, 0x80, 0x80, 0x80, 0x81, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0x1F, 0x1F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x8F, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0x1F, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0x3F, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFC, 0xFC, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xF1, 0xF1, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xC7, 0xC7, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8F, 0x80, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0x1F, 0x1F, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x3F, 0x3F, 0x20, 0xE0, 0xE0, 0xE0, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x3F, 0x20, 0x20, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x20, 0x20, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x20, 0x20, 0x20,
+  0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x20, 0x20,
+  0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFC, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xF1, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x8F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0x3F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xE3, 0xE3, 0xE1, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xC7, 0xC7, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8F, 0x80, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0x1F, 0x1F, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x3F, 0x3F, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF9, 0xFF, 0xF9, 0xFF, 0xFF, 0xE3, 0xE1, 0xE0, 0xF1, 0xFD, 0xF1,
+  0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xE0, 0xF8, 0xE0, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0xC0, 0xF0, 0xC0,
+  0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xC0, 0xE0, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFD, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xE1, 0xF5, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xE8, 0xF8, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xD0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFD, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xE0, 0xE1, 0xE1, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xE1, 0xE1, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xC0, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xE1, 0xE1,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+  0xFC, 0xFC, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x1F, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0xFC, 0xFC, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xC7, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0x8F, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0x3F, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xE1, 0xE1, 0xE1, 0xE1,
+  0xFF, 0xC7, 0xC7, 0xC3, 0xE1, 0xE1, 0xE1, 0xE1, 0xFF, 0x8F, 0x8F, 0x81, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xFF, 0x1F, 0x1F, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x3F, 0x3F, 0x00, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFC, 0xF8, 0xF0, 0xF8, 0xFB, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF9, 0xFF, 0xF9,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF3, 0xFF, 0xF3,
+  0xFF, 0xFF, 0xC7, 0xC3, 0xC1, 0xE3, 0xFB, 0xE3, 0xFF, 0xFF, 0x8F, 0x81, 0x81, 0xC1, 0xF1, 0xC1,
+  0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x80, 0xE0, 0x80, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x80, 0xC0, 0x80,
+  0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF8, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF8, 0xFD, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE3, 0xF7, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC3, 0xC1, 0xC3, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0xD1, 0xF1,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA0, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xF9, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xE1, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF3, 0xC1, 0xC3, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x81, 0x81, 0x81, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xE1, 0xC3, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xE1, 0xC1, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF1, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF1, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE1, 0xC3, 0xC3, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC1, 0x81, 0x81,
+  0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00,
+  0xFC, 0xFC, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0xF1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xC7, 0xC7, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0xFC, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xF1, 0xE3, 0xC1, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xC7, 0xC7, 0xC7, 0xE3, 0xC1, 0xC1, 0xC1, 0xC1, 0x8F, 0x8F, 0x8F, 0x83, 0x81, 0x81, 0x81, 0x81,
+  0x1F, 0x1F, 0x1F, 0x83, 0x81, 0x81, 0x81, 0x81, 0x3F, 0x3F, 0x3F, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0xFF, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xF0, 0xE1, 0xE1, 0xE1, 0xE1,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xE1, 0xE1, 0xE1, 0xE1, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0x8F, 0x8F, 0x87, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xFF, 0x1F, 0x1F, 0x03, 0x83, 0x83, 0x83, 0x83, 0xFF, 0x3F, 0x3F, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0xFF, 0xFF, 0xFC, 0xE0, 0xE0, 0xE0, 0xE3, 0xE0, 0xFF, 0xFF, 0xF8, 0xF0, 0xE0, 0xF1, 0xF7, 0xF1,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xF3, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xE7, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0x87, 0x83, 0xC7, 0xF7, 0xC7,
+  0xFF, 0xFF, 0x1F, 0x03, 0x03, 0x83, 0xE3, 0x83, 0xFF, 0xFF, 0x3F, 0x01, 0x01, 0x01, 0xC1, 0x01,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE2, 0xE3, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xF0, 0xF5, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xE1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF7, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC3, 0xC7, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x83, 0x87, 0xD7, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0xA3, 0xE3, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x41, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3, 0xE0, 0xF0, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF7, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF7, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x83, 0x87, 0x87, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC3, 0x03, 0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xF0, 0xF0, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xC3, 0x87, 0x87, 0x8F,
+  0xFF, 0xFF, 0xFF, 0xC3, 0x83, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0x81, 0x01, 0x01, 0x01, 0x01,
+  0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xE1, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xE3, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xE3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC3, 0x87, 0x87,
+  0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x83, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0x8F, 0x8F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0x3F, 0x3F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xE3, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0x8F, 0x8F, 0x8F, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0x3F, 0x3F, 0x3F, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xE3, 0xE3, 0xE3, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x8F, 0x8F, 0x8F, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x3F, 0x3F, 0x3F, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x8F, 0x8F, 0x80, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x10, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x3F, 0x3F, 0x30, 0xF0, 0xF0, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0x10, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F, 0x30, 0x30, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x10, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x30, 0x30,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x30, 0x30,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x8F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0x3F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xE3, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8F, 0x8F, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x3F, 0x3F, 0x3F, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xE0, 0xF0, 0xF0, 0xFF, 0xFF, 0x8F, 0x8F, 0x80, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x00, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x3F, 0x3F, 0x20, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE0, 0xF9, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0xE0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x3F, 0x20, 0x20, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xE1, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xE0, 0xE1, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x20, 0x20,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xE1, 0xE1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x20, 0x20,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xF8, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xE3, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0x8F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0x3F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xF8, 0xF1, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xC1, 0xC0, 0xC0, 0xC0, 0xFF, 0x8F, 0x8F, 0x8F, 0xC1, 0xC0, 0xC0, 0xC0,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x3F, 0x3F, 0x3F, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE1, 0xE1, 0xE1,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xE1, 0xE1, 0xE1, 0xFF, 0xFF, 0x8F, 0x8F, 0x81, 0xC1, 0xE1, 0xE1,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF0, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF9, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF3, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC3, 0xC1, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x81, 0x81, 0xE1, 0xF1,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xC0, 0xE0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xC1, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF0, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xE1, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xC1, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xE1, 0xC3, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xC1, 0x81, 0x81,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00,
+  0xFC, 0xFC, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0xF1, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0xC7, 0xC7, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x1F, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0xFC, 0xFC, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xF8, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0xF1, 0xF1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3, 0xE3, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0xC7, 0xC7, 0xC7, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x8F, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x1F, 0x1F, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0x3F, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xF8, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xC1, 0xC1, 0xC1, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xC1, 0xC1, 0xC1, 0xFF, 0x8F, 0x8F, 0x8F, 0x83, 0x81, 0x81, 0x81,
+  0xFF, 0x1F, 0x1F, 0x1F, 0x83, 0x81, 0x81, 0x81, 0xFF, 0x3F, 0x3F, 0x3F, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xE0, 0xE0, 0xE1, 0xE1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xE1, 0xE1, 0xE1,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE1, 0xE1, 0xE1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xC3, 0xC3, 0xC3, 0xFF, 0xFF, 0x8F, 0x8F, 0x87, 0xC3, 0xC3, 0xC3,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x03, 0x83, 0xC3, 0xC3, 0xFF, 0xFF, 0x3F, 0x3F, 0x01, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0xE0, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xE0, 0xF3, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x87, 0x83, 0xE7, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x03, 0x03, 0xC3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x01, 0x01, 0x81, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x83, 0x87, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xE0, 0xF0, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x83, 0x87, 0x8F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x01, 0x01, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xC3, 0x87, 0x87,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x83, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x01, 0x01,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x88, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x18, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x38, 0xF8, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x88, 0x88, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x18, 0x18, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x38, 0x38, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x88,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x38, 0x38,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF0, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xFD,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF8, 0xFD,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x80, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x10, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x30, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE0, 0xFD,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0x10, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x30, 0x30, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xE1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0x30,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x30,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF1, 0xF1, 0xF1,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xF1,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xE1, 0xF1, 0xF1,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF1, 0xFB,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xFB,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x81, 0xF1, 0xF1,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x20, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF0, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xFD,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF7,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC3, 0xC1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x81, 0x81, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x20, 0x20, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xC1, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xE1, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xC1, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x81, 0x81,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x20,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE1, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xC3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xE3, 0xF7,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xF7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xF7,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xF7, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x87, 0xE3, 0xF7,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x03, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x01, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xE0, 0xF7,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x87, 0x83, 0xF7,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x01, 0x01, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x83, 0x87,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xE0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x83, 0x87,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x01, 0x01,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFC, 0xFC,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFC, 0xFC,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFC, 0xFC,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFC, 0xFC,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFC, 0xFC,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFC, 0xFC,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFC, 0xFC,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFC, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFC, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFC, 0xFC,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFC, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC4, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8C, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1C, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3C, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC4, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8C, 0x8C,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3C, 0x3C,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x8C,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xFA, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xFA,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xFA, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xFA,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFA,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xFA,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x88, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x18, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x38, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE2,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x88, 0x88,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x38, 0x38,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF1, 0xF1,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF1, 0xF1,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xF1, 0xF1,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xF1, 0xF1,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF1, 0xF1,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF1, 0xF1,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xF1, 0xF1,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xF1, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF1, 0xF5, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF1, 0xF5,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF5, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xF5,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF1, 0xF5, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xF1, 0xF1,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xF1, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x81, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x11, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x31, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC3, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x81, 0x81,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x31, 0x31,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xEB,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xEB, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xEB,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xEB, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xE3, 0xEB,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xEB,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xEB,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x87, 0xEB,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x23, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xE8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x87, 0x8B,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x23, 0x23,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x83,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23,
+  0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xC4, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1C, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3C, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF0, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xC4, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1C, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3C, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0xFC, 0xF0, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xFC, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFC, 0xFC, 0xF0, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xFC, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFC, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0,
+  0xFC, 0xFC, 0xFC, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFC, 0xF0, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFC, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFC, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80,
+  0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8,
+  0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+  0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8,
+  0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFA, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xF5, 0xF1, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xE8, 0xE0, 0xFF, 0xFF,
+  0xF8, 0xC0, 0xC0, 0xC0, 0xD0, 0xC0, 0xF0, 0xFF, 0xF8, 0x80, 0x80, 0x80, 0xA0, 0x80, 0xE0, 0xE0,
+  0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0xC0, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80,
+  0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xF0, 0xF0, 0xFF, 0xF8, 0xE0, 0x80, 0x80, 0x80, 0xE0, 0xE0, 0xE0,
+  0xF8, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xF8, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0xE0, 0xE0,
+  0xF8, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF8, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF,
+  0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
+  0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0,
+  0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8,
+  0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8,
+  0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0,
+  0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xFF,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xFF, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xF1, 0xF0, 0xF0, 0xF0, 0xF1, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFA, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xF5, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xEB, 0xE3, 0xFF, 0xFF,
+  0xF1, 0xC1, 0xC1, 0xC1, 0xD1, 0xC1, 0xFF, 0xFF, 0xF1, 0x81, 0x80, 0x80, 0xA0, 0x80, 0xE0, 0xFF,
+  0xF1, 0x00, 0x00, 0x00, 0x40, 0x00, 0xC0, 0xC0, 0xF1, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x80,
+  0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0xE0, 0xE0, 0xFF,
+  0xF1, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xF1, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xF1, 0xF1, 0xE0, 0x80, 0x80, 0x80, 0xE0, 0xFF,
+  0xF1, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF1, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF,
+  0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xFF,
+  0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xFF, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+  0xF1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF0, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8,
+  0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3,
+  0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8,
+  0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3,
+  0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xC7, 0x83, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x83, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
+  0xF1, 0xF1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xC7, 0xC7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0xFF,
+  0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xE3, 0xE0, 0xC0, 0xC0, 0xC1, 0xC0, 0xC1, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE2, 0xE0, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xF5, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xEB, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xD7, 0xC7, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x83, 0xA3, 0x83, 0xFF, 0xFF,
+  0xE3, 0x03, 0x01, 0x01, 0x41, 0x01, 0xC1, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x80,
+  0xE3, 0xE3, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xFF, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x83, 0x83, 0x83, 0xE3, 0xFF, 0xFF,
+  0xE3, 0xE3, 0x01, 0x01, 0x01, 0xC1, 0xC1, 0xFF, 0xE3, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xE3, 0xE3, 0xC1, 0xC0, 0xC0, 0xC0, 0xC1, 0xFF, 0xE3, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x83, 0x83, 0x83, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xC1, 0x01, 0x01, 0x01, 0xC1, 0xFF, 0xE3, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0xE3, 0xE3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE3, 0xE3, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF,
+  0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xFF,
+  0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0x81, 0x81, 0x81, 0x83, 0x83, 0xFF,
+  0xE3, 0xE3, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xE3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xE3, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xE3, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xE0,
+  0xE3, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF1, 0xF1, 0xE3, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3,
+  0xE3, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC7, 0xC7, 0xE3, 0x80, 0x80, 0x80, 0x80, 0x80, 0x83, 0x83,
+  0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+  0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3,
+  0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83,
+  0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xC7, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFC, 0xF0, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xFF, 0xFC, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0xFF, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xFF, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80,
+  0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8,
+  0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+  0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8,
+  0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+  0xFC, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFA, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF5, 0xF1, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xE8, 0xE0, 0xFF,
+  0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xD0, 0xC0, 0xF0, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xA0, 0x80, 0xE0,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xFF, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xF8, 0xFF,
+  0xFF, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF0, 0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xE0, 0xE0,
+  0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
+  0xFF, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8,
+  0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFC, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF8,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF1, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xE3, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1,
+  0xFF, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF1, 0xF0, 0xF0, 0xF0, 0xF1, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFA, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF5, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xEB, 0xE3, 0xFF,
+  0xFF, 0xF1, 0xC1, 0xC1, 0xC1, 0xD1, 0xC1, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xA0, 0x80, 0xE0,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80,
+  0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xE1, 0xE1, 0xC1, 0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xE0, 0xE0,
+  0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE1, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xE0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF0, 0xF0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF8, 0xF8,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF1, 0xF1, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE3, 0xE3,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xF0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xF8,
+  0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xF1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xE3,
+  0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0xC1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xC1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xC7, 0xC1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xC7, 0xC7, 0x83, 0x81, 0x81, 0x81, 0x81, 0x81, 0x8F, 0x83, 0x83, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x1F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xF1, 0xF1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xC7, 0xC7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xC1, 0xC0, 0xC0, 0xC0, 0xC1, 0xC0, 0xC1, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE2, 0xE0, 0xFF,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF5, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xEB, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xD7, 0xC7, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x83, 0xA3, 0x83, 0xFF,
+  0xFF, 0xC1, 0x01, 0x01, 0x01, 0x41, 0x01, 0xC1, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xFF, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xC3, 0xC3, 0x83, 0x83, 0x83, 0xE3, 0xFF,
+  0xFF, 0x81, 0x81, 0x01, 0x01, 0x01, 0xC1, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xFF, 0xC1, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFF,
+  0xFF, 0xC1, 0xC1, 0xC1, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xC1, 0xC1, 0xC1, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xC1, 0x81, 0x81, 0x83, 0x83, 0x83, 0xFF,
+  0xFF, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xFF, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xE0, 0xE0,
+  0xFF, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xF1, 0xF1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xE3, 0xE3,
+  0xFF, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xC7, 0xC7, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x81, 0x83, 0x83,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE3,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x83,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFC, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xF1, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE3, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x8F, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0x1F, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xC0,
+  0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+  0xFF, 0xFF, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+  0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0xFC, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x1F, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x1F, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFA, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF5, 0xF1, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xE8, 0xE0,
+  0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xD0, 0xC0, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xA0, 0x80,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xF8,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xE0,
+  0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFC, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+  0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFC, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xC7, 0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xE1, 0xE1, 0xE1,
+  0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xF0, 0xF1, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFA, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF5, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xEB, 0xE3,
+  0xFF, 0xFF, 0xF1, 0xC1, 0xC1, 0xC1, 0xD1, 0xC1, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xA0, 0x80,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xE1, 0xE1, 0xC1, 0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xE0,
+  0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE1, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xE0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF8,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF1, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE3,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF1, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0xF1, 0xC1, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3, 0xC1, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xC7, 0xC7, 0xC1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xF1, 0xF1, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE3, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xC7, 0xC7, 0x83, 0x81, 0x81, 0x81, 0x81, 0xFF, 0x8F, 0x83, 0x83, 0x81, 0x81, 0x81, 0x81,
+  0xFF, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE1, 0xE1, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xC1, 0xC0, 0xC0, 0xC0, 0xC1, 0xC0, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE2, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF5, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xEB, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xD7, 0xC7, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x83, 0xA3, 0x83,
+  0xFF, 0xFF, 0xC1, 0x01, 0x01, 0x01, 0x41, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xFF, 0xFF, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE3,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xC3, 0xC3, 0x83, 0x83, 0x83, 0xE3,
+  0xFF, 0xFF, 0x81, 0x81, 0x01, 0x01, 0x01, 0xC1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC1, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xC1, 0x81, 0x81, 0x83, 0x83, 0x83,
+  0xFF, 0xFF, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xE0,
+  0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xF1, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xE3,
+  0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xC7, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x81, 0x83,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0x1F, 0x1F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x8F, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0x1F, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0x3F, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xC7, 0xC7, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8F, 0x80, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0x1F, 0x1F, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x3F, 0x3F, 0x20, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFC, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xF1, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x3F, 0x20, 0x20, 0xE0, 0xE0, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x20, 0x20, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x20, 0x20, 0x20,
+  0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x20, 0x20,
+  0xFC, 0xFC, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFC, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xE3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0x8F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0x3F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFC, 0xFC, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xF1, 0xF1, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x8F, 0x8F, 0x80, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0x1F, 0x1F, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x3F, 0x3F, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+  0xFC, 0xFC, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0xF1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xC7, 0xC7, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x1F, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3, 0xE3, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0x3F, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFC, 0xFC, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xF1, 0xF1, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE3, 0xE3, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x8F, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x1F, 0x1F, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x3F, 0x3F, 0x00, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE3, 0xE3, 0xC1, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xC7, 0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0x80, 0x80, 0xC0,
+  0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xE1, 0xE1,
+  0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xE1, 0xE1, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xC1, 0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE1, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xC0, 0xC0, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00,
+  0xFC, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF1, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xC7, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF1, 0xF1, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFC, 0xFC, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xF8, 0xF8, 0xC0, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xF1, 0xF1, 0xC1, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xE3, 0xE3, 0xC1, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xC7, 0xC7, 0xC1, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x8F, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x1F, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xC7, 0xC7, 0x83, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x8F, 0x83, 0x83, 0x81, 0x81, 0x81,
+  0xFF, 0xFF, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x81, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE1, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xC3, 0xC3, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0xC3, 0xC3,
+  0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xC1, 0xC0, 0xC0, 0xC0, 0xC1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x83, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xC1, 0x01, 0x01, 0x01, 0xC1, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80,
+  0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xC3, 0xC3, 0x83, 0x83, 0x83,
+  0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xC1, 0xC0, 0xC0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xC1, 0x81, 0x81, 0x83, 0x83,
+  0xFF, 0xFF, 0xFF, 0x81, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0x8F, 0x8F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0x3F, 0x3F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xE3, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0x8F, 0x8F, 0x8F, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0x3F, 0x3F, 0x3F, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xE3, 0xE3, 0xE3, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x8F, 0x8F, 0x8F, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x3F, 0x3F, 0x3F, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x8F, 0x8F, 0x80, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x10, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x3F, 0x3F, 0x30, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0x10, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F, 0x30, 0x30, 0xF0, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x10, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x30, 0x30,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x30, 0x30,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x8F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0x3F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8F, 0x8F, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x3F, 0x3F, 0x3F, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xF0,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xE0, 0xE0, 0xF0, 0xFF, 0xFF, 0x8F, 0x8F, 0x80, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x00, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x3F, 0x3F, 0x20, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x3F, 0x20, 0x20, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x20, 0x20,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x20, 0x20,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xF8, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xE3, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0x8F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0x3F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE3, 0xE3, 0xE3, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x8F, 0x8F, 0x8F, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x3F, 0x3F, 0x3F, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF, 0xFF, 0x8F, 0x8F, 0x80, 0xC0, 0xC0, 0xE0,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF1, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC1, 0xC1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFA,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xEB,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00,
+  0xFC, 0xFC, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0xF1, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0xC7, 0xC7, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x1F, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0xFC, 0xFC, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xF8, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0xF1, 0xF1, 0xF1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3, 0xE3, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0xC7, 0xC7, 0xC7, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x8F, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0x1F, 0x1F, 0x1F, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0x3F, 0xFF, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFC, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xF8, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xF1, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xE3, 0xE3, 0xE3, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x8F, 0x8F, 0x8F, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0x1F, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x3F, 0x3F, 0x3F, 0x80, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC1, 0xFF, 0xFF, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC1,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0x8F, 0x8F, 0x81, 0x81, 0x81, 0xC1,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x01, 0x81, 0x81, 0xC1, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xC0, 0xC0, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x83, 0x83, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x01, 0x01, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x83,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xC3, 0x83, 0x83,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x88, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x18, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x38, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x88, 0x88, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x18, 0x18, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x38, 0x38, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x88,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x38, 0x38,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x80, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x10, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x30, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFD,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0x10, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x30, 0x30, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0x30,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x30,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x80, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x20, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF4,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF5,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x80, 0x80, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x20, 0x20, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x20,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xC0, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xC0, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x81, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x01, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x01, 0xC1, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xC0, 0xC0, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF7,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x83, 0x83, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x01, 0x01, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x01, 0x01, 0xC1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x83,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x01, 0x01,
+};
+
+const uint8_t KRK_BITBASE[5120] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC4, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC4, 0xC4, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x8C, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x1C, 0x1C, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xC4, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x8C, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x1C, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3C, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x18, 0x18, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x18, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x38, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0xC1, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x81, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x10, 0x11, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x31, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xC1, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x81, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0x11, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x31, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0x03, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x23, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x18, 0x18, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x18, 0x18, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x38, 0x38, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x88, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0x18, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x38, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x11, 0x11, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x11, 0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xC1, 0xC1, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x81, 0x81, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0x11, 0x11, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x31, 0x31, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xC1, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x81, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0x11, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x31, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x23, 0x23, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x83, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0x03, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x23, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xFC, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC7, 0xC1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x81, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x1F, 0x11, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x31, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC7, 0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x81, 0x81, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x1F, 0x11, 0x11, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x31, 0x31, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x11, 0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31, 0x31, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xC1, 0xC1, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x81, 0x81, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0x11, 0x11, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x31, 0x31, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xC1, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x81, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0x11, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x31, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x8F, 0x8F, 0x8F,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xC7, 0xC7, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x1F, 0x1F, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xFC, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC7, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x83, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x1F, 0x03, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x23, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x83, 0x83, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x1F, 0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x23, 0x23, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x23, 0x23, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x83, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0x03, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x23, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F, 0x8F,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x1F, 0x1F, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xC7, 0xC7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0x1F, 0x1F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xC7, 0xC7, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x83, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0x1F, 0x1F, 0x03, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x23, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x83, 0x83, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x1F, 0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x23, 0x23, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x23, 0x23, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF8, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x83, 0x8F, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0x03, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x23, 0x3F, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x8F, 0x8F, 0x8F,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x3F, 0x3F, 0x3F,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F,
+};
+
+const uint8_t KQK_BITBASE[5120] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC4, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0xC4, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x8C, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x1C, 0x1C, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xC4, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x8C, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x7C, 0x1C, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3C, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFC, 0xFC, 0xFE, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFE,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x7F, 0xFC, 0xFC, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x0F,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x88, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x18, 0x18, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x78, 0x18, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x38, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xFE, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFE,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x7F, 0xF8, 0xF8, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x0F,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0xC1, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x81, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x11, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x31, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xC1, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x81, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x71, 0x11, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x31, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF1, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFE,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xF0, 0xF1, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x7F, 0xF1, 0xF1, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x0F,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE2, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x83, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x23, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE1, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x43, 0x03, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x23, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFE,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x7F, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x0F,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x18, 0x18, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x78, 0x18, 0x18, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x38, 0x38, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x88, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0x18, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x38, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xFE, 0xF8, 0xF8, 0xF8, 0xFE,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0x1F, 0x1F, 0x1F, 0x7F, 0xF8, 0xF8, 0xF8, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x8F, 0x8F, 0x0F,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x11, 0x11, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x01, 0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xC1, 0xC1, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x81, 0x81, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x71, 0x11, 0x11, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x31, 0x31, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF1, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xC1, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x81, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0x11, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x31, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFE,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xF0, 0xF1, 0xF1, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xFF, 0x1F, 0x1F, 0x1F, 0x7F, 0xF1, 0xF1, 0xF1, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0x8F, 0x8F, 0x0F,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE2, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x83, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x23, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE1, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x43, 0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x23, 0x23, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x83, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0x03, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x23, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8, 0xFE,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0x1F, 0x1F, 0x1F, 0x7F, 0xE3, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F, 0x0F,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xFC, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC7, 0xC1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x81, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x1F, 0x11, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x31, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0xF1, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC7, 0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x81, 0x81, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x1F, 0x11, 0x11, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x31, 0x31, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFD, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF7, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x7F, 0x11, 0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31, 0x31, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xC1, 0xC1, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x81, 0x81, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0x11, 0x11, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x31, 0x31, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xC1, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x81, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0x11, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x31, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFE,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0x1F, 0x1F, 0x1F, 0x7F, 0xFF, 0xF1, 0xF1, 0xF1, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF0, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x8F, 0x8F, 0x0F,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xC7, 0xC7, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x1F, 0x1F, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xFC, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC7, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x83, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x1F, 0x03, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x23, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x83, 0x83, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x1F, 0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x23, 0x23, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFD, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x83, 0x83, 0x83, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x5F, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x23, 0x23, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x83, 0x8F, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0x03, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x23, 0x3F, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8, 0xFE,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x8F, 0x8F, 0x8F, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0x1F, 0x1F, 0x1F, 0x7F, 0xFF, 0xE3, 0xE3, 0xE3, 0x3F, 0x3F, 0x3F, 0xFF,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF1, 0xF1, 0xF0, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F, 0x0F,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F, 0x3F,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F,
+  0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x1F, 0x1F, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F,
+  0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xC7, 0xC7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0x1F, 0x1F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xC7, 0xC7, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x0F, 0x8F, 0x83, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0x1F, 0x1F, 0x03, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x23, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x83, 0x83, 0xE3, 0xFF, 0xFF, 0xFF,
+  0x7F, 0x1F, 0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x23, 0x23, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x23, 0x23, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF8, 0xF8, 0xFE,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x83, 0x8F, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0x03, 0x1F, 0x1F, 0x7F, 0xFF, 0xFF, 0xE3, 0xE3, 0x23, 0x3F, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xF0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x8F, 0x8F, 0x0F,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x3F, 0x3F, 0x3F,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F,
+  0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F,
+};
+
+#endif
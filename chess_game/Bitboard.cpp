@@ -0,0 +1,50 @@
+#include "Bitboard.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+// Define the attack tables (computed at compile time)
+constexpr AttackTables ATTACKS;
+
+// Attacks along one ray: walk the precomputed ray and cut it off after the first occupied square
+uint64_t ray_attacks(int8_t square, uint64_t occupancy, RayDirection direction) {
+  uint64_t attacks = ATTACKS.ray[direction][square];
+  uint64_t blockers = attacks & occupancy;
+  if (blockers) {
+    // Rays towards higher indices are blocked by their lowest set bit, the others by their highest
+    int8_t blocker = direction < RAY_SOUTH ? lsb(blockers) : msb(blockers);
+    attacks ^= ATTACKS.ray[direction][blocker];
+  }
+  return attacks;
+}
+
+uint64_t rook_attacks(int8_t square, uint64_t occupancy) {
+  return ray_attacks(square, occupancy, RAY_NORTH) | ray_attacks(square, occupancy, RAY_EAST) | ray_attacks(square, occupancy, RAY_SOUTH) | ray_attacks(square, occupancy, RAY_WEST);
+}
+
+uint64_t bishop_attacks(int8_t square, uint64_t occupancy) {
+  return ray_attacks(square, occupancy, RAY_NORTH_EAST) | ray_attacks(square, occupancy, RAY_NORTH_WEST) | ray_attacks(square, occupancy, RAY_SOUTH_WEST) | ray_attacks(square, occupancy, RAY_SOUTH_EAST);
+}
+
+uint64_t queen_attacks(int8_t square, uint64_t occupancy) {
+  return rook_attacks(square, occupancy) | bishop_attacks(square, occupancy);
+}
+
+uint64_t between_squares(int8_t from, int8_t to) {
+  // Find the ray from "from" that goes through "to", then keep the part of it before "to"
+  int8_t dx = to % 8 - from % 8;
+  int8_t dy = to / 8 - from / 8;
+  if (from == to || (dx != 0 && dy != 0 && abs(dx) != abs(dy))) {
+    return 0;  // not on a line
+  }
+  RayDirection direction;
+  if (dx == 0) {
+    direction = dy > 0 ? RAY_NORTH : RAY_SOUTH;
+  } else if (dy == 0) {
+    direction = dx > 0 ? RAY_EAST : RAY_WEST;
+  } else if (dx > 0) {
+    direction = dy > 0 ? RAY_NORTH_EAST : RAY_SOUTH_EAST;
+  } else {
+    direction = dy > 0 ? RAY_NORTH_WEST : RAY_SOUTH_WEST;
+  }
+  return ATTACKS.ray[direction][from] & ~ATTACKS.ray[direction][to] & ~square_bit(to);
+}
@@ -0,0 +1,120 @@
+// Bitboard.h file
+
+#ifndef BITBOARD_H
+#define BITBOARD_H
+#include <stdint.h>
+
+// A bitboard is a 64-bit mask with one bit per square.
+// Bit index is y*8 + x, the same square index used by the (dest, capture) move pairs,
+// so bit 0 is a1 (x=0, y=0) and bit 63 is h8 (x=7, y=7).
+
+// Ray directions, used to index the ray table.
+// The first four step towards higher square indices, the last four towards lower ones.
+enum RayDirection {
+  RAY_NORTH,       // +8
+  RAY_EAST,        // +1
+  RAY_NORTH_EAST,  // +9
+  RAY_NORTH_WEST,  // +7
+  RAY_SOUTH,       // -8
+  RAY_WEST,        // -1
+  RAY_SOUTH_WEST,  // -9
+  RAY_SOUTH_EAST,  // -7
+  RAY_DIRECTION_COUNT
+};
+
+// Precomputed attack tables. Everything is computed at compile time so the tables live in flash on the ESP32.
+struct AttackTables {
+  uint64_t knight[64];
+  uint64_t king[64];
+  // pawn[color][square]: squares a pawn of that color on that square attacks (0 for white, 1 for black)
+  uint64_t pawn[2][64];
+  // ray[direction][square]: every square from (not including) square to the edge of the board in that direction
+  uint64_t ray[RAY_DIRECTION_COUNT][64];
+
+  constexpr AttackTables() : knight(), king(), pawn(), ray() {
+    const int8_t knight_dx[8] = {2, 2, -2, -2, 1, 1, -1, -1};
+    const int8_t knight_dy[8] = {1, -1, 1, -1, 2, -2, 2, -2};
+    const int8_t ray_dx[RAY_DIRECTION_COUNT] = {0, 1, 1, -1, 0, -1, -1, 1};
+    const int8_t ray_dy[RAY_DIRECTION_COUNT] = {1, 0, 1, 1, -1, 0, -1, -1};
+
+    for (int8_t y = 0; y < 8; y++) {
+      for (int8_t x = 0; x < 8; x++) {
+        int8_t square = y * 8 + x;
+        // Knight
+        for (int8_t i = 0; i < 8; i++) {
+          int8_t new_x = x + knight_dx[i];
+          int8_t new_y = y + knight_dy[i];
+          if (new_x >= 0 && new_x < 8 && new_y >= 0 && new_y < 8) {
+            knight[square] |= 1ULL << (new_y * 8 + new_x);
+          }
+        }
+        // King
+        for (int8_t dy = -1; dy <= 1; dy++) {
+          for (int8_t dx = -1; dx <= 1; dx++) {
+            if (dx == 0 && dy == 0) continue;
+            if (x + dx >= 0 && x + dx < 8 && y + dy >= 0 && y + dy < 8) {
+              king[square] |= 1ULL << ((y + dy) * 8 + x + dx);
+            }
+          }
+        }
+        // Pawns capture diagonally forwards (white towards y=7, black towards y=0)
+        for (int8_t dx = -1; dx <= 1; dx += 2) {
+          if (x + dx < 0 || x + dx > 7) continue;
+          if (y + 1 < 8) pawn[0][square] |= 1ULL << ((y + 1) * 8 + x + dx);
+          if (y - 1 >= 0) pawn[1][square] |= 1ULL << ((y - 1) * 8 + x + dx);
+        }
+        // Rays
+        for (int8_t direction = 0; direction < RAY_DIRECTION_COUNT; direction++) {
+          int8_t x_loop = x + ray_dx[direction];
+          int8_t y_loop = y + ray_dy[direction];
+          while (x_loop >= 0 && x_loop < 8 && y_loop >= 0 && y_loop < 8) {
+            ray[direction][square] |= 1ULL << (y_loop * 8 + x_loop);
+            x_loop += ray_dx[direction];
+            y_loop += ray_dy[direction];
+          }
+        }
+      }
+    }
+  }
+};
+
+extern const AttackTables ATTACKS;
+
+// The light squares (a1 is dark, b1 is light)
+#define LIGHT_SQUARES 0x55AA55AA55AA55AAULL
+
+inline uint64_t square_bit(int8_t square) {
+  return 1ULL << square;
+}
+
+// Index of the least significant set bit. Undefined for an empty bitboard.
+inline int8_t lsb(uint64_t bitboard) {
+  return __builtin_ctzll(bitboard);
+}
+
+// Index of the most significant set bit. Undefined for an empty bitboard.
+inline int8_t msb(uint64_t bitboard) {
+  return 63 - __builtin_clzll(bitboard);
+}
+
+// Returns the least significant set bit and clears it from the bitboard
+inline int8_t pop_lsb(uint64_t &bitboard) {
+  int8_t square = lsb(bitboard);
+  bitboard &= bitboard - 1;
+  return square;
+}
+
+inline int8_t bit_count(uint64_t bitboard) {
+  return __builtin_popcountll(bitboard);
+}
+
+// Sliding piece attacks for a given occupancy (the blocking square itself is included, whatever its color)
+uint64_t ray_attacks(int8_t square, uint64_t occupancy, RayDirection direction);
+uint64_t rook_attacks(int8_t square, uint64_t occupancy);
+uint64_t bishop_attacks(int8_t square, uint64_t occupancy);
+uint64_t queen_attacks(int8_t square, uint64_t occupancy);
+
+// Squares strictly between two squares on the same row, column or diagonal (0 if they aren't on a line)
+uint64_t between_squares(int8_t from, int8_t to);
+
+#endif
@@ -7,46 +7,27 @@
 #include <Arduino.h>
 // #include "MemoryFree.h"
 
-void Board::update_three_fold_repetition_vector() {
-    // Check over the three_fold_repetition_vector to see if the current board state is already in the vector, if so, its count++
-    // If not, it adds the current board state to the vector with count 1
-
-    // Making the sub-vector for the current board
-    // Sub-vector: std::vector<std::pair<location, piece_type>
-
-    std::vector<std::pair<int8_t, int8_t>> sub_vector;
-
-    for (int8_t i = 0; i < 8; i++) {
-      for (int8_t j = 0; j < 8; j++) {
-        if (pieces[i][j]->get_type() != EMPTY && pieces[i][j]->get_type() != PAWN) { // If empty, not tracking it. Also don't track pawns because pawns move clears the 3-fold track
-          if (pieces[i][j]->get_color() == 0) {
-            sub_vector.push_back(std::make_pair(i*8 + j, pieces[i][j]->get_type()));
-          } else { 
-            sub_vector.push_back(std::make_pair(i*8 + j, pieces[i][j]->get_type()+6));
-            // Because for white, pieces are 1-6; for black, starts at 7
-          }
-        }
-      }
-    }
-    
-    // Traverse the three_fold_rep vector and check if the sub-vector is present
-    for (int8_t i = 0; i < three_fold_repetition_vector.size(); i++) {
-      if (three_fold_repetition_vector[i].first == sub_vector) {
-        // Found the sub-vector in the three_fold vector. Increment the count.
-        three_fold_repetition_vector[i].second++;
-        return; // If we found it, do not push another pair. We are done.
-      }
-    }
-    // Didn't find the sub-vector in the three_fold vector. Add it.
-    three_fold_repetition_vector.push_back(std::make_pair(sub_vector, 1));
+void Board::update_repetition_history() {
+  // Move to the next slot of the ring and store the current position there
+  // Older slots get overwritten, but the 50 move rule ends the game before anything we still look at is lost
+  repetition_index = (repetition_index + 1) & (REPETITION_HISTORY_SIZE - 1);
+  repetition_history[repetition_index] = zobrist_hash;
+  if (repetition_count < REPETITION_HISTORY_SIZE) {
+    repetition_count++;
+  }
 }
 
 bool Board::is_three_fold_repetition() {
-  // Traverse the three_fold vector; if any board in there has appeared three times, return true.
-  for (int8_t i = 0; i < three_fold_repetition_vector.size(); i++) {
-    if (three_fold_repetition_vector[i].second == 3) return true;
+  // Positions before the last pawn move or capture can't repeat, so only look back draw_move_counter moves
+  // (and no further than the game recorded so far)
+  // Positions with the other side to move can't match either, so skip every other entry
+  int8_t occurrences = 1;  // the current position
+  for (int8_t i = 2; i <= draw_move_counter && i < repetition_count; i += 2) {
+    if (repetition_history[(repetition_index - i) & (REPETITION_HISTORY_SIZE - 1)] == zobrist_hash) {
+      occurrences++;
+    }
   }
-  return false;
+  return occurrences >= 3;
 }
 
 bool Board::is_insufficient_material(){
@@ -55,60 +36,51 @@ bool Board::is_insufficient_material(){
   // 1. King vs King
   // 2. King and Bishop vs King
   // 3. King and Knight vs King
-  // Some other conditions we can add later
-  int8_t white_bishop_count = 0;
-  int8_t black_bishop_count = 0;
-  int8_t white_knight_count = 0;
-  int8_t black_knight_count = 0;
+  // 4. Kings and bishops only, with every bishop on the same square color (includes King and Bishop vs King and Bishop)
+  // Only looks at the piece counts and the bishop bitboards, no squares are scanned
 
-  // Count the number of bishops and knights (if any other piece is present, return false)
-
-  for (int8_t i = 0; i < 8; i++) {
-    for (int8_t j = 0; j < 8; j++) {
-      if (pieces[i][j]->get_type() == BISHOP) {
-        if (pieces[i][j]->get_color() == 0) {
-          white_bishop_count++;
-        } else {
-          black_bishop_count++;
-        }
-      } else if (pieces[i][j]->get_type() == KNIGHT) {
-        if (pieces[i][j]->get_color() == 0) {
-          white_knight_count++;
-        } else {
-          black_knight_count++;
-        }
-      } else if (pieces[i][j]->get_type() != EMPTY && pieces[i][j]->get_type() != KING) {
-        // If any other piece is present, return false
-        return false;
-      }
-    }
+  // A pawn, rook or queen can always still mate
+  if (piece_counts[0][PAWN] || piece_counts[1][PAWN] || piece_counts[0][ROOK] || piece_counts[1][ROOK] || piece_counts[0][QUEEN] || piece_counts[1][QUEEN]) {
+    return false;
   }
+  int8_t knights = piece_counts[0][KNIGHT] + piece_counts[1][KNIGHT];
+  int8_t bishops = piece_counts[0][BISHOP] + piece_counts[1][BISHOP];
 
-  // If only kings are present, return true
-  if (white_bishop_count == 0 && black_bishop_count == 0 && white_knight_count == 0 && black_knight_count == 0) {
+  // Cases 1 to 3: at most one minor piece on the board
+  if (knights + bishops <= 1) {
     return true;
   }
 
-  // If only one side has a bishop or a knight, return true
-  // knight case
-  if (white_bishop_count == 0 && black_bishop_count == 0 && white_knight_count == 1 && black_knight_count == 0) {
-    return true;
-  }
-  if (white_bishop_count == 0 && black_bishop_count == 0 && white_knight_count == 0 && black_knight_count == 1) {
-    return true;
-  }
-  // bishop case
-  if (white_bishop_count == 1 && black_bishop_count == 0 && white_knight_count == 0 && black_knight_count == 0) {
-    return true;
-  }
-  if (white_bishop_count == 0 && black_bishop_count == 1 && white_knight_count == 0 && black_knight_count == 0) {
-    return true;
+  // Case 4: bishops that all move on light squares, or all on dark squares, can never attack the king's square from both colors
+  if (knights == 0) {
+    uint64_t all_bishops = piece_bitboards[0][BISHOP] | piece_bitboards[1][BISHOP];
+    return !(all_bishops & LIGHT_SQUARES) || !(all_bishops & ~LIGHT_SQUARES);
   }
 
   // Otherwise, return false
   return false;
 }
 
+int8_t Board::probe_bitbase() {
+  // Exactly three pieces: the two kings and a pawn, rook or queen
+  if (bit_count(occupied) != 3) {
+    return BITBASE_NOT_FOUND;
+  }
+  uint64_t kings = piece_bitboards[0][KING] | piece_bitboards[1][KING];
+  int8_t piece = lsb(occupied & ~kings);
+  PieceType type = code_type(squares[piece]);
+  if (type != PAWN && type != ROOK && type != QUEEN) {
+    return BITBASE_NOT_FOUND;
+  }
+  bool strong_color = code_color(squares[piece]);
+  int8_t strong_king = lsb(piece_bitboards[strong_color][KING]);
+  int8_t weak_king = lsb(piece_bitboards[!strong_color][KING]);
+  if (!bitbase_strong_side_wins(type, strong_color, strong_king, piece, weak_king, side_to_move)) {
+    return BITBASE_DRAW;
+  }
+  return side_to_move == strong_color ? BITBASE_WIN : BITBASE_LOSS;
+}
+
 
 
 // Function that moves a piece
@@ -116,38 +88,47 @@ bool Board::is_insufficient_material(){
 // In the end of the function, each individual piece's x and y should be updated
 // Also, the board array will reflect the new state of the board
 void Board::move_piece(int8_t x, int8_t y, int8_t new_x, int8_t new_y, int8_t capture_x, int8_t capture_y) {
+  apply_move(x, y, new_x, new_y, capture_x, capture_y);
+
+  update_repetition_history(); // Record the new board state for three-fold repetition
+}
+
+void Board::apply_move(int8_t x, int8_t y, int8_t new_x, int8_t new_y, int8_t capture_x, int8_t capture_y) {
   /*
     Make a chess piece move happen on the actual board
-    Reset en-passant square and set to new one if it's a pawn move (and reset a pawn's double move)
+    Reset en-passant square and set to new one if it's a pawn move
     If it's a king move, reset castle capability
-      Also check for if this move is a castle, which moves the rook first (both update the board and the piece)
+      Also check for if this move is a castle, which moves the rook first
     If it's a rook move, reset castle capability
-    If it has any capture, set the captured piece to EMPTY
-    Update the piece and destination piece's x and y
+    If it has any capture, empty the captured square
+    Move the piece's code to the new square, and empty the old one
   */
+  uint8_t moving = squares[y * 8 + x];
+  PieceType type = code_type(moving);
+  bool color = code_color(moving);
+
   // Increment the move counter
   draw_move_counter++;
 
+  // Take the old castling flags and en passant square out of the hash (the new ones are put back in at the end)
+  zobrist_hash ^= castling_and_en_passant_hash();
+
   // By default no en passant square
   en_passant_square_x = -1;
   en_passant_square_y = -1;
   // PAWN:
-  if (pieces[y][x]->get_type() == PAWN) {
+  if (type == PAWN) {
     draw_move_counter = 0; // Reset the draw move counter
-    // Draw move counter has been reset; we should also flush three_fold_repetition_vector (since if pawn moves, it cannot repeat...)
-    three_fold_repetition_vector.clear();
 
     // If the pawn moves two squares, it can be taken en passant
     if (abs(new_y - y) == 2) {
       en_passant_square_x = new_x;
       en_passant_square_y = new_y;
     }
-    // If the pawn moves, it can't move two squares
-    pieces[y][x]->double_move = false;
   }
   // If the king moves, it can't castle
-  if (pieces[y][x]->type == KING) {
-    if (pieces[y][x]->color == 0) {
+  if (type == KING) {
+    if (color == 0) {
       white_king_castle = false;
       white_queen_castle = false;
       // Update the king's location
@@ -164,44 +145,29 @@ void Board::move_piece(int8_t x, int8_t y, int8_t new_x, int8_t new_y, int8_t ca
     if (abs(new_x - x) == 2) {
       // Castling
       // If the king moves two squares, move the rook
-      // If the king moves to the right, move the rook to the left
-      // Since castling doesn't involve capture but 2 pieces are involved
-      // we exchange the rook with the empty space here
-      if (new_x > x) {
-        // Change the rook's x to 3
-        pieces[new_y][7]->x = new_x - 1;
-        // Change the empty space's x to 7
-        pieces[new_y][new_x - 1]->x = 7;
-        // Do a piece swap
-        Piece *temp = pieces[new_y][7];
-        pieces[new_y][7] = pieces[new_y][new_x - 1];
-        pieces[new_y][new_x - 1] = temp;
-      } else {
-        // Change the rook's x to 5
-        pieces[new_y][0]->x = new_x + 1;
-        // Change the empty space's x to 0
-        pieces[new_y][new_x + 1]->x = 0;
-        // Do a piece swap
-        Piece *temp = pieces[new_y][0];
-        pieces[new_y][0] = pieces[new_y][new_x + 1];
-        pieces[new_y][new_x + 1] = temp;
-      }
+      // If the king moves to the right, the rook goes from x = 7 to new_x - 1, otherwise from x = 0 to new_x + 1
+      int8_t rook_x = new_x > x ? 7 : 0;
+      int8_t rook_new_x = new_x > x ? new_x - 1 : new_x + 1;
+      clear_bitboard_square(new_y * 8 + rook_x, ROOK, color);
+      set_bitboard_square(new_y * 8 + rook_new_x, ROOK, color);
+      squares[new_y * 8 + rook_new_x] = squares[new_y * 8 + rook_x];
+      squares[new_y * 8 + rook_x] = 0;
     }
   }
-  // If rook moves, king can't castle that side
-  if (pieces[y][x]->type == ROOK) {
-    if (pieces[y][x]->color == 0) {
+  // If rook moves from its starting corner, king can't castle that side
+  if (type == ROOK) {
+    if (color == 0 && y == 0) {
       // a1 rook - white queen side
       if (x == 0) {
         white_queen_castle = false;
-      } else {
+      } else if (x == 7) {
         white_king_castle = false;
       }
-    } else {
+    } else if (color == 1 && y == 7) {
       // a8 rook - black queen side
       if (x == 0) {
         black_queen_castle = false;
-      } else {
+      } else if (x == 7) {
         black_king_castle = false;
       }
     }
@@ -224,184 +190,581 @@ void Board::move_piece(int8_t x, int8_t y, int8_t new_x, int8_t new_y, int8_t ca
     }
   }
 
-  // Update piece's x and y (move captured piece first, then the new_x, new_y, then the original x, y)
-  // Captured (set piece type to EMPTY) (Graveyard function is implemented outside the chess_game code, it's part of the real physical board)
-  //  And we can initialize a new empty piece for the new location
+  // Captured (empty the square) (Graveyard function is implemented outside the chess_game code, it's part of the real physical board)
   if (capture_x != -1) {
-    pieces[capture_y][capture_x]->type = EMPTY;
+    uint8_t captured = squares[capture_y * 8 + capture_x];
+    clear_bitboard_square(capture_y * 8 + capture_x, code_type(captured), code_color(captured));
+    squares[capture_y * 8 + capture_x] = 0;
     draw_move_counter = 0; // Reset the draw move counter
-    three_fold_repetition_vector.clear(); // Flush the 3-fold repetition vector
-  }
-  // New x, new y
-  // Set coordinate first, then exchange the point8_ters
-  pieces[new_y][new_x]->x = x; // we know the new piece is empty
-  pieces[new_y][new_x]->y = y;
-  pieces[y][x]->x = new_x;
-  pieces[y][x]->y = new_y;
-  // Do a piece swap
-  Piece *temp = pieces[new_y][new_x];
-  pieces[new_y][new_x] = pieces[y][x];
-  pieces[y][x] = temp;
-
-  update_three_fold_repetition_vector(); // Update the three_fold_repetition_vector given the new board state
+  }
+  // Move the piece
+  clear_bitboard_square(y * 8 + x, type, color);
+  set_bitboard_square(new_y * 8 + new_x, type, color);
+  squares[new_y * 8 + new_x] = moving;
+  squares[y * 8 + x] = 0;
+
+  // Put the new castling flags and en passant square into the hash, and switch the side to move
+  zobrist_hash ^= castling_and_en_passant_hash();
+  zobrist_hash ^= ZOBRIST.black_to_move;
+  side_to_move = !side_to_move;
+}
+
+void Board::make_move(int8_t x, int8_t y, int8_t new_x, int8_t new_y, int8_t capture_x, int8_t capture_y, PieceType promotion) {
+  // Remember everything the move changes
+  UndoState &undo = undo_stack[undo_count++];
+  undo.x = x;
+  undo.y = y;
+  undo.new_x = new_x;
+  undo.new_y = new_y;
+  undo.capture_x = capture_x;
+  undo.capture_y = capture_y;
+  undo.moved_type = code_type(squares[y * 8 + x]);
+  if (capture_x != -1) {
+    undo.captured_type = code_type(squares[capture_y * 8 + capture_x]);
+    undo.captured_color = code_color(squares[capture_y * 8 + capture_x]);
+  } else {
+    undo.captured_type = EMPTY;
+    undo.captured_color = 0;
+  }
+  undo.black_king_castle = black_king_castle;
+  undo.black_queen_castle = black_queen_castle;
+  undo.white_king_castle = white_king_castle;
+  undo.white_queen_castle = white_queen_castle;
+  undo.en_passant_square_x = en_passant_square_x;
+  undo.en_passant_square_y = en_passant_square_y;
+  undo.draw_move_counter = draw_move_counter;
+  undo.black_king_x = black_king_x;
+  undo.black_king_y = black_king_y;
+  undo.white_king_x = white_king_x;
+  undo.white_king_y = white_king_y;
+  undo.zobrist_hash = zobrist_hash;
+
+  apply_move(x, y, new_x, new_y, capture_x, capture_y);
+
+  if (promotion != EMPTY) {
+    // Same as promote_pawn, but without touching the repetition_history
+    bool color = code_color(squares[new_y * 8 + new_x]);
+    clear_bitboard_square(new_y * 8 + new_x, PAWN, color);
+    set_bitboard_square(new_y * 8 + new_x, promotion, color);
+    squares[new_y * 8 + new_x] = square_code(promotion, color);
+  }
+}
+
+void Board::make_move(Move move, PieceType promotion) {
+  int8_t capture_square = move_capture_square(move);
+  make_move(move_from(move) % 8, move_from(move) / 8, move_to(move) % 8, move_to(move) / 8,
+            capture_square == -1 ? -1 : capture_square % 8, capture_square == -1 ? -1 : capture_square / 8, promotion);
+}
+
+void Board::play_move(Move move, PieceType promotion) {
+  make_move(move, promotion);
+  undo_count = 0; // A game move is never taken back
+
+  update_repetition_history(); // Record the new board state for three-fold repetition
+}
+
+void Board::unmake_move() {
+  UndoState &undo = undo_stack[--undo_count];
+  int8_t x = undo.x;
+  int8_t y = undo.y;
+  int8_t new_x = undo.new_x;
+  int8_t new_y = undo.new_y;
+  uint8_t moved = squares[new_y * 8 + new_x];
+  bool color = code_color(moved);
+
+  // Move the piece back, as the type it was before the move (undoes a promotion)
+  clear_bitboard_square(new_y * 8 + new_x, code_type(moved), color);
+  set_bitboard_square(y * 8 + x, undo.moved_type, color);
+  squares[y * 8 + x] = square_code(undo.moved_type, color);
+  squares[new_y * 8 + new_x] = 0;
+
+  // Put the rook back if this was a castle
+  if (undo.moved_type == KING && abs(new_x - x) == 2) {
+    int8_t rook_x = new_x > x ? 7 : 0;           // where the rook started
+    int8_t rook_new_x = new_x > x ? new_x - 1 : new_x + 1;  // where the rook went
+    clear_bitboard_square(new_y * 8 + rook_new_x, ROOK, color);
+    set_bitboard_square(new_y * 8 + rook_x, ROOK, color);
+    squares[new_y * 8 + rook_x] = squares[new_y * 8 + rook_new_x];
+    squares[new_y * 8 + rook_new_x] = 0;
+  }
+
+  // Bring back the captured piece (the square was emptied by the move)
+  if (undo.capture_x != -1) {
+    squares[undo.capture_y * 8 + undo.capture_x] = square_code(undo.captured_type, undo.captured_color);
+    set_bitboard_square(undo.capture_y * 8 + undo.capture_x, undo.captured_type, undo.captured_color);
+  }
+
+  // Restore the board state
+  black_king_castle = undo.black_king_castle;
+  black_queen_castle = undo.black_queen_castle;
+  white_king_castle = undo.white_king_castle;
+  white_queen_castle = undo.white_queen_castle;
+  en_passant_square_x = undo.en_passant_square_x;
+  en_passant_square_y = undo.en_passant_square_y;
+  draw_move_counter = undo.draw_move_counter;
+  black_king_x = undo.black_king_x;
+  black_king_y = undo.black_king_y;
+  white_king_x = undo.white_king_x;
+  white_king_y = undo.white_king_y;
+  side_to_move = !side_to_move;
+  // The piece moves above already undid the piece part of the hash, but restoring it also covers the castling and en passant part
+  zobrist_hash = undo.zobrist_hash;
 }
 
 bool Board::under_check(bool color) {
   // Check if the king is under check
   // color: 0 for white, 1 for black
-  // Loop through all pieces
-  for (int8_t i = 0; i < 8; i++) {
-    for (int8_t j = 0; j < 8; j++) {
-      // If the piece is an enemy piece
-      if (pieces[i][j]->get_color() != color && pieces[i][j]->get_type() != EMPTY) {
-        // Get all possible moves of the piece
-        std::vector<std::pair<int8_t, int8_t>> moves = pieces[i][j]->get_possible_moves(this);
-        // Check if any of the moves are on the king
-        for (int8_t k = 0; k < moves.size(); k++) {
-          // The second pair is the capture square, which we care about
-          if (moves[k].second%8 == (color == 0 ? white_king_x : black_king_x) && moves[k].second/8 == (color == 0 ? white_king_y : black_king_y)) {
-            return true;
-          }
-        }
-      }
+  int8_t king_square = color == 0 ? white_king_y * 8 + white_king_x : black_king_y * 8 + black_king_x;
+  return is_square_attacked(king_square, !color);
+}
+
+// Bitboard of all check sources to a player
+uint64_t Board::sources_of_check(bool color) {
+  int8_t king_square = color == 0 ? white_king_y * 8 + white_king_x : black_king_y * 8 + black_king_x;
+  return attackers_of(king_square) & color_bitboards[!color];
+}
+
+bool Board::is_square_attacked(int8_t square, bool by_color) {
+  // Look outwards from the square, and stop at the first attacker found
+  // Pawns, knights and the king are one table lookup each
+  if ((ATTACKS.pawn[!by_color][square] & piece_bitboards[by_color][PAWN])
+      || (ATTACKS.knight[square] & piece_bitboards[by_color][KNIGHT])
+      || (ATTACKS.king[square] & piece_bitboards[by_color][KING])) {
+    return true;
+  }
+  // Sliders: only walk the rays that have a rook / bishop / queen of that color somewhere on them
+  uint64_t straight = piece_bitboards[by_color][ROOK] | piece_bitboards[by_color][QUEEN];
+  uint64_t diagonal = piece_bitboards[by_color][BISHOP] | piece_bitboards[by_color][QUEEN];
+  for (int8_t direction = 0; direction < RAY_DIRECTION_COUNT; direction++) {
+    // RAY_NORTH, RAY_EAST, RAY_SOUTH and RAY_WEST are the straight ones
+    uint64_t sliders = (direction == RAY_NORTH || direction == RAY_EAST || direction == RAY_SOUTH || direction == RAY_WEST) ? straight : diagonal;
+    if ((ATTACKS.ray[direction][square] & sliders) && (ray_attacks(square, occupied, (RayDirection)direction) & sliders)) {
+      return true;
     }
   }
   return false;
 }
 
-// Make a vector of all check sources to a player
-std::vector<std::pair<int8_t, int8_t>> Board::sources_of_check(bool color) {
-  // Check if the king is under check
-  // color: 0 for white, 1 for black
-  std::vector<std::pair<int8_t, int8_t>> sources;
-  // Loop through all pieces
-  for (int8_t i = 0; i < 8; i++) {
-    for (int8_t j = 0; j < 8; j++) {
-      // If the piece is an enemy piece
-      if (pieces[i][j]->get_color() != color && pieces[i][j]->get_type() != EMPTY) {
-        // Get all possible moves of the piece
-        std::vector<std::pair<int8_t, int8_t>> moves = pieces[i][j]->get_possible_moves(this);
-        // Check if any of the moves are on the king
-        for (int8_t k = 0; k < moves.size(); k++) {
-          // The second pair is the capture square, which we care about
-          if (moves[k].second%8 == (color == 0 ? white_king_x : black_king_x) && moves[k].second/8 == (color == 0 ? white_king_y : black_king_y)) {
-            sources.push_back(std::make_pair(j, i));
+uint64_t Board::attackers_of(int8_t square) {
+  return attackers_to(square, 0, occupied) | attackers_to(square, 1, occupied);
+}
+
+
+Board Board::copy_board() {
+  // Everything is stored inline, so copying the object copies the whole board state
+  // (squares, bitboards, flags, hash, 3-fold repetition history and undo stack)
+  return *this;
+}
+
+Piece Board::piece_at(int8_t x, int8_t y) const {
+  uint8_t code = squares[y * 8 + x];
+  return Piece(code_type(code), code_color(code), x, y);
+}
+
+void Board::set_square(int8_t x, int8_t y, PieceType type, bool color) {
+  uint8_t old_code = squares[y * 8 + x];
+  if (old_code) {
+    clear_bitboard_square(y * 8 + x, code_type(old_code), code_color(old_code));
+  }
+  squares[y * 8 + x] = square_code(type, color);
+  if (type != EMPTY) {
+    set_bitboard_square(y * 8 + x, type, color);
+  }
+  if (type == KING) {
+    if (color == 0) {
+      white_king_x = x;
+      white_king_y = y;
+    } else {
+      black_king_x = x;
+      black_king_y = y;
+    }
+  }
+}
+
+bool Board::from_fen(const char* fen) {
+  const char* c = fen;
+  int8_t white_kings = 0;
+  int8_t black_kings = 0;
+
+  // Piece placement, from row 8 (y = 7) down to row 1, each row from x = 0 to x = 7
+  for (int8_t y = 7; y >= 0; y--) {
+    int8_t x = 0;
+    while (x < 8) {
+      if (*c >= '1' && *c <= '8') {
+        // A run of empty squares
+        int8_t empty = *c - '0';
+        if (x + empty > 8) {
+          return false;
+        }
+        for (int8_t i = 0; i < empty; i++, x++) {
+          squares[y * 8 + x] = 0;
+        }
+      } else {
+        // Upper case is white, lower case is black
+        bool color = *c >= 'a' && *c <= 'z';
+        PieceType type;
+        switch (color ? *c - 'a' + 'A' : *c) {
+          case 'K': type = KING; break;
+          case 'Q': type = QUEEN; break;
+          case 'B': type = BISHOP; break;
+          case 'N': type = KNIGHT; break;
+          case 'R': type = ROOK; break;
+          case 'P': type = PAWN; break;
+          default: return false;
+        }
+        squares[y * 8 + x] = square_code(type, color);
+        if (type == KING) {
+          if (color) {
+            black_king_x = x;
+            black_king_y = y;
+            black_kings++;
+          } else {
+            white_king_x = x;
+            white_king_y = y;
+            white_kings++;
           }
         }
+        x++;
       }
+      c++;
     }
+    // Rows are separated by '/', the last one is followed by a space
+    if (*c != (y > 0 ? '/' : ' ')) {
+      return false;
+    }
+    c++;
+  }
+  if (white_kings != 1 || black_kings != 1) {
+    return false;
   }
-  return sources;
-}
 
+  // Side to move
+  if (*c != 'w' && *c != 'b') {
+    return false;
+  }
+  side_to_move = *c == 'b';
+  c++;
+
+  // Castling flags ("-" if none)
+  white_king_castle = false;
+  white_queen_castle = false;
+  black_king_castle = false;
+  black_queen_castle = false;
+  if (*c++ != ' ') {
+    return false;
+  }
+  if (*c == '-') {
+    c++;
+  } else {
+    for (; *c && *c != ' '; c++) {
+      switch (*c) {
+        case 'K': white_king_castle = true; break;
+        case 'Q': white_queen_castle = true; break;
+        case 'k': black_king_castle = true; break;
+        case 'q': black_queen_castle = true; break;
+        default: return false;
+      }
+    }
+  }
 
-Board Board::copy_board() {
-  // Copy the board
-  Board new_board; // TODO: check if this needs to have a space allocated in memory
+  // En passant square ("-" if none)
+  // FEN gives the square the capturing pawn moves to, we store the pawn that can be taken (one row further)
+  en_passant_square_x = -1;
+  en_passant_square_y = -1;
+  if (*c++ != ' ') {
+    return false;
+  }
+  if (*c == '-') {
+    c++;
+  } else {
+    if (c[0] < 'a' || c[0] > 'h' || (c[1] != '3' && c[1] != '6')) {
+      return false;
+    }
+    en_passant_square_x = c[0] - 'a';
+    en_passant_square_y = c[1] == '3' ? 3 : 4;
+    c += 2;
+  }
 
-  // Free old pieces in new_board before assigning new ones
-  for (int8_t i = 0; i < 8; i++) {
-    for (int8_t j = 0; j < 8; j++) {
-      delete new_board.pieces[i][j]; // Free previously allocated memory
+  // Halfmove clock (optional), the move number after it is ignored
+  draw_move_counter = 0;
+  if (*c == ' ') {
+    c++;
+    int16_t halfmoves = 0;
+    for (; *c >= '0' && *c <= '9'; c++) {
+      halfmoves = halfmoves * 10 + *c - '0';
+      if (halfmoves > 127) {
+        return false;
+      }
     }
+    draw_move_counter = halfmoves;
   }
 
-  // Copy the pieces
-  for (int8_t i = 0; i < 8; i++) {
-    for (int8_t j = 0; j < 8; j++) {
-      new_board.pieces[i][j] = new Piece(
-                pieces[i][j]->type,
-                pieces[i][j]->color,
-                pieces[i][j]->x,
-                pieces[i][j]->y
-            );
+  // Fresh game state from here on
+  undo_count = 0;
+  update_bitboards();
+  repetition_index = 0;
+  repetition_history[0] = zobrist_hash;
+  repetition_count = 1;
+  return true;
+}
+
+uint8_t Board::to_fen(char* fen) {
+  const char piece_chars[7] = {' ', 'K', 'Q', 'B', 'N', 'R', 'P'};
+  uint8_t length = 0;
+
+  // Piece placement, from row 8 down to row 1
+  for (int8_t y = 7; y >= 0; y--) {
+    int8_t empty = 0;
+    for (int8_t x = 0; x < 8; x++) {
+      uint8_t code = squares[y * 8 + x];
+      if (code == 0) {
+        empty++;
+        continue;
+      }
+      if (empty) {
+        fen[length++] = '0' + empty;
+        empty = 0;
+      }
+      char piece = piece_chars[code_type(code)];
+      // Black pieces are lower case
+      fen[length++] = code_color(code) ? piece - 'A' + 'a' : piece;
+    }
+    if (empty) {
+      fen[length++] = '0' + empty;
     }
+    fen[length++] = y > 0 ? '/' : ' ';
+  }
+
+  // Side to move
+  fen[length++] = side_to_move ? 'b' : 'w';
+  fen[length++] = ' ';
+
+  // Castling flags
+  if (!white_king_castle && !white_queen_castle && !black_king_castle && !black_queen_castle) {
+    fen[length++] = '-';
+  } else {
+    if (white_king_castle) fen[length++] = 'K';
+    if (white_queen_castle) fen[length++] = 'Q';
+    if (black_king_castle) fen[length++] = 'k';
+    if (black_queen_castle) fen[length++] = 'q';
+  }
+  fen[length++] = ' ';
+
+  // En passant square, as the square behind the pawn that can be taken
+  if (en_passant_square_x == -1) {
+    fen[length++] = '-';
+  } else {
+    fen[length++] = 'a' + en_passant_square_x;
+    fen[length++] = en_passant_square_y == 3 ? '3' : '6';
   }
-  // Copy the castling flags
-  new_board.black_king_castle = black_king_castle;
-  new_board.black_queen_castle = black_queen_castle;
-  new_board.white_king_castle = white_king_castle;
-  new_board.white_queen_castle = white_queen_castle;
-  // Copy the en passant square
-  new_board.en_passant_square_x = en_passant_square_x;
-  new_board.en_passant_square_y = en_passant_square_y;
-  // Copy the move counter
-  new_board.draw_move_counter = draw_move_counter;
-  // Copy the king locations
-  new_board.black_king_x = black_king_x;
-  new_board.black_king_y = black_king_y;
-  new_board.white_king_x = white_king_x;
-  new_board.white_king_y = white_king_y;
-  // Copy the 3-fold repetition vector 
-  new_board.three_fold_repetition_vector = three_fold_repetition_vector;
-  
-  return new_board;
+  fen[length++] = ' ';
+
+  // Halfmove clock, then the move number
+  if (draw_move_counter >= 100) {
+    fen[length++] = '0' + draw_move_counter / 100;
+  }
+  if (draw_move_counter >= 10) {
+    fen[length++] = '0' + draw_move_counter / 10 % 10;
+  }
+  fen[length++] = '0' + draw_move_counter % 10;
+  fen[length++] = ' ';
+  fen[length++] = '1';
+  fen[length] = '\0';
+  return length;
 }
 
 // when checking if a move is illegal due to checks, make sure to consider the path of king's castling
-void Board::remove_illegal_moves_for_a_piece(int8_t x, int8_t y, std::vector<std::pair<int8_t, int8_t>> &moves) {
-  bool piece_color = pieces[y][x]->get_color();
-
-  // If the piece is a king, check if the king is under check after the move
-  if (pieces[y][x]->get_type() == KING) {
-    // If king is under check, remove castling moves
-    if (under_check(piece_color)){
-      // Find move that changes king's position by 2
-      for (int8_t i = 0; i < moves.size(); i++) {
-        if (abs(moves[i].first%8 - x) == 2) {
-          moves.erase(moves.begin() + i);
-          i--;
-        }
+// Illegal moves are removed by moving the last move into their place, so the list doesn't have to shift (the order changes)
+void Board::remove_illegal_moves_for_a_piece(int8_t x, int8_t y, MoveList<> &moves) {
+  bool piece_color = code_color(squares[y * 8 + x]);
+
+  uint16_t i = 0;
+  while (i < moves.size()) {
+    Move move = moves[i];
+    bool illegal;
+    if (move_flags(move) & MOVE_CASTLE) {
+      // Can't castle out of check, or through a square that is under attack
+      illegal = under_check(piece_color);
+      if (!illegal) {
+        make_move(x, y, move_to(move) > move_from(move) ? x + 1 : x - 1, y, -1, -1);
+        illegal = under_check(piece_color);
+        unmake_move();
       }
+    } else {
+      illegal = false;
+    }
+    if (!illegal) {
+      // Make the move in place, check if the king is under check, then take the move back
+      make_move(move);
+      illegal = under_check(piece_color);
+      unmake_move();
+    }
+    if (illegal) {
+      moves.remove(i);
+    } else {
+      i++;
+    }
+  }
+}
+
+uint64_t Board::attackers_to(int8_t square, bool by_color, uint64_t occupancy) {
+  // Look from the square outwards: a piece attacks the square if the same piece standing on the square would attack it
+  // (pawns are the exception, so use the opposite color's pawn table)
+  uint64_t queens = piece_bitboards[by_color][QUEEN];
+  return (ATTACKS.pawn[!by_color][square] & piece_bitboards[by_color][PAWN])
+         | (ATTACKS.knight[square] & piece_bitboards[by_color][KNIGHT])
+         | (ATTACKS.king[square] & piece_bitboards[by_color][KING])
+         | (rook_attacks(square, occupancy) & (piece_bitboards[by_color][ROOK] | queens))
+         | (bishop_attacks(square, occupancy) & (piece_bitboards[by_color][BISHOP] | queens));
+}
+
+int16_t Board::generate_legal_moves(bool color, LegalMoveList &moves, uint64_t &checkers) {
+  /*
+    1. Find the pieces giving check. In double check only the king can move.
+       In single check, every other piece has to capture the checker or block it (check_mask)
+    2. Find our pieces that are pinned to the king, and the line each one has to stay on
+    3. Go through our pieces once, and only keep destinations that pass the masks
+       King moves check the destination with the king taken off the board (so it can't step back along a checking ray)
+       En passant is checked by removing both pawns and looking for a slider that now sees the king
+  */
+  moves.list.clear();
+
+  int8_t king_square = color == 0 ? white_king_y * 8 + white_king_x : black_king_y * 8 + black_king_x;
+  uint64_t own = color_bitboards[color];
+  uint64_t enemy = color_bitboards[!color];
+  uint64_t enemy_straight = piece_bitboards[!color][ROOK] | piece_bitboards[!color][QUEEN];
+  uint64_t enemy_diagonal = piece_bitboards[!color][BISHOP] | piece_bitboards[!color][QUEEN];
+
+  // 1. Checks
+  checkers = attackers_to(king_square, !color, occupied);
+  uint64_t check_mask = ~0ULL;  // squares a non-king move has to land on
+  if (checkers) {
+    if (checkers & (checkers - 1)) {
+      check_mask = 0;  // double check
+    } else {
+      check_mask = checkers | between_squares(king_square, lsb(checkers));
     }
-    // Remove "castling thru check"
-    // Find move that changes king's position by 1
-    for (int8_t i = 0; i < moves.size(); i++) {
-      // TODO: for efficiency, can check the "castle flag first"
-      if (abs(moves[i].first%8 - x) == 1 && moves[i].first/8 == y) {
-        // Now, copy new board, and check if king is under check after ONE move to left / right. Remove if it is, and remove subsequent castling moves
-        Board new_board = copy_board();
-        new_board.move_piece(x, y, moves[i].first%8, moves[i].first/8, moves[i].second%8, moves[i].second/8);
-        if (new_board.under_check(piece_color)) {
-          // Now, remove castling moves
-          for (int8_t j = 0; j < moves.size(); j++) {
-            if ((moves[j].first%8 - x) == 2 * (moves[i].first%8 - x)) {
-              moves.erase(moves.begin() + j);
-              j--;
-              if (j < i) i--;
+  }
+
+  // 2. Pins: enemy sliders that would see the king if our own pieces weren't there
+  uint64_t pinned = 0;
+  uint64_t pin_line[64];  // only valid for squares in pinned
+  uint64_t snipers = (rook_attacks(king_square, enemy) & enemy_straight) | (bishop_attacks(king_square, enemy) & enemy_diagonal);
+  while (snipers) {
+    int8_t sniper = pop_lsb(snipers);
+    uint64_t line = between_squares(king_square, sniper);
+    uint64_t blockers = line & occupied;
+    // Exactly one piece in between, and it's ours: it can only move along the line (or capture the sniper)
+    if (blockers && !(blockers & (blockers - 1)) && (blockers & own)) {
+      pinned |= blockers;
+      pin_line[lsb(blockers)] = line | square_bit(sniper);
+    }
+  }
+
+  // 3. Go through our pieces, in square order so the list comes out sorted by origin
+  int8_t forward = color == 0 ? 8 : -8;
+  int8_t next_square = 0;  // squares below this one already have their start index in moves.first
+  uint64_t remaining = own;
+  while (remaining) {
+    int8_t square = pop_lsb(remaining);
+    int8_t x = square % 8;
+    int8_t y = square / 8;
+    PieceType type = code_type(squares[square]);
+    uint64_t targets = 0;
+    // Flag added to every move in targets (pawns reaching the last row promote)
+    uint8_t flags = 0;
+
+    // Squares without one of our pieces have no moves
+    while (next_square <= square) {
+      moves.first[next_square++] = moves.list.size();
+    }
+
+    if (type == KING) {
+      // The king can go to any square that isn't attacked once it has left its current square
+      uint64_t king_targets = ATTACKS.king[square] & ~own;
+      uint64_t occupancy_without_king = occupied ^ square_bit(square);
+      while (king_targets) {
+        int8_t destination = pop_lsb(king_targets);
+        if (!attackers_to(destination, !color, occupancy_without_king)) {
+          targets |= square_bit(destination);
+        }
+      }
+      // Castling: not out of check, and not through or into an attacked square
+      if (!checkers) {
+        int8_t row = color == 0 ? 0 : 56;
+        bool king_castle = color == 0 ? white_king_castle : black_king_castle;
+        bool queen_castle = color == 0 ? white_queen_castle : black_queen_castle;
+        if (king_castle && (piece_bitboards[color][ROOK] & square_bit(row + 7)) && !(occupied & (square_bit(row + 5) | square_bit(row + 6)))
+            && !is_square_attacked(row + 5, !color) && !is_square_attacked(row + 6, !color)) {
+          moves.list.add(pack_move(square, row + 6, MOVE_CASTLE));
+        }
+        if (queen_castle && (piece_bitboards[color][ROOK] & square_bit(row)) && !(occupied & (square_bit(row + 1) | square_bit(row + 2) | square_bit(row + 3)))
+            && !is_square_attacked(row + 3, !color) && !is_square_attacked(row + 2, !color)) {
+          moves.list.add(pack_move(square, row + 2, MOVE_CASTLE));
+        }
+      }
+    } else if (check_mask) {
+      // Any other piece: has to deal with the check (if any) and stay on its pin line (if pinned)
+      uint64_t allowed = ~own & check_mask;
+      if (pinned & square_bit(square)) {
+        allowed &= pin_line[square];
+      }
+
+      if (type == QUEEN) {
+        targets = queen_attacks(square, occupied) & allowed;
+      } else if (type == BISHOP) {
+        targets = bishop_attacks(square, occupied) & allowed;
+      } else if (type == KNIGHT) {
+        targets = ATTACKS.knight[square] & allowed;
+      } else if (type == ROOK) {
+        targets = rook_attacks(square, occupied) & allowed;
+      } else if (type == PAWN) {
+        if (y == (color == 0 ? 6 : 1)) {
+          flags = MOVE_PROMOTION;
+        }
+        targets = ATTACKS.pawn[color][square] & enemy & allowed;
+        // Pushes: single push onto an empty square, double push from the starting row through two empty squares
+        if (!(occupied & square_bit(square + forward))) {
+          targets |= square_bit(square + forward) & allowed;
+          if (y == (color == 0 ? 1 : 6) && !(occupied & square_bit(square + 2 * forward))) {
+            targets |= square_bit(square + 2 * forward) & allowed;
+          }
+        }
+        // En passant: the enemy pawn that can be taken is right beside this pawn
+        if (en_passant_square_y == y && abs(en_passant_square_x - x) == 1) {
+          int8_t en_passant_square = en_passant_square_y * 8 + en_passant_square_x;
+          int8_t destination = en_passant_square + forward;
+          // Has to capture the checker or block the check, and must not uncover a slider on the king
+          // (both pawns leave the row at once, so the usual pin test can't see it)
+          if ((piece_bitboards[!color][PAWN] & square_bit(en_passant_square)) && (check_mask & (square_bit(destination) | square_bit(en_passant_square)))) {
+            uint64_t occupancy_after = (occupied ^ square_bit(square) ^ square_bit(en_passant_square)) | square_bit(destination);
+            if (!(rook_attacks(king_square, occupancy_after) & enemy_straight) && !(bishop_attacks(king_square, occupancy_after) & enemy_diagonal)) {
+              moves.list.add(pack_move(square, destination, MOVE_CAPTURE | MOVE_EN_PASSANT));
             }
           }
-          moves.erase(moves.begin() + i);
-          i--;
         }
       }
     }
-  }
-
-  // Loop through all possible moves
-  for (int8_t i = 0; i < moves.size(); i++) {
-    Board new_board = copy_board();
 
-    // Move the piece
-    new_board.move_piece(x, y, moves[i].first%8, moves[i].first/8, moves[i].second%8, moves[i].second/8);
-    
-    // Check if the king is under check
-    if (new_board.under_check(piece_color)) {
-      // If the king is under check, remove the move
-      moves.erase(moves.begin() + i);
-      i--;
+    while (targets) {
+      int8_t destination = pop_lsb(targets);
+      moves.list.add(pack_move(square, destination, (enemy & square_bit(destination)) ? (flags | MOVE_CAPTURE) : flags));
     }
-
   }
+  // Close off the remaining squares
+  while (next_square <= 64) {
+    moves.first[next_square++] = moves.list.size();
+  }
+  return moves.list.size();
 }
 
 // Give a pawn coordinate, check if it can promote
 bool Board::can_pawn_promote(int8_t x, int8_t y) {
   // Check if the piece is a pawn and if it's at the end of the board
-  if (pieces[y][x]->get_type() == PAWN) {
-    if (pieces[y][x]->get_color() == 0 && y == 7) {
+  if (code_type(squares[y * 8 + x]) == PAWN) {
+    if (code_color(squares[y * 8 + x]) == 0 && y == 7) {
       return true;
-    } else if (pieces[y][x]->get_color() == 1 && y == 0) {
+    } else if (code_color(squares[y * 8 + x]) == 1 && y == 0) {
       return true;
     }
   }
@@ -410,42 +773,76 @@ bool Board::can_pawn_promote(int8_t x, int8_t y) {
 
 void Board::promote_pawn(int8_t x, int8_t y, PieceType new_type) {
   // Promote a pawn
-  pieces[y][x]->type = new_type;
+  bool color = code_color(squares[y * 8 + x]);
+  clear_bitboard_square(y * 8 + x, PAWN, color);
+  set_bitboard_square(y * 8 + x, new_type, color);
+  squares[y * 8 + x] = square_code(new_type, color);
+  // move_piece already recorded the position with the pawn on this square, replace it with the promoted piece
+  repetition_history[repetition_index] = zobrist_hash;
 }
 
-// Constructor
-Board::Board() {
-  // Initialize a initial board
-  // Make all pieces:
-  // White pieces
-  pieces[0][0] = new Piece(ROOK, 0, 0, 0);
-  pieces[0][1] = new Piece(KNIGHT, 0, 1, 0);
-  pieces[0][2] = new Piece(BISHOP, 0, 2, 0);
-  pieces[0][3] = new Piece(QUEEN, 0, 3, 0);
-  pieces[0][4] = new Piece(KING, 0, 4, 0);
-  pieces[0][5] = new Piece(BISHOP, 0, 5, 0);
-  pieces[0][6] = new Piece(KNIGHT, 0, 6, 0);
-  pieces[0][7] = new Piece(ROOK, 0, 7, 0);
-  for (int8_t i = 0; i < 8; i++) {
-    pieces[1][i] = new Piece(PAWN, 0, i, 1);
-  }
-  // Empty pieces
-  for (int8_t i = 2; i < 6; i++) {
-    for (int8_t j = 0; j < 8; j++) {
-      pieces[i][j] = new Piece(EMPTY, 0, j, i);
+void Board::set_bitboard_square(int8_t square, PieceType type, bool color) {
+  uint64_t bit = square_bit(square);
+  piece_bitboards[color][type] |= bit;
+  color_bitboards[color] |= bit;
+  occupied |= bit;
+  zobrist_hash ^= ZOBRIST.piece[color][type][square];
+  piece_counts[color][type]++;
+  material[color] += PIECE_VALUE[type];
+}
+
+void Board::clear_bitboard_square(int8_t square, PieceType type, bool color) {
+  uint64_t bit = ~square_bit(square);
+  piece_bitboards[color][type] &= bit;
+  color_bitboards[color] &= bit;
+  occupied &= bit;
+  zobrist_hash ^= ZOBRIST.piece[color][type][square];
+  piece_counts[color][type]--;
+  material[color] -= PIECE_VALUE[type];
+}
+
+void Board::update_bitboards() {
+  // Clear every bitboard, count and the hash, then add each non-empty square back
+  memset(piece_bitboards, 0, sizeof(piece_bitboards));
+  memset(piece_counts, 0, sizeof(piece_counts));
+  material[0] = 0;
+  material[1] = 0;
+  color_bitboards[0] = 0;
+  color_bitboards[1] = 0;
+  occupied = 0;
+  zobrist_hash = 0;
+  for (int8_t square = 0; square < 64; square++) {
+    if (squares[square]) {
+      set_bitboard_square(square, code_type(squares[square]), code_color(squares[square]));
     }
   }
-  // Black pieces
-  pieces[7][0] = new Piece(ROOK, 1, 0, 7);
-  pieces[7][1] = new Piece(KNIGHT, 1, 1, 7);
-  pieces[7][2] = new Piece(BISHOP, 1, 2, 7);
-  pieces[7][3] = new Piece(QUEEN, 1, 3, 7);
-  pieces[7][4] = new Piece(KING, 1, 4, 7);
-  pieces[7][5] = new Piece(BISHOP, 1, 5, 7);
-  pieces[7][6] = new Piece(KNIGHT, 1, 6, 7);
-  pieces[7][7] = new Piece(ROOK, 1, 7, 7);
+  zobrist_hash ^= castling_and_en_passant_hash();
+  if (side_to_move) {
+    zobrist_hash ^= ZOBRIST.black_to_move;
+  }
+}
+
+uint64_t Board::castling_and_en_passant_hash() {
+  uint64_t hash = 0;
+  if (white_king_castle) hash ^= ZOBRIST.castling[0];
+  if (white_queen_castle) hash ^= ZOBRIST.castling[1];
+  if (black_king_castle) hash ^= ZOBRIST.castling[2];
+  if (black_queen_castle) hash ^= ZOBRIST.castling[3];
+  if (en_passant_square_x != -1) hash ^= ZOBRIST.en_passant[en_passant_square_x];
+  return hash;
+}
+
+void Board::reset() {
+  // Initialize a initial board
+  const PieceType back_row[8] = {ROOK, KNIGHT, BISHOP, QUEEN, KING, BISHOP, KNIGHT, ROOK};
+  memset(squares, 0, sizeof(squares));
   for (int8_t i = 0; i < 8; i++) {
-    pieces[6][i] = new Piece(PAWN, 1, i, 6);
+    // White pieces
+    squares[i] = square_code(back_row[i], 0);
+    squares[8 + i] = square_code(PAWN, 0);
+    // Black pieces
+    squares[48 + i] = square_code(PAWN, 1);
+    squares[56 + i] = square_code(back_row[i], 1);
   }
   // Initialize castling flags
   black_king_castle = true;
@@ -457,23 +854,29 @@ Board::Board() {
   en_passant_square_x = -1;
   en_passant_square_y = -1;
 
-  // Initialize move counter
+  // Initialize move counter, white moves first
   draw_move_counter = 0;
+  side_to_move = 0;
+
+  // Nothing to undo yet
+  undo_count = 0;
 
   // Initialize king locations
   white_king_x = 4;
   white_king_y = 0;
   black_king_x = 4;
   black_king_y = 7;
-  // TODO: add 3-fold repetition, and add initial board to the list, with count 1
-  update_three_fold_repetition_vector();
+
+  // Build the bitboards and the hash from the starting position
+  update_bitboards();
+
+  // The initial board is the first entry of the 3-fold repetition history
+  repetition_index = 0;
+  repetition_history[0] = zobrist_hash;
+  repetition_count = 1;
 }
 
-Board::~Board() {
-    // Free dynamically allocated pieces
-    for (int8_t i = 0; i < 8; i++) {
-        for (int8_t j = 0; j < 8; j++) {
-            delete pieces[i][j];  // Free each dynamically allocated Piece
-        }
-    }
-}
\ No newline at end of file
+// Constructor
+Board::Board() {
+  reset();
+}
@@ -5,6 +5,10 @@
 #include "Piece.h"
 // #include "ArduinoSTL.h"
 #include "PieceType.h"
+#include "Bitboard.h"
+#include "Zobrist.h"
+#include "Move.h"
+#include "Bitbase.h"
 #include <stdint.h>
 #include <vector>
 #include <utility>
@@ -12,12 +16,66 @@
 #include <Arduino.h>
 
 class Piece;
+
+// Maximum number of moves that can be made with make_move before they are undone
+#define MAX_UNDO_DEPTH 64
+
+// Number of position hashes kept for three-fold repetition (power of 2, must be more than the 50 move limit)
+#define REPETITION_HISTORY_SIZE 64
+
+// Longest FEN string to_fen can write, including the terminating null
+#define FEN_MAX_LENGTH 92
+
+// Everything make_move changes that unmake_move can't work out by itself
+struct UndoState {
+  // The move itself
+  int8_t x;
+  int8_t y;
+  int8_t new_x;
+  int8_t new_y;
+  int8_t capture_x;
+  int8_t capture_y;
+  // Type of the moving piece before the move (a pawn, if the move promoted it)
+  PieceType moved_type;
+  // The captured piece, if any
+  PieceType captured_type;
+  bool captured_color;
+  // Board state before the move
+  bool black_king_castle;
+  bool black_queen_castle;
+  bool white_king_castle;
+  bool white_queen_castle;
+  int8_t en_passant_square_x;
+  int8_t en_passant_square_y;
+  int8_t draw_move_counter;
+  int8_t black_king_x;
+  int8_t black_king_y;
+  int8_t white_king_x;
+  int8_t white_king_y;
+  uint64_t zobrist_hash;
+};
+
 // The Board Class
+// Everything is stored inline (no pointers, nothing allocated), so a Board can be a static/global variable
+// and copying one is a plain memcpy
 
 class Board {
   public:
-    // 8x8 array of pieces (point8_ter to a piece)
-    Piece* pieces[8][8];
+    // The 64 squares, index y*8 + x, each a one-byte code (see square_code in PieceType.h)
+    // Use piece_at to look at a square as a Piece
+    uint8_t squares[64];
+    // Bitboards, kept in sync with squares (bit y*8 + x is set if that square holds the piece)
+    // piece_bitboards[color][piece_type], the EMPTY entry is unused
+    uint64_t piece_bitboards[2][7];
+    // All pieces of one color (0 for white, 1 for black)
+    uint64_t color_bitboards[2];
+    // All pieces on the board
+    uint64_t occupied;
+    // Number of pieces of each type, piece_counts[color][piece_type] (the EMPTY entry is unused)
+    int8_t piece_counts[2][7];
+    // Total PIECE_VALUE of each color's pieces
+    int16_t material[2];
+    // (bitboards, counts and material are all updated by set_bitboard_square / clear_bitboard_square, so every move keeps them current)
     // Castling flags
     bool black_king_castle;
     bool black_queen_castle;
@@ -28,8 +86,17 @@ class Board {
     int8_t en_passant_square_y;
     // Move counter 
     int8_t draw_move_counter;
-    // Three-fold repetition (vector<vector<y*8 + x, piece_type>, number_of_occrurences>)
-    std::vector<std::pair<std::vector<std::pair<int8_t, int8_t>>, int8_t>> three_fold_repetition_vector;
+    // Side to move (0 for white, 1 for black), flips with every move
+    bool side_to_move;
+    // Zobrist hash of the position (pieces, side to move, castling flags, en passant), kept up to date by every board change
+    uint64_t zobrist_hash;
+    // Three-fold repetition: ring of the hashes of the positions after each move_piece
+    // Only the last draw_move_counter entries are looked at, since a pawn move or capture means nothing before it can repeat
+    uint64_t repetition_history[REPETITION_HISTORY_SIZE];
+    uint8_t repetition_index;  // where the current position's hash is stored
+    // Entries recorded since reset or from_fen, the current one included (up to REPETITION_HISTORY_SIZE): the ones
+    // before are from another game, even when a FEN's halfmove clock reaches back past its position
+    uint8_t repetition_count;
 
     // For ease of checking if a king is in check, we store the location of the kings
     // Black king location
@@ -39,41 +106,122 @@ class Board {
     int8_t white_king_x;
     int8_t white_king_y;
 
+    // Undo stack for make_move / unmake_move (undo_count entries are in use)
+    UndoState undo_stack[MAX_UNDO_DEPTH];
+    uint8_t undo_count;
+
     // Function that moves a piece
     // We are given the original x, original y, new x, new y, if capture happens, a "capture x" and "capture y"
     // In the end of the function, each individual piece's x and y should be updated
     // Also, the board array will reflect the new state of the board
-    // This function also updates the three_fold_repetition_vector -- if move will reset the 50-move counter, it will "destroy" the three_fold_repetition_vector (clear memory)
+    // This function also records the new position in the repetition_history
     void move_piece(int8_t x, int8_t y, int8_t new_x, int8_t new_y, int8_t capture_x, int8_t capture_y);
 
+    // Moves a piece and updates every board state (castling, en passant, king locations, move counter, side to move, bitboards, hash)
+    // Used by move_piece and make_move. Does not touch the repetition_history
+    void apply_move(int8_t x, int8_t y, int8_t new_x, int8_t new_y, int8_t capture_x, int8_t capture_y);
+
+    // Makes a move in place, and remembers what it changed on the undo stack so unmake_move can take it back
+    // If promotion is not EMPTY, the pawn is also promoted to that type
+    // Unlike move_piece, this does not update the repetition_history (meant for trying out moves, not playing them)
+    void make_move(int8_t x, int8_t y, int8_t new_x, int8_t new_y, int8_t capture_x, int8_t capture_y, PieceType promotion = EMPTY);
+
+    // Same, for a packed move (the promotion piece is not part of the move, pass it for moves with MOVE_PROMOTION)
+    void make_move(Move move, PieceType promotion = EMPTY);
+
+    // Plays a move of the game (a packed move, with its promotion piece): makes it and records the new position in the
+    // repetition_history like move_piece, nothing is kept on the undo stack
+    void play_move(Move move, PieceType promotion = EMPTY);
+
+    // Takes back the last move made with make_move
+    void unmake_move();
+
+    // Add / remove a piece of the given type and color on a square in the bitboards, counts, material and the hash (squares is not touched)
+    void set_bitboard_square(int8_t square, PieceType type, bool color);
+    void clear_bitboard_square(int8_t square, PieceType type, bool color);
+
+    // Rebuild all bitboards, counts, material and the zobrist hash from squares and the board state
+    void update_bitboards();
+
+    // Part of the zobrist hash that comes from the castling flags and the en passant square
+    uint64_t castling_and_en_passant_hash();
+
+    // Checks if the king of that color is attacked
     bool under_check(bool color);
 
-    std::vector<std::pair<int8_t, int8_t>> sources_of_check(bool color);
+    // Bitboard of the enemy pieces giving check to the king of that color (0 if not in check)
+    uint64_t sources_of_check(bool color);
+
+    // Checks if any piece of by_color attacks a square
+    // Looks outwards from the square (pawn, knight and king tables, then only the rays that have a slider of that color on them)
+    // and stops at the first attacker, so it costs a few table reads instead of generating the enemy's moves
+    bool is_square_attacked(int8_t square, bool by_color);
+
+    // Bitboard of every piece (both colors) that attacks a square
+    uint64_t attackers_of(int8_t square);
     
+    // The Board is trivially copyable, so this is just a memcpy, but of about 3.3 KB: the undo stack and the repetition
+    // ring come along with the position (the search never copies the board, it makes and unmakes moves on it)
     Board copy_board();
 
-    void remove_illegal_moves_for_a_piece(int8_t x, int8_t y, std::vector<std::pair<int8_t, int8_t>> &moves);
+    // The piece on a square, as a Piece (a copy, changing it doesn't change the board)
+    // An empty square gives a Piece of type EMPTY
+    Piece piece_at(int8_t x, int8_t y) const;
+
+    // Puts a piece on a square (or empties it with EMPTY), keeping the bitboards, the hash and the king locations up to date
+    // This is not a move: castling flags, en passant and the move counter are not touched
+    void set_square(int8_t x, int8_t y, PieceType type, bool color);
+
+    // Sets up the starting position, and clears the undo stack and the repetition history
+    void reset();
+
+    // Sets up the position of a FEN string, e.g. "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+    // Fills pieces, castling flags, en passant square, draw_move_counter, king locations, side to move, bitboards and hash
+    // in one pass over the string (nothing is allocated). The undo stack and repetition history are reset
+    // The move number field is optional and ignored, the board doesn't keep one
+    // Returns false if the string is not a valid FEN (the board is then left in an undefined state)
+    bool from_fen(const char* fen);
+
+    // Writes the current position as a null terminated FEN string into fen (at least FEN_MAX_LENGTH chars)
+    // The move number is always written as 1
+    // Returns the length of the string
+    uint8_t to_fen(char* fen);
+
+    // Removes the moves of the piece on (x, y) that would leave its king in check (tries each one with make_move / unmake_move)
+    void remove_illegal_moves_for_a_piece(int8_t x, int8_t y, MoveList<> &moves);
+
+    // Bitboard of the pieces of by_color that attack a square, given an occupancy (so pieces can be moved out of the way)
+    uint64_t attackers_to(int8_t square, bool by_color, uint64_t occupancy);
+
+    // Generates every legal move of one side in a single pass, without trying any move out
+    // Pins, checks (including double check), castling through check and en passant discovered checks are all handled here
+    // moves is filled with every legal move sorted by origin square, moves.first[s] is where the moves of the piece on square s start
+    // Squares without a piece of that color have no moves. Nothing is allocated
+    // checkers is set to the bitboard of enemy pieces giving check (0 if the king is not in check)
+    // Returns the total number of legal moves (0 means checkmate or stalemate)
+    int16_t generate_legal_moves(bool color, LegalMoveList &moves, uint64_t &checkers);
 
     bool can_pawn_promote(int8_t x, int8_t y);
 
     void promote_pawn(int8_t x, int8_t y, PieceType new_type);
 
     // Three-fold repetition updator, to be called at the end of move_piece()
-    // Copies current board state into one instance of the "sub-vector" of three_fold_repetition_vector std::vector<std::pair<int8_t, int8_t>>
-    // It checks over the three_fold_repetition_vector to see if the current board state is already in the vector, if so, its count++
-    // If not, it adds the current board state to the vector with count 1
-    void update_three_fold_repetition_vector();
+    // Stores the current hash in the next slot of the repetition_history ring (nothing is allocated)
+    void update_repetition_history();
 
-    // Checks the three_fold_repetition_vector to see if the current board state is already in the vector with count 3, if so, returns true
+    // Checks if the current position has appeared three times since the last pawn move or capture
+    // Compares the current hash with every second entry (same side to move) of the last draw_move_counter positions
     bool is_three_fold_repetition();
     
-    // Checks if the game is a draw due to insufficient material
+    // Checks if the game is a draw due to insufficient material (O(1), from piece_counts)
     bool is_insufficient_material();
 
-    // Constructor
-    Board();
+    // Looks up KPK, KRK and KQK positions in the endgame bitbases (Bitbase.h)
+    // Returns BITBASE_WIN / BITBASE_DRAW / BITBASE_LOSS for the side to move, BITBASE_NOT_FOUND for any other position
+    int8_t probe_bitbase();
 
-    ~Board();
+    // Constructor, starts with the starting position (see reset)
+    Board();
 
 };
 
@@ -0,0 +1,4 @@
+#include "LedMap.h"
+
+// Define the LED table (computed at compile time)
+constexpr LedMap LED_MAP;
@@ -0,0 +1,64 @@
+// LedMap.h file
+
+#ifndef LED_MAP_H
+#define LED_MAP_H
+#include <stdint.h>
+
+// Where each LED of the board is on the strips. Every square has 4x4 LEDs, (u, v) inside the square with u along x;
+// square is y*8 + x like the bitboards.
+// The strips snake along the rows of LEDs (every other row of LEDs runs backwards) and the board is wired 180 degrees
+// rotated relative to the motors. The first three strips hold 256 LEDs each, the 4th block of 256 is split in a
+// 160 LED strip and a 96 LED one (hardware limitation), so an LED from index 928 on is on strip 4.
+
+#define LED_SQUARE_SIDE 4
+#define LED_SQUARE_COUNT (LED_SQUARE_SIDE * LED_SQUARE_SIDE)
+#define LED_BOARD_STRIPS 5
+
+struct LedAddress {
+  uint8_t strip;
+  uint8_t index;
+};
+
+// Computed at compile time, so the table lives in flash on the ESP32 (2 KB)
+struct LedMap {
+  // led[square][v * LED_SQUARE_SIDE + u]
+  LedAddress led[64][LED_SQUARE_COUNT];
+
+  constexpr LedMap() : led() {
+    // LEDs in a row of the board, in a row of a square
+    const int16_t row_leds = 8 * LED_SQUARE_SIDE;
+    const int16_t board_row_leds = row_leds * LED_SQUARE_SIDE;
+    for (int8_t y = 0; y < 8; y++) {
+      for (int8_t x = 0; x < 8; x++) {
+        for (int8_t v = 0; v < LED_SQUARE_SIDE; v++) {
+          for (int8_t u = 0; u < LED_SQUARE_SIDE; u++) {
+            // 180 degree rotation
+            int16_t wired_x = 7 - x;
+            int16_t wired_y = 7 - y;
+            int16_t wired_u = LED_SQUARE_SIDE - 1 - u;
+            int16_t wired_v = LED_SQUARE_SIDE - 1 - v;
+            int16_t index = 0;
+            if (wired_v % 2 == 0) {
+              index = wired_u + row_leds * wired_v + LED_SQUARE_SIDE * wired_x + board_row_leds * (7 - wired_y);
+            } else {
+              index = -wired_u + row_leds * (wired_v + 1) - LED_SQUARE_SIDE * wired_x +
+                      board_row_leds * (7 - wired_y) - 1;
+            }
+            LedAddress &address = led[y * 8 + x][v * LED_SQUARE_SIDE + u];
+            if (index < 928) {
+              address.strip = index / 256;
+              address.index = index % 256;
+            } else {
+              address.strip = 4;
+              address.index = index - 928;
+            }
+          }
+        }
+      }
+    }
+  }
+};
+
+extern const LedMap LED_MAP;
+
+#endif
@@ -0,0 +1,197 @@
+#include "MotionScheduler.h"
+#include "Board.h"
+#include "Piece.h"
+#include "PieceType.h"
+#include "MotorQueue.h"
+#include "ResetPlanner.h"
+#include "PathRouter.h"
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include <utility>
+#include <Arduino.h>
+
+static void square_mm(int8_t x, int8_t y, float &mm_x, float &mm_y) {
+  mm_x = x * RESET_MM_PER_SQUARE;
+  if (x < 0) {
+    mm_x -= RESET_GRAVEYARD_GAP;
+  } else if (x > 7) {
+    mm_x += RESET_GRAVEYARD_GAP;
+  }
+  mm_y = y * RESET_MM_PER_SQUARE;
+}
+
+MotionScheduler::MotionScheduler() {
+  head_x_mm = RESET_CALIBRATE_X_MM;
+  head_y_mm = RESET_CALIBRATE_Y_MM;
+  clear();
+}
+
+void MotionScheduler::clear() {
+  count = 0;
+}
+
+int8_t MotionScheduler::add(int8_t x0, int8_t y0, int8_t x1, int8_t y1, uint8_t mode, int8_t after) {
+  if (count >= MOTION_MAX_STEPS) {
+    return -1;
+  }
+  steps[count] = {{x0, y0, x1, y1, mode}, after};
+  return count++;
+}
+
+// Tries every order that keeps to the steps' after (at most MOTION_MAX_STEPS! orders)
+static void plan_from(const MotionScheduler &motion, uint8_t* order, uint8_t placed, uint8_t done, float x, float y,
+                      float travel_mm, uint8_t* best_order, float &best_mm) {
+  if (travel_mm >= best_mm) {
+    return;
+  }
+  if (placed == motion.count) {
+    travel_mm += hypotf(RESET_CALIBRATE_X_MM - x, RESET_CALIBRATE_Y_MM - y);
+    if (travel_mm < best_mm) {
+      best_mm = travel_mm;
+      for (uint8_t i = 0; i < motion.count; i++) {
+        best_order[i] = order[i];
+      }
+    }
+    return;
+  }
+  for (uint8_t i = 0; i < motion.count; i++) {
+    const MotionStep &step = motion.steps[i];
+    if ((done & (1 << i)) || (step.after >= 0 && !(done & (1 << step.after)))) {
+      continue;
+    }
+    float start_x, start_y, end_x, end_y;
+    square_mm(step.segment.x0, step.segment.y0, start_x, start_y);
+    square_mm(step.segment.x1, step.segment.y1, end_x, end_y);
+    order[placed] = i;
+    plan_from(motion, order, placed + 1, done | (1 << i), end_x, end_y, travel_mm + hypotf(start_x - x, start_y - y),
+              best_order, best_mm);
+  }
+}
+
+float MotionScheduler::plan(uint8_t* order) const {
+  uint8_t trying[MOTION_MAX_STEPS];
+  float best_mm = INFINITY;
+  plan_from(*this, trying, 0, 0, head_x_mm, head_y_mm, 0, order, best_mm);
+  return best_mm;
+}
+
+void MotionScheduler::moved(const MotorSegment &segment) {
+  if (segment.mode == MOTOR_MODE_WAYPOINT) {
+    return;
+  }
+  if (segment.mode == MOTOR_MODE_CALIBRATE) {
+    head_x_mm = RESET_CALIBRATE_X_MM;
+    head_y_mm = RESET_CALIBRATE_Y_MM;
+    return;
+  }
+  square_mm(segment.x1, segment.y1, head_x_mm, head_y_mm);
+}
+
+// graveyard_square's kind of a piece type (1 queen to 5 pawn)
+static int8_t graveyard_kind(PieceType type) {
+  return type == QUEEN ? 1 : type == ROOK ? 2 : type == BISHOP ? 3 : type == KNIGHT ? 4 : 5;
+}
+
+static int8_t add_to_graveyard(MotionScheduler &motion, int8_t x, int8_t y, int8_t kind, bool color, int8_t count,
+                               int8_t after) {
+  std::pair<int8_t, int8_t> slot = graveyard_square(kind, color, count);
+  return motion.add(x, y, slot.first, slot.second, MOTOR_MODE_TAXICAB, after);
+}
+
+// The promoted pawn's temp piece goes back to its column, then the captured piece takes its place
+// Returns the step of the captured piece
+static int8_t add_replacement(MotionScheduler &motion, int8_t pawn_x, int8_t pawn_y, int8_t capture_x,
+                              int8_t capture_y, bool color, int8_t temp_count) {
+  int8_t temp = add_to_graveyard(motion, pawn_x, pawn_y, 6, color, temp_count, -1);
+  return motion.add(capture_x, capture_y, pawn_x, pawn_y, MOTOR_MODE_TAXICAB, temp);
+}
+
+// The moving piece (knights along the square edges), then the rook if the king castles: the king slides over the
+// rook's new square, so the rook goes around it afterwards
+static void add_moving_piece(MotionScheduler &motion, Piece piece, int8_t x, int8_t y, int8_t new_x, int8_t new_y,
+                             int8_t after) {
+  int8_t step = motion.add(x, y, new_x, new_y, piece.get_type() == KNIGHT ? MOTOR_MODE_TAXICAB : MOTOR_MODE_DIRECT,
+                           after);
+  if (piece.get_type() == KING && abs(new_x - x) == 2) {
+    motion.add(new_x > x ? 7 : 0, y, (x + new_x) / 2, y, MOTOR_MODE_TAXICAB, step);
+  }
+}
+
+void motion_add_move(MotionScheduler &motion, const Board &board, int8_t* graveyard,
+                     std::vector<std::pair<int8_t, int8_t>> &temp_pieces, int8_t x, int8_t y, int8_t new_x,
+                     int8_t new_y, int8_t capture_x, int8_t capture_y) {
+  motion.occupancy = occupancy_of(board, graveyard);
+  Piece piece = board.piece_at(x, y);
+  // Step that empties the destination (en passant captures next to it)
+  int8_t emptied = -1;
+  if (capture_x != -1) {
+    Piece captured = board.piece_at(capture_x, capture_y);
+    bool color = captured.get_color();
+    int8_t temp = -1;
+    int8_t replaced = -1;
+    float replaced_mm = INFINITY;
+    for (uint8_t i = 0; i < temp_pieces.size(); i++) {
+      int8_t pawn_x = temp_pieces[i].first;
+      int8_t pawn_y = temp_pieces[i].second;
+      if (pawn_x == capture_x && pawn_y == capture_y) {
+        temp = i;
+        break;
+      }
+      Piece pawn = board.piece_at(pawn_x, pawn_y);
+      if (pawn.get_color() == color && pawn.get_type() == captured.get_type()) {
+        // Any of them can be replaced, try the whole move with each
+        MotionScheduler trial = motion;
+        int8_t step = add_replacement(trial, pawn_x, pawn_y, capture_x, capture_y, color, graveyard[10 + color]);
+        add_moving_piece(trial, piece, x, y, new_x, new_y, step);
+        uint8_t order[MOTION_MAX_STEPS];
+        float travel_mm = trial.plan(order);
+        if (travel_mm < replaced_mm) {
+          replaced = i;
+          replaced_mm = travel_mm;
+        }
+      }
+    }
+
+    int8_t step;
+    if (temp >= 0) {
+      step = add_to_graveyard(motion, capture_x, capture_y, 6, color, graveyard[10 + color]++, -1);
+      temp_pieces.erase(temp_pieces.begin() + temp);
+    } else if (replaced >= 0) {
+      step = add_replacement(motion, temp_pieces[replaced].first, temp_pieces[replaced].second, capture_x, capture_y,
+                             color, graveyard[10 + color]++);
+      // Replaced, the pawn is a regular piece now
+      temp_pieces.erase(temp_pieces.begin() + replaced);
+    } else {
+      int8_t kind = graveyard_kind(captured.get_type());
+      step = add_to_graveyard(motion, capture_x, capture_y, kind, color, graveyard[kind - 1 + 5 * color]++, -1);
+    }
+    if (capture_x == new_x && capture_y == new_y) {
+      emptied = step;
+    }
+  }
+
+  // A temp piece that moves keeps standing in for its promoted pawn
+  for (uint8_t i = 0; i < temp_pieces.size(); i++) {
+    if (temp_pieces[i].first == x && temp_pieces[i].second == y) {
+      temp_pieces[i] = std::make_pair(new_x, new_y);
+      break;
+    }
+  }
+  add_moving_piece(motion, piece, x, y, new_x, new_y, emptied);
+}
+
+void motion_add_promotion(MotionScheduler &motion, const Board &board, PieceType type, bool color, int8_t* graveyard,
+                          std::vector<std::pair<int8_t, int8_t>> &temp_pieces, int8_t x, int8_t y) {
+  motion.occupancy = occupancy_of(board, graveyard);
+  int8_t pawn = add_to_graveyard(motion, x, y, 5, color, graveyard[4 + 5 * color]++, -1);
+  int8_t index = graveyard_kind(type) - 1 + 5 * color;
+  std::pair<int8_t, int8_t> slot;
+  if (graveyard[index] > 0) {
+    slot = graveyard_square(graveyard_kind(type), color, --graveyard[index]);
+  } else {
+    slot = graveyard_square(6, color, --graveyard[10 + color]);
+    temp_pieces.push_back(std::make_pair(x, y));
+  }
+  motion.add(slot.first, slot.second, x, y, MOTOR_MODE_TAXICAB, pawn);
+}
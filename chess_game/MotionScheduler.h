@@ -0,0 +1,77 @@
+// MotionScheduler.h file
+
+#ifndef MOTION_SCHEDULER_H
+#define MOTION_SCHEDULER_H
+#include "Board.h"
+#include "PieceType.h"
+#include "MotorQueue.h"
+#include "ResetPlanner.h"
+#include "PathRouter.h"
+#include <stdint.h>
+#include <vector>
+#include <utility>
+#include <Arduino.h>
+
+// Orders the gantry moves of one chess move (GAME_MOVE_MOTOR: capture, move, castling rook; the promotion swap) from
+// where the gantry is, instead of always starting from the calibration corner
+//
+// Every segment sent goes through moved, so the scheduler knows where the gantry stopped. A move's steps are added
+// with the step that has to run before them (the piece on the destination has to leave first, the king slides over
+// the square the rook goes to), and plan picks the order with the least empty travel among the ones that keep to it.
+// The gantry still calibrates after every turn (GAME_END_TURN), so the trip back to the corner counts in the plan.
+// The steps are queued through route_segment, which carries each piece around the others (PathRouter.h).
+
+#define MOTION_MAX_STEPS 4
+
+// A segment, and the index of the step that has to run before it (-1 if none)
+struct MotionStep {
+  MotorSegment segment;
+  int8_t after;
+};
+
+class MotionScheduler {
+  public:
+    // Where the gantry is once the segments sent so far are done (mm, like ResetPlanner.h)
+    float head_x_mm;
+    float head_y_mm;
+    // Pieces on the board and in the graveyards before the steps, set by motion_add_move / motion_add_promotion
+    // (route_segment keeps it up to date while the steps are queued)
+    Occupancy occupancy;
+
+    MotionStep steps[MOTION_MAX_STEPS];
+    uint8_t count;
+
+    // At the calibration corner, as after GAME_POWER_ON
+    MotionScheduler();
+
+    // Forgets the steps (not the gantry position)
+    void clear();
+
+    // Adds a step, returns its index (-1 if there are MOTION_MAX_STEPS already)
+    int8_t add(int8_t x0, int8_t y0, int8_t x1, int8_t y1, uint8_t mode, int8_t after = -1);
+
+    // Writes the order of the steps with the least empty travel into order (count indices), returns that travel in mm
+    // (up to the calibration corner)
+    float plan(uint8_t* order) const;
+
+    // A segment was sent: the gantry ends on its end square, or at the corner after a calibration (waypoints are
+    // part of the move after them)
+    void moved(const MotorSegment &segment);
+};
+
+// Adds the steps of the move (x, y) to (new_x, new_y) of the piece on the board, capturing on (capture_x, capture_y)
+// (-1 if none), and updates graveyard (chess_game.ino's graveyard[]) and temp_pieces to what they will be:
+// a captured temp piece goes back to its column, a captured piece of the kind of a promoted pawn takes the pawn's place
+// (the one that makes the shortest plan, its temp piece goes back), any other captured piece goes to the graveyard
+// board: before the move
+void motion_add_move(MotionScheduler &motion, const Board &board, int8_t* graveyard,
+                     std::vector<std::pair<int8_t, int8_t>> &temp_pieces, int8_t x, int8_t y, int8_t new_x,
+                     int8_t new_y, int8_t capture_x, int8_t capture_y);
+
+// Adds the steps of the promotion of the pawn on (x, y) to type: the pawn to the graveyard, then a piece of that type
+// from the graveyard, or a temp piece (added to temp_pieces) if there is none
+// board: after the move
+void motion_add_promotion(MotionScheduler &motion, const Board &board, PieceType type, bool color, int8_t* graveyard,
+                          std::vector<std::pair<int8_t, int8_t>> &temp_pieces, int8_t x, int8_t y);
+
+#endif
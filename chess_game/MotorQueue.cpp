@@ -0,0 +1,51 @@
+#include "MotorQueue.h"
+#include <stdint.h>
+#include <Arduino.h>
+
+MotorQueue::MotorQueue() {
+  clear();
+}
+
+void MotorQueue::clear() {
+  count = 0;
+}
+
+bool MotorQueue::add(int8_t x0, int8_t y0, int8_t x1, int8_t y1, uint8_t mode) {
+  if (count >= MOTOR_QUEUE_SIZE) {
+    return false;
+  }
+  segments[count++] = {x0, y0, x1, y1, mode};
+  return true;
+}
+
+uint8_t MotorQueue::pack(uint8_t first, uint8_t* buffer) const {
+  if (first >= count) {
+    return 0;
+  }
+  uint8_t batch = count - first < MOTOR_QUEUE_MAX_BATCH ? count - first : MOTOR_QUEUE_MAX_BATCH;
+  uint8_t length = 0;
+  buffer[length++] = batch;
+  for (uint8_t i = first; i < first + batch; i++) {
+    // +3 to shift x into positive range
+    buffer[length++] = (segments[i].y0 << 4) | (segments[i].x0 + 3);
+    buffer[length++] = (segments[i].y1 << 4) | (segments[i].x1 + 3);
+    buffer[length++] = segments[i].mode;
+  }
+  return length;
+}
+
+uint8_t motor_unpack(const uint8_t* buffer, uint8_t length, MotorSegment* segments) {
+  if (length < 1 || buffer[0] == 0 || buffer[0] > MOTOR_QUEUE_MAX_BATCH ||
+      length != 1 + buffer[0] * MOTOR_QUEUE_SEGMENT_BYTES) {
+    return 0;
+  }
+  for (uint8_t i = 0; i < buffer[0]; i++) {
+    const uint8_t* bytes = buffer + 1 + i * MOTOR_QUEUE_SEGMENT_BYTES;
+    segments[i].x0 = (bytes[0] & 0x0F) - 3;
+    segments[i].y0 = bytes[0] >> 4;
+    segments[i].x1 = (bytes[1] & 0x0F) - 3;
+    segments[i].y1 = bytes[1] >> 4;
+    segments[i].mode = bytes[2];
+  }
+  return buffer[0];
+}
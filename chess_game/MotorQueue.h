@@ -0,0 +1,61 @@
+// MotorQueue.h file
+
+#ifndef MOTOR_QUEUE_H
+#define MOTOR_QUEUE_H
+#include <stdint.h>
+#include <Arduino.h>
+
+// Queue of gantry moves for the Arduino Mega subordinate (arduino_subordinate.ino), sent in a few I2C transactions
+// instead of one transaction and a completion poll per move
+//
+// Transaction: segment count, then 3 bytes per segment (the same bytes motor_i2c used to send for one move):
+//   (y0 << 4) | (x0 + 3), (y1 << 4) | (x1 + 3), motor_mode
+// The subordinate appends the segments to its own queue (MOTOR_QUEUE_SIZE segments) and runs them back to back,
+// pulling its done line low while it has any and back high once the last one is finished
+//
+// MOTOR_QUEUE_SIZE has to match the subordinate's queue, so a full queue always fits there
+
+#define MOTOR_QUEUE_SIZE 32
+// Segments per transaction: the AVR Wire library buffers 32 bytes (1 + 10 * 3 = 31)
+#define MOTOR_QUEUE_MAX_BATCH 10
+#define MOTOR_QUEUE_SEGMENT_BYTES 3
+
+// Motor modes
+#define MOTOR_MODE_DIRECT 0     // one straight line from the start to the end square, both axes together
+#define MOTOR_MODE_TAXICAB 1    // along the edges of the squares, for pieces that can't pass over others
+#define MOTOR_MODE_CALIBRATE 2  // home against the limit switches (squares ignored)
+#define MOTOR_MODE_WAYPOINT 3   // a point the next move goes through (PathRouter.h): (x0, y0) and, if x1 / y1 is 1,
+                                // half a square further on that axis. The subordinate keeps them until the move
+
+// One move of a piece (or a calibration), x is -3 to 10 (the graveyards are outside 0 to 7), y is 0 to 7
+struct MotorSegment {
+  int8_t x0;
+  int8_t y0;
+  int8_t x1;
+  int8_t y1;
+  uint8_t mode;
+};
+
+class MotorQueue {
+  public:
+    MotorSegment segments[MOTOR_QUEUE_SIZE];
+    uint8_t count;
+
+    MotorQueue();
+
+    // Forgets every segment
+    void clear();
+
+    // Adds a segment, returns false if the queue is full (send it first)
+    bool add(int8_t x0, int8_t y0, int8_t x1, int8_t y1, uint8_t mode);
+
+    // Writes the transaction of up to MOTOR_QUEUE_MAX_BATCH segments starting at first into buffer
+    // (at least 1 + MOTOR_QUEUE_MAX_BATCH * 3 bytes), returns its length in bytes (0 if there are no segments left)
+    uint8_t pack(uint8_t first, uint8_t* buffer) const;
+};
+
+// Reads the segments of a transaction back (for the host simulator, the subordinate has its own copy)
+// Returns the number of segments, 0 if the transaction isn't valid
+uint8_t motor_unpack(const uint8_t* buffer, uint8_t length, MotorSegment* segments);
+
+#endif
@@ -0,0 +1,99 @@
+// Move.h file
+
+#ifndef MOVE_H
+#define MOVE_H
+#include <stdint.h>
+
+// A move packed into 16 bits:
+//   bits 0-5   origin square (y*8 + x, same as the bitboards)
+//   bits 6-11  destination square
+//   bits 12-15 flags (below)
+// The capture square isn't stored, it is the destination, or for en passant the square beside the origin (see move_capture_square)
+// Like the 14-bit moves the Pi sends (see pi_return_to_from_square), the promotion piece is not part of the move: a move with
+// MOVE_PROMOTION is one move, and the piece is picked when it's made
+typedef uint16_t Move;
+
+// Move flags
+#define MOVE_CAPTURE 0x1     // takes a piece
+#define MOVE_EN_PASSANT 0x2  // takes a pawn en passant (MOVE_CAPTURE is set too)
+#define MOVE_CASTLE 0x4      // king moves two squares, the rook is moved by move_piece / make_move
+#define MOVE_PROMOTION 0x8   // pawn reaches the last row
+
+// Room for any position (the most legal moves known in a position is 218)
+#define MAX_MOVES 256
+
+inline Move pack_move(int8_t from, int8_t to, uint8_t flags) {
+  return from | (to << 6) | (flags << 12);
+}
+
+inline int8_t move_from(Move move) {
+  return move & 0x3F;
+}
+
+inline int8_t move_to(Move move) {
+  return (move >> 6) & 0x3F;
+}
+
+inline uint8_t move_flags(Move move) {
+  return move >> 12;
+}
+
+// Square of the captured piece, -1 if the move doesn't capture
+inline int8_t move_capture_square(Move move) {
+  if (!(move_flags(move) & MOVE_CAPTURE)) {
+    return -1;
+  }
+  if (move_flags(move) & MOVE_EN_PASSANT) {
+    // The pawn taken en passant is on the origin's row, in the destination's column
+    return (move_from(move) & 0x38) | (move_to(move) & 0x07);
+  }
+  return move_to(move);
+}
+
+// Fixed-capacity list of moves. Lives wherever it is declared (stack, global), nothing is allocated
+template <uint16_t CAPACITY = MAX_MOVES>
+class MoveList {
+  public:
+    Move moves[CAPACITY];
+    uint16_t count;
+
+    MoveList() : count(0) {}
+
+    void clear() {
+      count = 0;
+    }
+
+    void add(Move move) {
+      moves[count++] = move;
+    }
+
+    // Removes a move by moving the last move into its place (the order of the list is not kept)
+    void remove(uint16_t i) {
+      moves[i] = moves[--count];
+    }
+
+    uint16_t size() const {
+      return count;
+    }
+
+    Move operator[](uint16_t i) const {
+      return moves[i];
+    }
+};
+
+// The legal moves of one side as a single flat list, sorted by origin square (filled by Board::generate_legal_moves)
+// The moves of the piece on square s are list[first[s]] up to, not including, list[first[s + 1]]
+struct LegalMoveList {
+  MoveList<> list;
+  uint8_t first[65];  // fits, since there are never more than 218 legal moves
+
+  uint8_t count_from(int8_t square) const {
+    return first[square + 1] - first[square];
+  }
+
+  Move from(int8_t square, uint8_t i) const {
+    return list.moves[first[square] + i];
+  }
+};
+
+#endif
@@ -0,0 +1,59 @@
+#include "OledRegions.h"
+#include <stdint.h>
+
+// FNV-1a
+static uint32_t chunk_hash(const uint8_t* data) {
+  uint32_t hash = 2166136261u;
+  for (uint8_t i = 0; i < OLED_CHUNK_COLUMNS; i++) {
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+void oled_invalidate(OledScreen &screen) {
+  screen.valid = false;
+}
+
+uint8_t oled_changed_regions(OledScreen &screen, const uint8_t* buffer, OledRegion* regions) {
+  uint8_t count = 0;
+  for (uint8_t page = 0; page < OLED_PAGES; page++) {
+    int8_t first = -1;
+    int8_t last = -1;
+    for (uint8_t chunk = 0; chunk < OLED_CHUNKS; chunk++) {
+      uint32_t hash = chunk_hash(buffer + page * OLED_COLUMNS + chunk * OLED_CHUNK_COLUMNS);
+      if (!screen.valid || hash != screen.hash[page][chunk]) {
+        screen.hash[page][chunk] = hash;
+        if (first < 0) {
+          first = chunk;
+        }
+        last = chunk;
+      }
+    }
+    if (first < 0) {
+      continue;
+    }
+    uint8_t first_column = first * OLED_CHUNK_COLUMNS;
+    uint8_t last_column = (last + 1) * OLED_CHUNK_COLUMNS - 1;
+    OledRegion* previous = count > 0 ? &regions[count - 1] : nullptr;
+    if (previous && previous->last_page == page - 1 && previous->first_column == first_column &&
+        previous->last_column == last_column) {
+      previous->last_page = page;
+    } else {
+      regions[count++] = {page, page, first_column, last_column};
+    }
+  }
+  screen.valid = true;
+
+  for (uint8_t i = 0; i < count; i++) {
+    screen.bytes_sent += oled_region_bytes(regions[i]);
+  }
+  screen.bytes_full += oled_region_bytes({0, OLED_PAGES - 1, 0, OLED_COLUMNS - 1});
+  return count;
+}
+
+uint16_t oled_region_bytes(const OledRegion &region) {
+  uint16_t data = (region.last_page - region.first_page + 1) * (region.last_column - region.first_column + 1);
+  uint16_t transactions = (data + OLED_WIRE_MAX - 2) / (OLED_WIRE_MAX - 1);
+  // Address and control byte, then column start and end, page start and end (with their commands)
+  return 8 + data + 2 * transactions;
+}
@@ -0,0 +1,50 @@
+// OledRegions.h file
+
+#ifndef OLED_REGIONS_H
+#define OLED_REGIONS_H
+#include <stdint.h>
+
+// Which parts of a 128x64 SSD1306 screen changed since it was last sent, so only those go over the I2C bus (shared with
+// the motor subordinate) instead of the whole 1 KB buffer on every update
+//
+// The buffer is 8 pages (rows of 8 pixels) of 128 columns, one byte per column. Each page is split in chunks of
+// OLED_CHUNK_COLUMNS columns, and a screen keeps a hash of every chunk as it was sent (256 bytes instead of a copy of
+// the buffer). The changed chunks of a page make a column range, and pages next to each other with the same range are
+// sent as one rectangle through the SSD1306's column and page address window.
+
+#define OLED_COLUMNS 128
+#define OLED_PAGES 8
+#define OLED_CHUNK_COLUMNS 16
+#define OLED_CHUNKS (OLED_COLUMNS / OLED_CHUNK_COLUMNS)
+// Bytes per I2C transaction (Wire's buffer: 128 on the ESP32, like Adafruit_SSD1306 uses)
+#ifndef OLED_WIRE_MAX
+#define OLED_WIRE_MAX 128
+#endif
+
+struct OledRegion {
+  uint8_t first_page;
+  uint8_t last_page;
+  uint8_t first_column;
+  uint8_t last_column;
+};
+
+struct OledScreen {
+  uint32_t hash[OLED_PAGES][OLED_CHUNKS];
+  // False until the first update, and after anything changed the screen's RAM behind our back (scrolling)
+  bool valid;
+  // Bytes put on the bus (address bytes included), and what sending the whole buffer every time would have taken
+  uint32_t bytes_sent;
+  uint32_t bytes_full;
+};
+
+// The next update sends the whole screen
+void oled_invalidate(OledScreen &screen);
+
+// Writes the regions of buffer (OLED_PAGES * OLED_COLUMNS bytes) that changed since the last update into regions
+// (OLED_PAGES at most), returns how many, and counts them as sent
+uint8_t oled_changed_regions(OledScreen &screen, const uint8_t* buffer, OledRegion* regions);
+
+// Bytes on the bus to send a region: the address window (one transaction), then the data in OLED_WIRE_MAX transactions
+uint16_t oled_region_bytes(const OledRegion &region);
+
+#endif
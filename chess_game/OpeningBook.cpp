@@ -0,0 +1,50 @@
+#include "OpeningBook.h"
+#include "OpeningBookData.h"
+#include "Move.h"
+#include <stdint.h>
+#include <Arduino.h>
+
+uint16_t opening_book_size() {
+  return OPENING_BOOK_SIZE;
+}
+
+uint16_t opening_book_find(uint64_t key) {
+  // Lower bound: first entry whose key is not smaller than key
+  uint16_t low = 0;
+  uint16_t high = OPENING_BOOK_SIZE;
+  while (low < high) {
+    uint16_t middle = low + (high - low) / 2;
+    if (OPENING_BOOK_KEYS[middle] < key) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  if (low < OPENING_BOOK_SIZE && OPENING_BOOK_KEYS[low] == key) {
+    return low;
+  }
+  return OPENING_BOOK_SIZE;
+}
+
+Move opening_book_move(uint64_t key, uint32_t random_value) {
+  uint16_t first = opening_book_find(key);
+  if (first == OPENING_BOOK_SIZE) {
+    return 0;
+  }
+  // Total weight of the position's moves, then walk them again until random_value falls into one
+  uint32_t total_weight = 0;
+  uint16_t end = first;
+  while (end < OPENING_BOOK_SIZE && OPENING_BOOK_KEYS[end] == key) {
+    total_weight += OPENING_BOOK_MOVES[end] >> 16;
+    end++;
+  }
+  uint32_t pick = random_value % total_weight;
+  for (uint16_t i = first; i < end; i++) {
+    uint32_t weight = OPENING_BOOK_MOVES[i] >> 16;
+    if (pick < weight) {
+      return OPENING_BOOK_MOVES[i] & 0xFFFF;
+    }
+    pick -= weight;
+  }
+  return OPENING_BOOK_MOVES[first] & 0xFFFF;
+}
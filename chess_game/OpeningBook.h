@@ -0,0 +1,27 @@
+// OpeningBook.h file
+
+#ifndef OPENING_BOOK_H
+#define OPENING_BOOK_H
+#include "Move.h"
+#include <stdint.h>
+#include <Arduino.h>
+
+// Opening book: known good moves of the first plies, so the computer answers them without searching or asking the Pi
+// The book itself is OpeningBookData.h, generated by host/book_maker from a PGN file. It is two constant arrays in
+// flash, read in place (nothing is copied to RAM):
+//   OPENING_BOOK_KEYS[i]   zobrist hash of a position, sorted ascending (a position with several moves repeats its hash)
+//   OPENING_BOOK_MOVES[i]  packed Move in bits 0-15, its weight (how many games of the PGN played it) in bits 16-31
+// 12 bytes per entry
+
+// Number of entries in the book
+uint16_t opening_book_size();
+
+// Index of the first entry of the position (binary search), opening_book_size() if it isn't in the book
+uint16_t opening_book_find(uint64_t key);
+
+// Picks a book move for the position, at random but weighted by how often it was played (random_value is any random number)
+// Returns 0 if the position isn't in the book
+// Book moves are never promotions, the move still has to be checked against the legal moves (hash collisions)
+Move opening_book_move(uint64_t key, uint32_t random_value);
+
+#endif
@@ -0,0 +1,1036 @@
+// OpeningBookData.h file
+// Generated by host/book_maker from host/openings.pgn (51 games, 16 plies), do not edit
+// Only included by OpeningBook.cpp, see OpeningBook.h for the format
+
+#ifndef OPENING_BOOK_DATA_H
+#define OPENING_BOOK_DATA_H
+#include <stdint.h>
+#include <Arduino.h>
+
+#define OPENING_BOOK_SIZE 509
+
+const uint64_t OPENING_BOOK_KEYS[OPENING_BOOK_SIZE] PROGMEM = {
+  0x005865E7A05BB684ULL,
+  0x009CBCFDE7B3F43BULL,
+  0x0262F37F8E54D1CAULL,
+  0x02B4927FE72DC330ULL,
+  0x04744B3218C23533ULL,
+  0x04744B3218C23533ULL,
+  0x04773E3B16834D36ULL,
+  0x04FCF3E7C55FF10EULL,
+  0x06ADBB2F71E27467ULL,
+  0x071AE2B2F367CAC2ULL,
+  0x0861EF48D090F73DULL,
+  0x0958C701A3F198E8ULL,
+  0x0A3F96DE61735489ULL,
+  0x0A3F96DE61735489ULL,
+  0x0A51622ECF115703ULL,
+  0x0B7C2BD7A8BA2409ULL,
+  0x0CB7476EDC3E9ECCULL,
+  0x0CD9969AE0909131ULL,
+  0x0D3F1B5824480CF5ULL,
+  0x0D69EAA633BEC7B4ULL,
+  0x0DB25821B42450EAULL,
+  0x0DB25821B42450EAULL,
+  0x0EB0F36C3AFA92B7ULL,
+  0x0F00EDD89C611A0AULL,
+  0x0F13AFC4EF01B964ULL,
+  0x0F813EA8E535E997ULL,
+  0x0FAA0D7B71C5BA5BULL,
+  0x1061032E69D827BFULL,
+  0x1077BB7C0A2CD4C4ULL,
+  0x1085E44DD7669E4CULL,
+  0x10A50F5DDD6BB190ULL,
+  0x1145FB2008F31FC4ULL,
+  0x116FFDC810F4BF93ULL,
+  0x11FBF733F66F881FULL,
+  0x1229C2EABBCF7770ULL,
+  0x130A714E8365D4D4ULL,
+  0x139AC9A1B056E982ULL,
+  0x140F4D0066275812ULL,
+  0x1451DAB185FD9252ULL,
+  0x14946D7F4F229DC6ULL,
+  0x158735745FF530B5ULL,
+  0x15A40C156E987313ULL,
+  0x1682C6D4FBB4CA65ULL,
+  0x16C610569417DA56ULL,
+  0x170674A392540BA3ULL,
+  0x179DF4B35F44CD71ULL,
+  0x17AF7D82EAA8A461ULL,
+  0x17D1356A4152DBBBULL,
+  0x180FBA3E1A5430F0ULL,
+  0x1823E497BC8376FEULL,
+  0x1863B1071A1191FEULL,
+  0x1883C9C8D0EC0131ULL,
+  0x189F017FB433BCA2ULL,
+  0x18D3FCCDD772ABECULL,
+  0x19B500F37377D9C4ULL,
+  0x1A6ACEB37C1694A3ULL,
+  0x1A980468406D3184ULL,
+  0x1B05A312FFCD4FFCULL,
+  0x1BBCFA5039D73AE6ULL,
+  0x1BBCFA5039D73AE6ULL,
+  0x1D2AA04FDFB9800AULL,
+  0x1D9813A3C4047922ULL,
+  0x1F9E88F27FA5DFE6ULL,
+  0x203ABE1C4DCF1FD0ULL,
+  0x2080A231D40D2422ULL,
+  0x21B9568A1A80D4BBULL,
+  0x22569A7006B64C33ULL,
+  0x22B1421043F782B9ULL,
+  0x24A2F73F79636898ULL,
+  0x2517843FD075C8E0ULL,
+  0x26043BCF2181A95CULL,
+  0x278F4B228A4F25A6ULL,
+  0x27C8F4E31F23B252ULL,
+  0x2809B90249A91194ULL,
+  0x288A167A56E88ACAULL,
+  0x297A1A1913F2A2B0ULL,
+  0x29A6988BF66AA49DULL,
+  0x2A263E7F46CD7BB8ULL,
+  0x2AC7F632B6685DB8ULL,
+  0x2BBC330EF00AA05CULL,
+  0x2C2471E59868FECEULL,
+  0x2C6CFEC18A31DAB8ULL,
+  0x2D0E314DB9023EDBULL,
+  0x2D31F5932E079770ULL,
+  0x2DE59DC54B162AD9ULL,
+  0x2DF4C9A349244E4EULL,
+  0x2E630CE23CE91231ULL,
+  0x2FC2BC11C4DBE25FULL,
+  0x2FE1FB3D4B834C67ULL,
+  0x308EC02319F9FFBDULL,
+  0x30F519302AD96727ULL,
+  0x3102A53E8F18CA05ULL,
+  0x3102A53E8F18CA05ULL,
+  0x3102A53E8F18CA05ULL,
+  0x3125686A2DD210D1ULL,
+  0x31940186CFD0F6E5ULL,
+  0x31BDB28178667B3EULL,
+  0x31E18885221A2C3CULL,
+  0x33B75EAA54D31A20ULL,
+  0x3595DC1FC4E3B4A1ULL,
+  0x36026B4932EB4F88ULL,
+  0x3675FEC575D9E324ULL,
+  0x367A794E32D35DF1ULL,
+  0x36DFFF5F4DB97418ULL,
+  0x376178068DAC8472ULL,
+  0x37F06C92EF605921ULL,
+  0x37F899D31B405379ULL,
+  0x38A95D3FACD26A66ULL,
+  0x38D7C289FDCEE3FCULL,
+  0x3A40CE44DC0A6FCAULL,
+  0x3BE76A368387FB1CULL,
+  0x3C26FE2F7C9D513AULL,
+  0x3C8C59A6D77114EAULL,
+  0x3D92908A7BA2C1FAULL,
+  0x3F1B9401DF4D83A0ULL,
+  0x3F4DD50D93169C39ULL,
+  0x3F78524550B4FE73ULL,
+  0x416555BF7AA42BA6ULL,
+  0x41AD9D7240011EDFULL,
+  0x42B86FB73342B659ULL,
+  0x42F57267CD9C0233ULL,
+  0x43070636756130D3ULL,
+  0x4312B60029F3C438ULL,
+  0x43A3D3DCCD66E448ULL,
+  0x44341F5901ADDC28ULL,
+  0x443B34E816CCF3B4ULL,
+  0x446B982E1B1DE4FCULL,
+  0x451D2476AFC052D4ULL,
+  0x4531A948AC364FB1ULL,
+  0x4531A948AC364FB1ULL,
+  0x4538F31CACCDD48BULL,
+  0x4548C57F4DED0DCAULL,
+  0x4624E86AA2DCB0C6ULL,
+  0x4624E86AA2DCB0C6ULL,
+  0x4624E86AA2DCB0C6ULL,
+  0x46D839DAB98282BEULL,
+  0x46F41EF33AF7BDE2ULL,
+  0x4729FC1269D7A500ULL,
+  0x474EDDBE76762D84ULL,
+  0x47B5E842187A1330ULL,
+  0x47BAEF684C40670EULL,
+  0x4954A0CFEFA95021ULL,
+  0x4954A0CFEFA95021ULL,
+  0x4954A0CFEFA95021ULL,
+  0x49A6BF03321D2351ULL,
+  0x49FE0746444515F1ULL,
+  0x4A1861155896C44BULL,
+  0x4A76692E931F389CULL,
+  0x4A7D247489A38432ULL,
+  0x4ACF6E39197F3DA5ULL,
+  0x4BD29221FBF5DB4CULL,
+  0x4C2BBE5BD0C572E0ULL,
+  0x4C828B39A938394EULL,
+  0x4DB5E8CC79B02031ULL,
+  0x4E05F99CC71F807BULL,
+  0x4E05F99CC71F807BULL,
+  0x4E05F99CC71F807BULL,
+  0x4E570D88E193A7A3ULL,
+  0x4E5ED210D86A45D0ULL,
+  0x4EE9CCAA2C8FF939ULL,
+  0x4F7C2BB6B2D3CB33ULL,
+  0x509C5131388F7130ULL,
+  0x50F69A5E322AE318ULL,
+  0x5372EF73B49106D5ULL,
+  0x53C4C6152149F8B5ULL,
+  0x557240541224F9BFULL,
+  0x55A134F4DA1A7589ULL,
+  0x569A3205D591037DULL,
+  0x569A3205D591037DULL,
+  0x569D5F337F9C5DECULL,
+  0x56C9FF583D9407CDULL,
+  0x56D3F7F43EB84DE9ULL,
+  0x5843AB73BD33966BULL,
+  0x5843AB73BD33966BULL,
+  0x58E2F24771CA38E4ULL,
+  0x59A91A3FB3C47673ULL,
+  0x5A5424F89A59562DULL,
+  0x5CD9B85531EE59DCULL,
+  0x5D368DE3BE02C9C4ULL,
+  0x5D4E64A0E51E559DULL,
+  0x5DA1217B22064079ULL,
+  0x5DEACAF75071DD5FULL,
+  0x5E622C111E088733ULL,
+  0x5E8AD8A260BC689BULL,
+  0x5FCE81523768B413ULL,
+  0x5FD5A9383970592AULL,
+  0x605B118C6DC02E17ULL,
+  0x60970DA455953646ULL,
+  0x60BBB9E77280B7B2ULL,
+  0x60D652F5FDAC7208ULL,
+  0x60D652F5FDAC7208ULL,
+  0x61742DD8E0B4109EULL,
+  0x618D4A4E19CCA368ULL,
+  0x6279F4356C45E51CULL,
+  0x635A3FBDC36C8EAEULL,
+  0x63934721B922D416ULL,
+  0x63D6299C30E60874ULL,
+  0x64A363EC8F18965EULL,
+  0x64FDBAC1836B0292ULL,
+  0x65B5BE5AFE7AA09EULL,
+  0x662E70AC08ACCD1AULL,
+  0x673911866D652CE9ULL,
+  0x6753E3E650C33D8AULL,
+  0x68934DF2DE9A10BFULL,
+  0x691041E6514A17D1ULL,
+  0x691041E6514A17D1ULL,
+  0x691041E6514A17D1ULL,
+  0x691041E6514A17D1ULL,
+  0x6916CD0C81A2B2B7ULL,
+  0x6A4F5D21D975CF87ULL,
+  0x6AA33BC2C58795AFULL,
+  0x6B5BF1FD5D9397B1ULL,
+  0x6C6E76CBB3E8ED01ULL,
+  0x6C6E76CBB3E8ED01ULL,
+  0x6C7A53AB8A6F2A91ULL,
+  0x6C7D5CC935C98208ULL,
+  0x6D1D3807AA1103F2ULL,
+  0x6D47CEBD4B6E52CEULL,
+  0x6D7B72C276B36173ULL,
+  0x6E146CF2DC4FF28CULL,
+  0x6EA36E595136856BULL,
+  0x6EACB0C5ECD4C980ULL,
+  0x6F06F9ABC7DCF328ULL,
+  0x6F40061698BA6239ULL,
+  0x6F5060CD18FDE9A4ULL,
+  0x6FB827FE189DDEB3ULL,
+  0x6FE2884A313284F5ULL,
+  0x708B084380A7FFDDULL,
+  0x7140FDF923338D9FULL,
+  0x71AF7A35F4CDA522ULL,
+  0x724D340191F648E4ULL,
+  0x724D340191F648E4ULL,
+  0x72BAD7B690BF1A04ULL,
+  0x72FA8226362DFD04ULL,
+  0x731EC7BF2B10593AULL,
+  0x7352066635064FF0ULL,
+  0x747822FF6954CEF8ULL,
+  0x74D10A273AFFFB26ULL,
+  0x74F140F9C004ECDAULL,
+  0x75519A8991D27137ULL,
+  0x75524820D30125F2ULL,
+  0x75B7F6199EFA890EULL,
+  0x762E1A3A3FFFEAA3ULL,
+  0x76B53A6D8B8AA692ULL,
+  0x76E6303FD18DF5F1ULL,
+  0x774879B7EDC9B569ULL,
+  0x77E58B3045CFCE9EULL,
+  0x782421AA4D0744DFULL,
+  0x785AF86DBF3A72FCULL,
+  0x79402A61CBC98536ULL,
+  0x79402A61CBC98536ULL,
+  0x7AB53FBE08DAF959ULL,
+  0x7AD657C39D666A57ULL,
+  0x7D43F6477F36944CULL,
+  0x7E2D4460C3224498ULL,
+  0x7E4340B59A690C78ULL,
+  0x7FCA51C7958FCD7DULL,
+  0x80C12F836CE38791ULL,
+  0x814EF4BA53EC64E7ULL,
+  0x81A46192C94EF03CULL,
+  0x81E3C2BA8E081778ULL,
+  0x83BBC9DA7B407852ULL,
+  0x83DED94D89AEC1F4ULL,
+  0x85335B0DDF2C318AULL,
+  0x8596DD1CA0461863ULL,
+  0x862A0690D75CA84BULL,
+  0x86C92E848E75AE98ULL,
+  0x86ED316DC0515360ULL,
+  0x87095BC181AC417DULL,
+  0x870B3F07F233C74DULL,
+  0x8749E3D29FCC0042ULL,
+  0x87BC55CAE625B309ULL,
+  0x87F7B18021F87FD7ULL,
+  0x88ED58EDF55C7F8FULL,
+  0x8916B642DAB89772ULL,
+  0x8923F3CBD2DFB4D0ULL,
+  0x8923F3CBD2DFB4D0ULL,
+  0x8923F3CBD2DFB4D0ULL,
+  0x897171D30D7B4BEDULL,
+  0x89E125E4C11476ACULL,
+  0x8A2E6899FAF19D3BULL,
+  0x8A710ABAC0313191ULL,
+  0x8A7CB9085E24CF76ULL,
+  0x8A7CB9085E24CF76ULL,
+  0x8B3B66DB6F5BA66EULL,
+  0x8B653685220652E2ULL,
+  0x8C23E165CB19B12CULL,
+  0x8C3881CC8E8526BAULL,
+  0x8D24782D3889C25DULL,
+  0x8DB0E2A2AEE82560ULL,
+  0x8DF5D5670BA02A82ULL,
+  0x8DF5D5670BA02A82ULL,
+  0x8DF5D5670BA02A82ULL,
+  0x8E8BC7900369E4BEULL,
+  0x8FBE9336B89C83E0ULL,
+  0x8FCA5A7DEE0814A8ULL,
+  0x90E8FFBD23E7FEEEULL,
+  0x9193F78C715C46E2ULL,
+  0x92002BB3F56CD0CDULL,
+  0x927ED02816A74815ULL,
+  0x940264292BC955BBULL,
+  0x94329535CD78EF55ULL,
+  0x94E17415566444A0ULL,
+  0x95322C19E235E1A4ULL,
+  0x955FB513402ACB01ULL,
+  0x95B1341BA409E868ULL,
+  0x971044FFB86CDD3EULL,
+  0x9766DC65DE1F89F8ULL,
+  0x987950417D629513ULL,
+  0x987FB7DE4E929CB7ULL,
+  0x987FB7DE4E929CB7ULL,
+  0x987FB7DE4E929CB7ULL,
+  0x9AD8907D1FB41DB0ULL,
+  0x9B958AF074DD35A4ULL,
+  0x9BA5808A471B1F9EULL,
+  0x9BF120E1051345BFULL,
+  0x9D165CC9059BB2A3ULL,
+  0x9D8FA8B0AE7C57A3ULL,
+  0x9E544E0C24B36C45ULL,
+  0x9E85FAEF4BF1F903ULL,
+  0x9ED47EF1846F7063ULL,
+  0x9EFB65591AED7099ULL,
+  0x9FF5106FEE9C666BULL,
+  0xA078444147BD6A10ULL,
+  0xA1F891F549AE074FULL,
+  0xA2929E7BDBF55A4BULL,
+  0xA301E74C0F8060C8ULL,
+  0xA3167B8D7F8FE47BULL,
+  0xA3B971218279841EULL,
+  0xA3E5CD02C77CE1C4ULL,
+  0xA3F5CE4BCF2493C7ULL,
+  0xA410FA63761D2FD2ULL,
+  0xA42A1569F8F380C3ULL,
+  0xA44BD90DBF7506DBULL,
+  0xA4672B4464A8821FULL,
+  0xA54CB343921D689BULL,
+  0xA590AC72EDD4C7EBULL,
+  0xA5C9A004D9B0F8C1ULL,
+  0xA5D944B607EE0385ULL,
+  0xA63BB3A91FC18B9CULL,
+  0xA75AD2F7A8999F3CULL,
+  0xA7DA4C5C0C7A959EULL,
+  0xAA81453176994F32ULL,
+  0xAAE06D1D9DF5BD28ULL,
+  0xAB09265F56F44CE8ULL,
+  0xAB0EF675A005BF9EULL,
+  0xAB6C6375E80C2452ULL,
+  0xABED807CE77F1982ULL,
+  0xADBF0047D1FE3165ULL,
+  0xADBF0047D1FE3165ULL,
+  0xAE364BB1448A237AULL,
+  0xAE9E2A34558CA73DULL,
+  0xAED31419C9D7A5E1ULL,
+  0xAEEDCFDEA1A20A31ULL,
+  0xAEEDCFDEA1A20A31ULL,
+  0xAF0603818D769765ULL,
+  0xAF30A174E894DDE3ULL,
+  0xAF30A174E894DDE3ULL,
+  0xAF5B7777E9BAA63BULL,
+  0xAFC545250D414FB5ULL,
+  0xAFCAA6FBB957FE78ULL,
+  0xB080F3E0535E1653ULL,
+  0xB18E572D1CC19458ULL,
+  0xB1A564FE8831C794ULL,
+  0xB1E9E8784848DE68ULL,
+  0xB4268E29FF628466ULL,
+  0xB570D1BB04780EEDULL,
+  0xB6398EE80E67ED0FULL,
+  0xB71057B557CAB49CULL,
+  0xB7B2230D94C6EE7BULL,
+  0xB7CE577F99D775FFULL,
+  0xB855232932ACF7E0ULL,
+  0xB868AC123C7C1DACULL,
+  0xB8C68ED395E53DEEULL,
+  0xB9BDC67C5D841291ULL,
+  0xBA0E5E399A161CFCULL,
+  0xBA5B2BEDC89DC02BULL,
+  0xBB913AA2DA7ED640ULL,
+  0xBC39B69EB052BC04ULL,
+  0xBC9A5E8CDE2EAA0BULL,
+  0xBCA892280F3E68FCULL,
+  0xBDA3A0BED27F4E11ULL,
+  0xBF1BE6CB45C93F66ULL,
+  0xC02FA3BC816E8423ULL,
+  0xC05A4707A878C007ULL,
+  0xC06D530690C04163ULL,
+  0xC0DB0A9398761387ULL,
+  0xC10652D1B3F27A40ULL,
+  0xC10652D1B3F27A40ULL,
+  0xC1162674A4B8B896ULL,
+  0xC14D24C754511125ULL,
+  0xC1F5DBA024B50FE4ULL,
+  0xC254ABA0A11CFF01ULL,
+  0xC2A28196A261F875ULL,
+  0xC2D6552D1EFC870FULL,
+  0xC3EAC452C25A7E9BULL,
+  0xC3ED8184009A46E3ULL,
+  0xC46F282543C57C53ULL,
+  0xC5D0747D6A8DE412ULL,
+  0xC6828D0C78636153ULL,
+  0xC6828D0C78636153ULL,
+  0xC72A3FD7AD3E6345ULL,
+  0xC7B6A89486BC075AULL,
+  0xC7EF58C06C9B62B2ULL,
+  0xC8519A8640DE0A32ULL,
+  0xC913C522F37E5BB9ULL,
+  0xC9A58C8F00027177ULL,
+  0xC9C02EBC3BAB6F65ULL,
+  0xCA223D0BCBE088B0ULL,
+  0xCA223D0BCBE088B0ULL,
+  0xCB9485A283F824BAULL,
+  0xCBF659C826CDD356ULL,
+  0xCBFF53A182D65F62ULL,
+  0xCC3169A6A8205E5AULL,
+  0xCCB89C2A51A81BD0ULL,
+  0xCEAF5215EDA3D1DEULL,
+  0xCFE259C9E3BA9AC6ULL,
+  0xD029579CFBA70722ULL,
+  0xD05A946F8D4084D8ULL,
+  0xD0C7AA6A9BF76CF3ULL,
+  0xD189F2D5E3DFD0D2ULL,
+  0xD27FEC1F0C411D84ULL,
+  0xD2FD3EADA28AF269ULL,
+  0xD3C7CCB247DA1411ULL,
+  0xD3D61893F1CA9EF9ULL,
+  0xD3E90795586A7C9BULL,
+  0xD41CEBF5BF2B9E96ULL,
+  0xD432758FAF93D9ADULL,
+  0xD4AEC81E8B143829ULL,
+  0xD50CA6C675F43F4EULL,
+  0xD5E0053B61056FE4ULL,
+  0xD60117D71FA14091ULL,
+  0xD6EDCC19480F6137ULL,
+  0xD73F21398115E2C9ULL,
+  0xD7FC316F99FABD68ULL,
+  0xD814DB6F4DF02C0FULL,
+  0xD816EC20C550A720ULL,
+  0xD84C133372C4E3FEULL,
+  0xD855AC59B46C288AULL,
+  0xDA3DFE2FAB1E2FF7ULL,
+  0xDA3EAB1AAAD349D1ULL,
+  0xDB257D3EA9CC9478ULL,
+  0xDC07FD710B22C259ULL,
+  0xDC2C886950582785ULL,
+  0xDE56CD0B8CE75955ULL,
+  0xDE56CD0B8CE75955ULL,
+  0xDE56CD0B8CE75955ULL,
+  0xDE56CD0B8CE75955ULL,
+  0xDE56CD0B8CE75955ULL,
+  0xDE56CD0B8CE75955ULL,
+  0xDE56CD0B8CE75955ULL,
+  0xDE56CD0B8CE75955ULL,
+  0xDE94D938A2DF42AAULL,
+  0xDF4B61C53317C16AULL,
+  0xE15C8B18C70D0458ULL,
+  0xE33843554BBAFD56ULL,
+  0xE3587DF3D77EBA51ULL,
+  0xE37FD57F7154D3AEULL,
+  0xE3EFCD444AE1C65CULL,
+  0xE42B52466E0061D0ULL,
+  0xE43D2CC7E5E79800ULL,
+  0xE5A76AF9E2CDD8FCULL,
+  0xE5FF99D968B26FFCULL,
+  0xE706AA46774EC8F2ULL,
+  0xE76BE0947009AA55ULL,
+  0xE7A8FA3698CC7CEDULL,
+  0xE92FF13688219A53ULL,
+  0xE9EB8AF852CB40DCULL,
+  0xEA3BE4B2DA2EB7A2ULL,
+  0xEA6FDAD1DF48BBFAULL,
+  0xEAAC470FB6C1E645ULL,
+  0xEBAF0F212FA6D3F9ULL,
+  0xEBAF0F212FA6D3F9ULL,
+  0xEBAF0F212FA6D3F9ULL,
+  0xEE9D085069449728ULL,
+  0xEEACA6BB036F17EAULL,
+  0xEED3137D255F76AAULL,
+  0xEEFE1627098F0C96ULL,
+  0xEF0698A959964ADEULL,
+  0xEF0698A959964ADEULL,
+  0xEF0698A959964ADEULL,
+  0xEFA85CF6D2B1F076ULL,
+  0xF001F6CC951A964AULL,
+  0xF0FC638591ED298AULL,
+  0xF1A10A026F927CADULL,
+  0xF1B862BE7011ADF4ULL,
+  0xF1CBC6E1E377E6E2ULL,
+  0xF20E1BD7AEA1D31BULL,
+  0xF20E1BD7AEA1D31BULL,
+  0xF3E4E4C2E2A8AD4DULL,
+  0xF49154FD41132E8BULL,
+  0xF49154FD41132E8BULL,
+  0xF49154FD41132E8BULL,
+  0xF497D81791FB8BEDULL,
+  0xF5C2EF7387BC5068ULL,
+  0xF6F180243D551746ULL,
+  0xF73160D153B39D98ULL,
+  0xF834AB41EE2399C4ULL,
+  0xF83BBFC709A2E9E3ULL,
+  0xF9569FE184F0CDB7ULL,
+  0xF96275539F834B15ULL,
+  0xF97C5BF5E5C4BC0FULL,
+  0xF9B8D62EBAEF7A7AULL,
+  0xFAB8049D7D3C15B3ULL,
+  0xFAB8049D7D3C15B3ULL,
+  0xFAEB272E731CDB92ULL,
+  0xFC9C35E15E46985AULL,
+  0xFFC011870B794152ULL,
+  0xFFF8E12E7C1CDC46ULL,
+};
+
+const uint32_t OPENING_BOOK_MOVES[OPENING_BOOK_SIZE] PROGMEM = {
+  0x00011D26,
+  0x000118DC,
+  0x00010546,
+  0x00010D3D,
+  0x000108F3,
+  0x00010B7E,
+  0x0001097A,
+  0x00010AB9,
+  0x00010A71,
+  0x00010D3D,
+  0x00010481,
+  0x00011EFC,
+  0x00020A30,
+  0x00010BB6,
+  0x00010AB9,
+  0x0001097A,
+  0x0001054D,
+  0x00020934,
+  0x00010546,
+  0x000106CB,
+  0x00020481,
+  0x00020546,
+  0x00011AA1,
+  0x00010A30,
+  0x00010AF3,
+  0x000106CB,
+  0x000108B2,
+  0x0001048A,
+  0x000118EC,
+  0x00011AB1,
+  0x00014184,
+  0x00010481,
+  0x00010CF9,
+  0x00011EC3,
+  0x00030481,
+  0x000104C5,
+  0x00011693,
+  0x00010B7E,
+  0x00011499,
+  0x00014FBC,
+  0x00011489,
+  0x0002067D,
+  0x00014184,
+  0x00014FBC,
+  0x00010AF3,
+  0x00010742,
+  0x000106CB,
+  0x00010B7E,
+  0x00011AB1,
+  0x00010B34,
+  0x0001048A,
+  0x0002070C,
+  0x00010A39,
+  0x00010BF7,
+  0x00010B34,
+  0x000118DC,
+  0x0001191B,
+  0x00020B7E,
+  0x00010481,
+  0x00090546,
+  0x000106A2,
+  0x00011AA3,
+  0x00010B34,
+  0x00010D3E,
+  0x00011B7B,
+  0x0001172D,
+  0x00010823,
+  0x00010934,
+  0x000116D5,
+  0x00010408,
+  0x0001059C,
+  0x000108EB,
+  0x00010B7E,
+  0x00010B3A,
+  0x00010CF9,
+  0x0001091C,
+  0x00010385,
+  0x0001091C,
+  0x000118DA,
+  0x00020AFD,
+  0x00010AF3,
+  0x00010408,
+  0x00010502,
+  0x00010B7E,
+  0x000106E3,
+  0x00010A63,
+  0x00010AB9,
+  0x00011AB3,
+  0x0001097A,
+  0x00010AB2,
+  0x000116D5,
+  0x000108B2,
+  0x00010934,
+  0x00010B7E,
+  0x00010608,
+  0x00010A30,
+  0x0001050C,
+  0x0001067D,
+  0x000408F3,
+  0x000104C5,
+  0x0001148A,
+  0x000109ED,
+  0x00010AB9,
+  0x00010AB9,
+  0x000308F3,
+  0x0001068A,
+  0x0001096B,
+  0x00010BB6,
+  0x00010AB9,
+  0x00010481,
+  0x0001074D,
+  0x00010AB9,
+  0x00011915,
+  0x000107BA,
+  0x00010502,
+  0x000108B2,
+  0x00014FBC,
+  0x0001048A,
+  0x00010B7E,
+  0x000108ED,
+  0x00010564,
+  0x00010546,
+  0x0001050C,
+  0x0001172D,
+  0x00014FBC,
+  0x00010502,
+  0x00014184,
+  0x000116D2,
+  0x00010283,
+  0x0001050C,
+  0x0001082A,
+  0x000107BA,
+  0x00020AB2,
+  0x00020B34,
+  0x000116A3,
+  0x00010546,
+  0x00010D3D,
+  0x000108B2,
+  0x00010305,
+  0x00010AB2,
+  0x0001070C,
+  0x00020AB9,
+  0x00030AF3,
+  0x00010B34,
+  0x00010546,
+  0x0001074D,
+  0x0001050C,
+  0x0001074D,
+  0x00010DBD,
+  0x00010AF3,
+  0x00010481,
+  0x0001045B,
+  0x000208DB,
+  0x00010B7E,
+  0x00010546,
+  0x0005068A,
+  0x00010742,
+  0x000106CB,
+  0x00010B34,
+  0x00010B7E,
+  0x00014FBC,
+  0x00010AB9,
+  0x00010546,
+  0x00010303,
+  0x00010B34,
+  0x00010B7E,
+  0x0001048A,
+  0x00010871,
+  0x00010B34,
+  0x00010CF9,
+  0x000104CB,
+  0x00014FBC,
+  0x00080AB9,
+  0x00010B7E,
+  0x00010408,
+  0x0001097A,
+  0x00010502,
+  0x000108B2,
+  0x00010B75,
+  0x00010982,
+  0x00011A21,
+  0x00010546,
+  0x00010AF3,
+  0x0001185A,
+  0x000118FB,
+  0x00011B64,
+  0x0001067D,
+  0x00014184,
+  0x0001068A,
+  0x000108F3,
+  0x00010A71,
+  0x000102C2,
+  0x00014FBC,
+  0x000116E4,
+  0x00010BB6,
+  0x00011AB3,
+  0x000108F3,
+  0x0001149B,
+  0x000118ED,
+  0x000306CB,
+  0x00014184,
+  0x000116E2,
+  0x00010D3B,
+  0x00010D2A,
+  0x00020546,
+  0x0003068A,
+  0x001106CB,
+  0x001D070C,
+  0x00010B7E,
+  0x00010A30,
+  0x00010685,
+  0x00010AF3,
+  0x000108F3,
+  0x00020DBD,
+  0x00011AA1,
+  0x00010BF7,
+  0x000102C1,
+  0x00010BB6,
+  0x000114A3,
+  0x00010AF3,
+  0x00010481,
+  0x000116D5,
+  0x00010A7B,
+  0x0001048A,
+  0x000108F3,
+  0x00010AB2,
+  0x00010AF3,
+  0x000108B2,
+  0x00010871,
+  0x00010AF3,
+  0x00030A30,
+  0x00010B7E,
+  0x000108F3,
+  0x0001048A,
+  0x0001050C,
+  0x00010B7E,
+  0x00030481,
+  0x00010546,
+  0x000116A3,
+  0x00010481,
+  0x000118DA,
+  0x00010546,
+  0x000116E4,
+  0x00010AF3,
+  0x00030B7E,
+  0x00010D3D,
+  0x00010502,
+  0x00010CED,
+  0x00010DBD,
+  0x00010AF3,
+  0x00014FBC,
+  0x00010546,
+  0x00010543,
+  0x00010306,
+  0x0001191D,
+  0x0001085B,
+  0x00024184,
+  0x00011489,
+  0x000108B2,
+  0x0001058E,
+  0x00010D3E,
+  0x000116D5,
+  0x00010A3A,
+  0x0001058E,
+  0x00014184,
+  0x00014184,
+  0x000118DA,
+  0x00010B34,
+  0x00010DBD,
+  0x00010934,
+  0x00010BB6,
+  0x000104C5,
+  0x000104CB,
+  0x00010DBD,
+  0x00010871,
+  0x000102C1,
+  0x00020481,
+  0x0001091C,
+  0x00010546,
+  0x0001048A,
+  0x000116E2,
+  0x00010481,
+  0x00020621,
+  0x00011AA1,
+  0x000102C1,
+  0x000108F3,
+  0x00011712,
+  0x00010546,
+  0x00010481,
+  0x00010BB6,
+  0x00010481,
+  0x0001091C,
+  0x000118DC,
+  0x00014FBC,
+  0x0001050C,
+  0x0001058E,
+  0x00014FBC,
+  0x0001091C,
+  0x000116E2,
+  0x000102C3,
+  0x0001091C,
+  0x00010DBD,
+  0x000104C5,
+  0x00010934,
+  0x00010CF9,
+  0x00014184,
+  0x000116E2,
+  0x000118ED,
+  0x0001050C,
+  0x000208B2,
+  0x00040B34,
+  0x00030BB6,
+  0x0001048A,
+  0x00010546,
+  0x000104CB,
+  0x00010D3B,
+  0x00011685,
+  0x0001058E,
+  0x00014184,
+  0x000102C1,
+  0x00010B34,
+  0x00010481,
+  0x000108F3,
+  0x00010385,
+  0x00020305,
+  0x00011499,
+  0x000108F3,
+  0x0001074D,
+  0x00010AB9,
+  0x00010B7E,
+  0x00014FBC,
+  0x00011685,
+  0x00010DBD,
+  0x00010CBB,
+  0x0001050C,
+  0x00014FBC,
+  0x00010A30,
+  0x00010982,
+  0x00010742,
+  0x000107E6,
+  0x00010934,
+  0x00020458,
+  0x00010385,
+  0x000306CB,
+  0x00010BB6,
+  0x00011AB3,
+  0x0001091C,
+  0x00014184,
+  0x00010546,
+  0x0001054D,
+  0x000406CB,
+  0x0001091C,
+  0x00010DBD,
+  0x000108BD,
+  0x00020B7E,
+  0x00010CBB,
+  0x00010982,
+  0x000118DA,
+  0x00010385,
+  0x00020AF3,
+  0x00020871,
+  0x00010A30,
+  0x00010AB9,
+  0x000106CB,
+  0x0001091C,
+  0x000108B2,
+  0x00010D3D,
+  0x00010AF3,
+  0x00010481,
+  0x000108AA,
+  0x00014FBC,
+  0x0001070C,
+  0x00010546,
+  0x00010D3D,
+  0x000108DB,
+  0x000106CB,
+  0x00020B7E,
+  0x0001085A,
+  0x0001068A,
+  0x00010B7E,
+  0x00020D3D,
+  0x00010B34,
+  0x00010546,
+  0x0001074D,
+  0x00010481,
+  0x0009068A,
+  0x00014FBC,
+  0x0001067D,
+  0x00010B7E,
+  0x00010AB9,
+  0x000104C5,
+  0x00010BA5,
+  0x00010D3D,
+  0x00010CF9,
+  0x00010105,
+  0x00010D3D,
+  0x00010B34,
+  0x00010105,
+  0x00011723,
+  0x00010B34,
+  0x000116A3,
+  0x00011A9B,
+  0x00010A30,
+  0x00010CBB,
+  0x000118EA,
+  0x00010D3D,
+  0x00010421,
+  0x000108DB,
+  0x000104CB,
+  0x00010995,
+  0x00010B7E,
+  0x00010DBD,
+  0x00020B7E,
+  0x0001054D,
+  0x00010DBD,
+  0x00010AB9,
+  0x00014184,
+  0x000108B2,
+  0x00010783,
+  0x00010546,
+  0x000108ED,
+  0x000108B2,
+  0x000106CB,
+  0x00010D3D,
+  0x00010ADC,
+  0x00020481,
+  0x00010982,
+  0x00011D3B,
+  0x00010481,
+  0x00010D3E,
+  0x0001172D,
+  0x0001058E,
+  0x000102C3,
+  0x00020546,
+  0x000106CB,
+  0x00010546,
+  0x0001070C,
+  0x00011A3A,
+  0x00010385,
+  0x0001070C,
+  0x000104CB,
+  0x00020105,
+  0x00010AB2,
+  0x000106CB,
+  0x000808B2,
+  0x000108F3,
+  0x000A0934,
+  0x00030AB2,
+  0x00010AF3,
+  0x00040B34,
+  0x00010B7E,
+  0x00010BB6,
+  0x00020481,
+  0x0001050C,
+  0x00010DBD,
+  0x00010B7E,
+  0x00014184,
+  0x00010305,
+  0x00010546,
+  0x00010B7E,
+  0x000116A3,
+  0x00010449,
+  0x00010481,
+  0x000107CF,
+  0x00010BB6,
+  0x00014184,
+  0x0001067D,
+  0x00010B7E,
+  0x000108F3,
+  0x000108AA,
+  0x00010AB2,
+  0x00030685,
+  0x000106CB,
+  0x00040845,
+  0x00014FBC,
+  0x000118EC,
+  0x0001058E,
+  0x00010385,
+  0x00010481,
+  0x0001048A,
+  0x00060546,
+  0x000104C5,
+  0x0001082A,
+  0x00010BB6,
+  0x000316D5,
+  0x00011489,
+  0x00010871,
+  0x00010502,
+  0x00010982,
+  0x00010105,
+  0x000708F3,
+  0x00010975,
+  0x00090B7E,
+  0x000106CB,
+  0x00014FBC,
+  0x00010AB9,
+  0x000102C3,
+  0x000316E2,
+  0x00010546,
+  0x00010546,
+  0x00010D19,
+  0x00010B34,
+  0x00010934,
+  0x000106CB,
+  0x00010845,
+  0x00010B34,
+  0x000108ED,
+  0x00010CED,
+  0x000106CB,
+};
+
+#endif
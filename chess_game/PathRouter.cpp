@@ -0,0 +1,209 @@
+#include "PathRouter.h"
+#include "Board.h"
+#include "Piece.h"
+#include "PieceType.h"
+#include "MotorQueue.h"
+#include "ResetPlanner.h"
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <Arduino.h>
+
+#define ROUTE_NODES (ROUTE_COLUMNS * ROUTE_ROWS)
+
+Occupancy occupancy_of(const Board &board, const int8_t* graveyard) {
+  Occupancy occupancy;
+  memset(occupancy.rows, 0, sizeof(occupancy.rows));
+  for (int8_t y = 0; y < 8; y++) {
+    for (int8_t x = 0; x < 8; x++) {
+      if (board.piece_at(x, y).get_type() != EMPTY) {
+        occupancy.set(x, y, true);
+      }
+    }
+  }
+  // graveyard[]: queen to pawn of white, of black, then the temp pieces of each color, in slots from 0 up
+  for (int8_t i = 0; i < 12; i++) {
+    int8_t kind = i < 10 ? i % 5 + 1 : 6;
+    bool color = i < 10 ? i >= 5 : i == 11;
+    for (int8_t count = 0; count < graveyard[i]; count++) {
+      std::pair<int8_t, int8_t> slot = graveyard_square(kind, color, count);
+      occupancy.set(slot.first, slot.second, true);
+    }
+  }
+  return occupancy;
+}
+
+static float square_x_mm(int8_t x) {
+  float mm = x * RESET_MM_PER_SQUARE;
+  if (x < 0) {
+    return mm - RESET_GRAVEYARD_GAP;
+  } else if (x > 7) {
+    return mm + RESET_GRAVEYARD_GAP;
+  }
+  return mm;
+}
+
+void half_square_mm(int8_t half_x, int8_t half_y, float &x, float &y) {
+  // Arithmetic shift: floor, also for the left graveyards
+  int8_t left = half_x >> 1;
+  x = (half_x & 1) ? (square_x_mm(left) + square_x_mm(left + 1)) / 2 : square_x_mm(left);
+  y = half_y * RESET_MM_PER_SQUARE / 2;
+}
+
+// Whether a piece carried in a straight line from (x0, y0) to (x1, y1) (mm) keeps its distance to every other piece
+// Only the squares next to the line's box can be close enough
+static bool line_clear(const Occupancy &occupancy, float x0, float y0, float x1, float y1) {
+  int8_t low_x = floorf(fminf(x0, x1) / RESET_MM_PER_SQUARE) - 1;
+  int8_t high_x = ceilf(fmaxf(x0, x1) / RESET_MM_PER_SQUARE) + 1;
+  int8_t low_y = floorf(fminf(y0, y1) / RESET_MM_PER_SQUARE) - 1;
+  int8_t high_y = ceilf(fmaxf(y0, y1) / RESET_MM_PER_SQUARE) + 1;
+  low_x = low_x < -3 ? -3 : low_x;
+  high_x = high_x > 10 ? 10 : high_x;
+  low_y = low_y < 0 ? 0 : low_y;
+  high_y = high_y > 7 ? 7 : high_y;
+  float dx = x1 - x0;
+  float dy = y1 - y0;
+  float length_2 = dx * dx + dy * dy;
+  for (int8_t y = low_y; y <= high_y; y++) {
+    for (int8_t x = low_x; x <= high_x; x++) {
+      if (!occupancy.at(x, y)) {
+        continue;
+      }
+      // Closest point of the line to the piece's center
+      float center_x = square_x_mm(x);
+      float center_y = y * RESET_MM_PER_SQUARE;
+      float t = length_2 > 0 ? ((center_x - x0) * dx + (center_y - y0) * dy) / length_2 : 0;
+      t = t < 0 ? 0 : t > 1 ? 1 : t;
+      if (hypotf(x0 + t * dx - center_x, y0 + t * dy - center_y) < ROUTE_CLEARANCE_MM) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static void node_mm(int16_t node, float &x, float &y) {
+  half_square_mm(node % ROUTE_COLUMNS - 6, node / ROUTE_COLUMNS, x, y);
+}
+
+static bool nodes_clear(const Occupancy &occupancy, int16_t from, int16_t to) {
+  float x0, y0, x1, y1;
+  node_mm(from, x0, y0);
+  node_mm(to, x1, y1);
+  return line_clear(occupancy, x0, y0, x1, y1);
+}
+
+static float nodes_mm(int16_t from, int16_t to) {
+  float x0, y0, x1, y1;
+  node_mm(from, x0, y0);
+  node_mm(to, x1, y1);
+  return hypotf(x1 - x0, y1 - y0);
+}
+
+int8_t route_piece(const Occupancy &occupancy, int8_t x0, int8_t y0, int8_t x1, int8_t y1, int8_t* waypoints) {
+  Occupancy others = occupancy;
+  others.set(x0, y0, false);
+  int16_t start = (2 * y0) * ROUTE_COLUMNS + 2 * x0 + 6;
+  int16_t goal = (2 * y1) * ROUTE_COLUMNS + 2 * x1 + 6;
+  if (nodes_clear(others, start, goal)) {
+    return 0;
+  }
+
+  // Theta*: A* over the half square grid, but a point links straight to its neighbour's parent when it can see it
+  // Static: too big for the loop's stack
+  static float cost[ROUTE_NODES];
+  static float estimate[ROUTE_NODES];  // cost plus the straight distance left
+  static int16_t parent[ROUTE_NODES];
+  static uint8_t state[ROUTE_NODES];  // 0 not seen, 1 open, 2 closed
+  memset(state, 0, sizeof(state));
+  cost[start] = 0;
+  estimate[start] = nodes_mm(start, goal);
+  parent[start] = start;
+  state[start] = 1;
+  while (true) {
+    // Open point with the least estimate (a few hundred points, no heap needed)
+    int16_t current = -1;
+    float best = INFINITY;
+    for (int16_t node = 0; node < ROUTE_NODES; node++) {
+      if (state[node] == 1 && estimate[node] < best) {
+        best = estimate[node];
+        current = node;
+      }
+    }
+    if (current < 0) {
+      return -1;
+    }
+    if (current == goal) {
+      break;
+    }
+    state[current] = 2;
+    int8_t column = current % ROUTE_COLUMNS;
+    int8_t row = current / ROUTE_COLUMNS;
+    for (int8_t dy = -1; dy <= 1; dy++) {
+      for (int8_t dx = -1; dx <= 1; dx++) {
+        if ((dx == 0 && dy == 0) || column + dx < 0 || column + dx >= ROUTE_COLUMNS || row + dy < 0 ||
+            row + dy >= ROUTE_ROWS) {
+          continue;
+        }
+        int16_t next = current + dy * ROUTE_COLUMNS + dx;
+        if (state[next] == 2) {
+          continue;
+        }
+        int16_t from = parent[current];
+        if (!nodes_clear(others, from, next)) {
+          from = current;
+          if (!nodes_clear(others, from, next)) {
+            continue;
+          }
+        }
+        float next_cost = cost[from] + nodes_mm(from, next);
+        if (state[next] == 0 || next_cost < cost[next]) {
+          cost[next] = next_cost;
+          estimate[next] = next_cost + nodes_mm(next, goal);
+          parent[next] = from;
+          state[next] = 1;
+        }
+      }
+    }
+  }
+
+  // Back from the goal, the points between the ends are the waypoints
+  int8_t count = 0;
+  for (int16_t node = parent[goal]; node != start; node = parent[node]) {
+    count++;
+  }
+  if (count > ROUTE_MAX_WAYPOINTS) {
+    return -1;
+  }
+  int8_t i = count;
+  for (int16_t node = parent[goal]; node != start; node = parent[node]) {
+    i--;
+    waypoints[2 * i] = node % ROUTE_COLUMNS - 6;
+    waypoints[2 * i + 1] = node / ROUTE_COLUMNS;
+  }
+  return count;
+}
+
+uint8_t route_segment(Occupancy &occupancy, const MotorSegment &segment, MotorSegment* records) {
+  if (segment.mode == MOTOR_MODE_CALIBRATE || segment.mode == MOTOR_MODE_WAYPOINT) {
+    records[0] = segment;
+    return 1;
+  }
+  int8_t waypoints[2 * ROUTE_MAX_WAYPOINTS];
+  int8_t count = route_piece(occupancy, segment.x0, segment.y0, segment.x1, segment.y1, waypoints);
+  occupancy.set(segment.x0, segment.y0, false);
+  occupancy.set(segment.x1, segment.y1, true);
+  if (count < 0) {
+    records[0] = segment;
+    return 1;
+  }
+  // A waypoint is a square and whether to go half a square further, on each axis
+  for (int8_t i = 0; i < count; i++) {
+    int8_t half_x = waypoints[2 * i];
+    int8_t half_y = waypoints[2 * i + 1];
+    records[i] = {(int8_t)(half_x >> 1), (int8_t)(half_y >> 1), (int8_t)(half_x & 1), (int8_t)(half_y & 1),
+                  MOTOR_MODE_WAYPOINT};
+  }
+  records[count] = {segment.x0, segment.y0, segment.x1, segment.y1, MOTOR_MODE_DIRECT};
+  return count + 1;
+}
@@ -0,0 +1,58 @@
+// PathRouter.h file
+
+#ifndef PATH_ROUTER_H
+#define PATH_ROUTER_H
+#include "Board.h"
+#include "MotorQueue.h"
+#include "ResetPlanner.h"
+#include <stdint.h>
+#include <Arduino.h>
+
+// Routes a carried piece around the pieces in its way, instead of a straight line (which only clears the other pieces
+// for a move along a line of empty squares) or the taxicab detour along the square edges (always clear, but long)
+//
+// The carried piece has to stay ROUTE_CLEARANCE_MM from the center of every other piece: half a square, which is
+// what a lane between two rows of pieces leaves. A straight line to the destination is taken if it is clear,
+// otherwise the shortest path over the half square grid (square centers, edges and corners of the whole playing area)
+// where each point links to any earlier one of the path it can see (Theta*), so the lanes are only used where the
+// pieces are. The waypoints go to the subordinate as MOTOR_MODE_WAYPOINT segments ahead of the move.
+
+#define ROUTE_MAX_WAYPOINTS 4
+#define ROUTE_CLEARANCE_MM (RESET_MM_PER_SQUARE / 2 - 0.5f)
+// Half squares of the playing area: x from -6 to 20, y from 0 to 14
+#define ROUTE_COLUMNS 27
+#define ROUTE_ROWS 15
+
+// Occupied squares of the playing area (x from -3 to 10, y from 0 to 7)
+struct Occupancy {
+  uint16_t rows[8];  // bit x + 3
+
+  bool at(int8_t x, int8_t y) const {
+    return rows[y] & (1 << (x + 3));
+  }
+
+  void set(int8_t x, int8_t y, bool occupied) {
+    if (occupied) {
+      rows[y] |= 1 << (x + 3);
+    } else {
+      rows[y] &= ~(1 << (x + 3));
+    }
+  }
+};
+
+// The pieces on the board and in the graveyards (chess_game.ino's graveyard[], temp pieces included)
+Occupancy occupancy_of(const Board &board, const int8_t* graveyard);
+
+// Position in mm of a point of the half square grid (x from -6 to 20, the graveyard gap splits in the middle)
+void half_square_mm(int8_t half_x, int8_t half_y, float &x, float &y);
+
+// Waypoints of a piece carried from (x0, y0) to (x1, y1) (its own square doesn't count, the destination is empty)
+// as half square x, y pairs in waypoints (2 * ROUTE_MAX_WAYPOINTS), returns how many (0 for a straight line),
+// -1 if there is no clear path with at most ROUTE_MAX_WAYPOINTS
+int8_t route_piece(const Occupancy &occupancy, int8_t x0, int8_t y0, int8_t x1, int8_t y1, int8_t* waypoints);
+
+// Segments to queue for segment (ROUTE_MAX_WAYPOINTS + 1 at most in records): its waypoints then the move as a
+// straight line, or the segment as it is if it has no route (or is a calibration). Moves the piece in occupancy
+uint8_t route_segment(Occupancy &occupancy, const MotorSegment &segment, MotorSegment* records);
+
+#endif
@@ -0,0 +1,275 @@
+#include "PiLink.h"
+#include <stdint.h>
+#include <string.h>
+#include <Arduino.h>
+
+// Sync, kind, sequence number and length before the payload, CRC after it
+#define FRAME_HEADER_LENGTH 4
+#define FRAME_CRC_LENGTH 2
+
+uint16_t pi_link_crc16(const uint8_t* data, uint16_t length) {
+  uint16_t crc = 0xFFFF;
+  for (uint16_t i = 0; i < length; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+// PI_MSG_MOVE's promotion codes from 1 up
+static const PieceType PI_PROMOTION_TYPES[4] = {QUEEN, ROOK, BISHOP, KNIGHT};
+static const PieceType PROMOTION_SELECTION_TYPES[4] = {QUEEN, KNIGHT, BISHOP, ROOK};
+
+uint8_t pi_promotion_code(PieceType type) {
+  for (uint8_t i = 0; i < 4; i++) {
+    if (PI_PROMOTION_TYPES[i] == type) {
+      return i + 1;
+    }
+  }
+  return 0;
+}
+
+PieceType pi_promotion_type(uint8_t code) {
+  return code >= 1 && code <= 4 ? PI_PROMOTION_TYPES[code - 1] : EMPTY;
+}
+
+PieceType promotion_selection_type(int8_t selection) {
+  return selection >= 0 && selection < 4 ? PROMOTION_SELECTION_TYPES[selection] : QUEEN;
+}
+
+int8_t promotion_selection_of(PieceType type) {
+  for (int8_t i = 0; i < 4; i++) {
+    if (PROMOTION_SELECTION_TYPES[i] == type) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+PiLink::PiLink() {
+  begin(nullptr);
+}
+
+void PiLink::begin(PiChannel* link_channel) {
+  channel = link_channel;
+  batch_length = 0;
+  send_sequence = 0;
+  first_frame_sent = false;
+  receive_sequence = 0;
+  frame_received = false;
+  receive_first = false;
+  ack_received = false;
+  ack_sequence = 0;
+  rx_position = 0;
+  rx_last_byte_ms = 0;
+  inbox_start = 0;
+  inbox_count = 0;
+  frames_sent = 0;
+  retransmissions = 0;
+  bad_frames = 0;
+}
+
+bool PiLink::add_message(uint8_t type, const uint8_t* body, uint8_t length) {
+  if (length > PI_LINK_MAX_MESSAGE || batch_length + 2 + length > PI_LINK_MAX_PAYLOAD) {
+    return false;
+  }
+  batch[batch_length++] = type;
+  batch[batch_length++] = length;
+  memcpy(batch + batch_length, body, length);
+  batch_length += length;
+  return true;
+}
+
+bool PiLink::add_config(bool color, bool is_human, uint8_t difficulty) {
+  uint8_t body[3] = {color, is_human, difficulty};
+  return add_message(PI_MSG_CONFIG, body, sizeof(body));
+}
+
+bool PiLink::add_move(int8_t from, int8_t to, uint8_t promotion) {
+  uint8_t body[3] = {(uint8_t)from, (uint8_t)to, promotion};
+  return add_message(PI_MSG_MOVE, body, sizeof(body));
+}
+
+bool PiLink::add_fen(uint8_t position_id, const char* fen) {
+  uint8_t body[PI_LINK_MAX_MESSAGE];
+  size_t length = strlen(fen);
+  if (length + 1 > PI_LINK_MAX_MESSAGE) {
+    return false;
+  }
+  body[0] = position_id;
+  memcpy(body + 1, fen, length);
+  return add_message(PI_MSG_FEN, body, length + 1);
+}
+
+void PiLink::write_frame(uint8_t kind, uint8_t sequence, const uint8_t* payload, uint8_t length) {
+  uint8_t frame[FRAME_HEADER_LENGTH + PI_LINK_MAX_PAYLOAD + FRAME_CRC_LENGTH];
+  frame[0] = PI_LINK_SYNC;
+  frame[1] = kind;
+  frame[2] = sequence;
+  frame[3] = length;
+  if (length > 0) {
+    memcpy(frame + FRAME_HEADER_LENGTH, payload, length);
+  }
+  uint16_t crc = pi_link_crc16(frame + 1, FRAME_HEADER_LENGTH - 1 + length);
+  frame[FRAME_HEADER_LENGTH + length] = crc & 0xFF;
+  frame[FRAME_HEADER_LENGTH + length + 1] = crc >> 8;
+  // One write, so the UART driver sends the whole frame back to back
+  channel->write(frame, FRAME_HEADER_LENGTH + length + FRAME_CRC_LENGTH);
+}
+
+bool PiLink::send_batch() {
+  if (batch_length == 0) {
+    return true;
+  }
+  uint8_t kind = PI_FRAME_DATA | (first_frame_sent ? 0 : PI_FRAME_FIRST);
+  bool acked = false;
+  for (uint8_t attempt = 0; attempt <= PI_LINK_MAX_RETRIES && !acked; attempt++) {
+    if (attempt > 0) {
+      retransmissions++;
+    }
+    ack_received = false;
+    write_frame(kind, send_sequence, batch, batch_length);
+    frames_sent++;
+    unsigned long start = millis();
+    while (millis() - start < PI_LINK_ACK_TIMEOUT_MS) {
+      receive();
+      if (ack_received && ack_sequence == send_sequence) {
+        acked = true;
+        break;
+      }
+    }
+  }
+  // The next frame gets a new number either way, so a lost batch isn't taken for a repeat of it
+  send_sequence++;
+  batch_length = 0;
+  if (acked) {
+    first_frame_sent = true;
+  }
+  return acked;
+}
+
+void PiLink::receive() {
+  // A frame cut short (or with a corrupted length) would wait for bytes that only come with the next frames
+  if (rx_position > 0 && millis() - rx_last_byte_ms > PI_LINK_BYTE_TIMEOUT_MS) {
+    drop_frame();
+    check_frame();
+  }
+  while (channel->available() > 0) {
+    uint8_t byte = channel->read();
+    rx_last_byte_ms = millis();
+    if (rx_position == 0 && byte != PI_LINK_SYNC) {
+      continue;
+    }
+    rx_frame[rx_position++] = byte;
+    check_frame();
+  }
+}
+
+void PiLink::drop_frame() {
+  bad_frames++;
+  uint16_t next_sync = 1;
+  while (next_sync < rx_position && rx_frame[next_sync] != PI_LINK_SYNC) {
+    next_sync++;
+  }
+  rx_position -= next_sync;
+  memmove(rx_frame, rx_frame + next_sync, rx_position);
+}
+
+void PiLink::check_frame() {
+  while (rx_position >= FRAME_HEADER_LENGTH) {
+    uint8_t length = rx_frame[3];
+    if (length <= PI_LINK_MAX_PAYLOAD) {
+      if (rx_position < FRAME_HEADER_LENGTH + length + FRAME_CRC_LENGTH) {
+        return;
+      }
+      uint16_t crc = pi_link_crc16(rx_frame + 1, FRAME_HEADER_LENGTH - 1 + length);
+      uint16_t received_crc = rx_frame[FRAME_HEADER_LENGTH + length] | (rx_frame[FRAME_HEADER_LENGTH + length + 1] << 8);
+      if (crc == received_crc) {
+        handle_frame();
+        rx_position = 0;
+        return;
+      }
+    }
+    // Not a frame (a corrupted length would otherwise swallow the frames after it)
+    drop_frame();
+  }
+}
+
+void PiLink::handle_frame() {
+  uint8_t kind = rx_frame[1];
+  uint8_t sequence = rx_frame[2];
+  uint8_t length = rx_frame[3];
+  const uint8_t* payload = rx_frame + FRAME_HEADER_LENGTH;
+  if ((kind & ~PI_FRAME_FIRST) == PI_FRAME_ACK) {
+    ack_received = true;
+    ack_sequence = sequence;
+    return;
+  }
+  if ((kind & ~PI_FRAME_FIRST) != PI_FRAME_DATA) {
+    bad_frames++;
+    return;
+  }
+
+  // Already delivered (our ack was lost): ack it again. A first frame starts a new session (the other side was
+  // restarted) unless it's the first frame of this session coming again
+  if (frame_received && sequence == receive_sequence && (!(kind & PI_FRAME_FIRST) || receive_first)) {
+    write_frame(PI_FRAME_ACK, sequence, nullptr, 0);
+    return;
+  }
+  // Count the messages first: if the inbox can't take them all, the frame isn't acked and comes again later
+  uint8_t message_count = 0;
+  for (uint16_t offset = 0; offset + 2 <= length; offset += 2 + payload[offset + 1]) {
+    if (offset + 2 + payload[offset + 1] > length || payload[offset + 1] > PI_LINK_MAX_MESSAGE) {
+      bad_frames++;
+      return;
+    }
+    message_count++;
+  }
+  if (inbox_count + message_count > PI_LINK_INBOX_SIZE) {
+    return;
+  }
+  for (uint16_t offset = 0; offset + 2 <= length; offset += 2 + payload[offset + 1]) {
+    PiMessage &message = inbox[(inbox_start + inbox_count) % PI_LINK_INBOX_SIZE];
+    message.type = payload[offset];
+    message.length = payload[offset + 1];
+    memcpy(message.body, payload + offset + 2, message.length);
+    inbox_count++;
+  }
+  frame_received = true;
+  receive_sequence = sequence;
+  receive_first = kind & PI_FRAME_FIRST;
+  write_frame(PI_FRAME_ACK, sequence, nullptr, 0);
+}
+
+bool PiLink::poll(PiMessage &message) {
+  receive();
+  if (inbox_count == 0) {
+    return false;
+  }
+  message = inbox[inbox_start];
+  inbox_start = (inbox_start + 1) % PI_LINK_INBOX_SIZE;
+  inbox_count--;
+  return true;
+}
+
+bool PiLink::wait_for(uint8_t type, PiMessage &message, uint32_t timeout_ms) {
+  unsigned long start = millis();
+  while (millis() - start < timeout_ms) {
+    if (poll(message) && message.type == type) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool PiLink::wait_for_engine_reply(uint8_t position_id, PiMessage &message, uint32_t timeout_ms) {
+  unsigned long start = millis();
+  while (millis() - start < timeout_ms) {
+    if (poll(message) && message.type == PI_MSG_ENGINE_REPLY && message.length >= 4 && message.body[3] == position_id) {
+      return true;
+    }
+  }
+  return false;
+}
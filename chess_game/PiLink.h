@@ -0,0 +1,139 @@
+// PiLink.h file
+
+#ifndef PI_LINK_H
+#define PI_LINK_H
+#include "PieceType.h"
+#include <stdint.h>
+#include <Arduino.h>
+
+// Framed message link between the board and the Raspberry Pi (stockfish), over a byte stream (the ESP32's UART)
+//
+// Frame: sync (0xA5), kind, sequence number, payload length, payload, CRC-16 (CCITT, of kind up to the payload,
+// low byte first). A data frame's payload is a batch of messages, each one type, length and body, so everything that
+// happens together (both players' configuration, a move and the position after it) goes in one frame.
+//
+// Every data frame is acknowledged with an ack frame carrying its sequence number. The sender waits for it
+// (PI_LINK_ACK_TIMEOUT_MS) and sends the same frame again up to PI_LINK_MAX_RETRIES times. A frame received twice
+// (its ack was lost) is acked again but only delivered once. Bytes that don't make a valid frame (bad CRC or
+// length, or nothing more for PI_LINK_BYTE_TIMEOUT_MS) are skipped up to the next sync byte.
+
+#define PI_LINK_SYNC 0xA5
+#define PI_LINK_MAX_PAYLOAD 240      // bytes of messages in one frame
+#define PI_LINK_MAX_MESSAGE 96       // longest message body (a FEN is at most 90 characters)
+#define PI_LINK_INBOX_SIZE 8         // received messages not read yet
+#define PI_LINK_ACK_TIMEOUT_MS 50
+#define PI_LINK_MAX_RETRIES 5
+#define PI_LINK_BYTE_TIMEOUT_MS 10   // a frame whose bytes stop coming for this long is dropped
+
+// Frame kinds
+#define PI_FRAME_DATA 1
+#define PI_FRAME_ACK 2
+#define PI_FRAME_FIRST 0x80  // flag on the first data frame after begin(): the receiver takes its sequence number as new
+
+// Message types
+enum PiMessageType : uint8_t {
+  PI_MSG_HELLO = 1,         // (no body) sent by the Pi once stockfish is running
+  PI_MSG_CONFIG = 2,        // color, is_human, difficulty: who plays a side (a side played by the board is a human for the Pi)
+  PI_MSG_MOVE = 3,          // from, to, promotion: a move that was played (promotion 0 none, 1 queen, 2 rook, 3 bishop, 4 knight)
+  PI_MSG_FEN = 4,           // position id, FEN string (no terminator): the position now, the Pi resyncs its board to it
+  PI_MSG_ENGINE_REPLY = 5   // from, to, promotion, position id: stockfish's move (promotion as PI_MSG_MOVE) in the
+                            // position of that id (so a late reply to an earlier position is never taken for this one)
+};
+
+// One received message
+struct PiMessage {
+  uint8_t type;
+  uint8_t length;
+  uint8_t body[PI_LINK_MAX_MESSAGE];
+};
+
+// The byte stream under the link (HardwareSerial on the board, an in-memory pipe on a PC)
+class PiChannel {
+  public:
+    virtual ~PiChannel() {}
+    // Number of bytes that can be read right away
+    virtual int available() = 0;
+    // Next byte (only called when available() > 0)
+    virtual int read() = 0;
+    virtual void write(const uint8_t* data, uint16_t length) = 0;
+};
+
+class PiLink {
+  public:
+    // Transfer counters, for benchmarks and the serial monitor
+    uint32_t frames_sent;
+    uint32_t retransmissions;
+    uint32_t bad_frames;  // CRC errors and frames cut short
+
+    PiLink();
+
+    // Starts the link on a channel (forgets the batch, the inbox and the sequence numbers)
+    void begin(PiChannel* link_channel);
+
+    // Adds a message to the outgoing batch, returns false if it doesn't fit (send the batch first)
+    bool add_message(uint8_t type, const uint8_t* body, uint8_t length);
+    bool add_config(bool color, bool is_human, uint8_t difficulty);
+    bool add_move(int8_t from, int8_t to, uint8_t promotion);
+    bool add_fen(uint8_t position_id, const char* fen);
+
+    // Sends the batch as one frame and waits for its ack, retrying, returns false if it was never acked
+    // Messages arriving in the meantime are kept in the inbox
+    bool send_batch();
+
+    // Reads whatever bytes have arrived (acking data frames), returns true and the oldest message if there is one
+    bool poll(PiMessage &message);
+
+    // Waits up to timeout_ms for a message of the given type (messages of other types are dropped)
+    bool wait_for(uint8_t type, PiMessage &message, uint32_t timeout_ms);
+
+    // Waits up to timeout_ms for the engine's reply in the position sent with position_id (other messages are dropped)
+    bool wait_for_engine_reply(uint8_t position_id, PiMessage &message, uint32_t timeout_ms);
+
+  private:
+    PiChannel* channel;
+    uint8_t batch[PI_LINK_MAX_PAYLOAD];
+    uint8_t batch_length;
+    uint8_t send_sequence;
+    bool first_frame_sent;
+    // Sequence number of the last data frame delivered, whether there was one since begin() and whether it was
+    // flagged first
+    uint8_t receive_sequence;
+    bool frame_received;
+    bool receive_first;
+    // Ack seen while receiving (send_batch waits for it)
+    bool ack_received;
+    uint8_t ack_sequence;
+
+    // Frame being parsed (rx_position is the next byte's offset in the frame, 0 while looking for a sync byte)
+    uint8_t rx_frame[PI_LINK_MAX_PAYLOAD + 6];
+    uint16_t rx_position;
+    unsigned long rx_last_byte_ms;
+
+    // Ring buffer of received messages
+    PiMessage inbox[PI_LINK_INBOX_SIZE];
+    uint8_t inbox_start;
+    uint8_t inbox_count;
+
+    void write_frame(uint8_t kind, uint8_t sequence, const uint8_t* payload, uint8_t length);
+    void receive();
+    // Handles the frame in rx_frame once it is complete, or drops it if it is broken
+    void check_frame();
+    // Drops the frame being parsed, keeping what was received after it from the next sync byte on
+    void drop_frame();
+    void handle_frame();
+};
+
+// CRC-16/CCITT-FALSE (polynomial 0x1021, starting at 0xFFFF)
+uint16_t pi_link_crc16(const uint8_t* data, uint16_t length);
+
+// Promotion code of PI_MSG_MOVE / PI_MSG_ENGINE_REPLY for a piece type (0 if it isn't one a pawn promotes to)
+uint8_t pi_promotion_code(PieceType type);
+// Piece type of a promotion code (EMPTY for 0 or an unknown code)
+PieceType pi_promotion_type(uint8_t code);
+
+// The board's promotion selection (chess_game.ino's promotion_joystick_selection: 0 queen, 1 knight, 2 bishop, 3 rook,
+// the order of the promotion LEDs), and back (0 for a type that isn't one)
+PieceType promotion_selection_type(int8_t selection);
+int8_t promotion_selection_of(PieceType type);
+
+#endif
@@ -8,236 +8,101 @@
 
 // The Piece Class
 
-// Define the static constexpr arrays
-constexpr int8_t Piece::knight_dx[];
-constexpr int8_t Piece::knight_dy[];
-
-PieceType Piece::get_type() {
+PieceType Piece::get_type() const {
   return type;
 }
 
-bool Piece::get_color() {
+bool Piece::get_color() const {
   return color;
 }
 
-int8_t Piece::get_x() {
+int8_t Piece::get_x() const {
   return x;
 }
 
-int8_t Piece::get_y() {
+int8_t Piece::get_y() const {
   return y;
 }
 
-bool Piece::get_double_move() {
+bool Piece::get_double_move() const {
   return double_move;
 }
-// Function that returns x,y coordinates of all possible moves
+// Function that adds all possible moves of this piece to moves (the list is not cleared first)
 // This move function does not check for any potential checks that might occur by this move.
 // The checks should be done by the board class - the board checks the board state after possible moves and evaluate if the move is legal
-std::vector<std::pair<int8_t, int8_t>> Piece::get_possible_moves(Board* board) const {
-  // TODO: WE COULD RETURN A vector<pair<pair,pair>> The first pair is destination, second is the piece that is taken
-  // TODO: can change this to a "board point8_ter" if we don't like passing the board as an argument
-  std::vector<std::pair<int8_t, int8_t>> moves;
+// Moves are generated from the board's bitboards and the precomputed attack tables (see Bitboard.h)
+void Piece::get_possible_moves(Board* board, MoveList<> &moves) const {
+  int8_t square = y * 8 + x;
+  uint64_t enemy = board->color_bitboards[!color];
+  // Destination squares, before removing squares occupied by our own pieces
+  uint64_t targets = 0;
+  // Flag added to every move in targets (pawns reaching the last row promote)
+  uint8_t flags = 0;
+
   // switch piece type
-  if (type==EMPTY) {
+  if (type == EMPTY) {
+    return;
   } else if (type == KING) {
-    for(int8_t i = y-1; i <= y+1; i++){
-      for(int8_t j = x-1; j <= x+1; j++){
-        if (i == y && j == x) continue;
-        // If square outside board, continue
-        if (i < 0 || i > 7 || j < 0 || j > 7) continue;
-
-        // If empty piece, or opponent piece, you can move there
-        if (board->pieces[i][j]->get_type() == EMPTY) {
-          moves.push_back(std::make_pair(i*8+j, -1)); // make a pair of destination, while capture square is (-1, -1) (no capture)
-        } else if (board->pieces[i][j]->get_color() != color) {
-          moves.push_back(std::make_pair(i*8+j, i*8+j)); // make a pair of destination and capture square, which is the same
-        } 
-      }
-    }
-    // Castling
+    targets = ATTACKS.king[square];
+    // Castling (destination only, the rook move is handled by move_piece)
+    // Check if squares between king and rook are empty
     if (color == 0) {
-      if (board->white_king_castle) {
-        // Check if squares between king and rook are empty
-        if (board->pieces[0][5]->get_type() == EMPTY && board->pieces[0][6]->get_type() == EMPTY) {
-          moves.push_back(std::make_pair(6, -1));
-        }
+      if (board->white_king_castle && !(board->occupied & (square_bit(5) | square_bit(6)))) {
+        moves.add(pack_move(square, 6, MOVE_CASTLE));
       }
-      if (board->white_queen_castle) {
-        // Check if squares between king and rook are empty
-        if (board->pieces[0][1]->get_type() == EMPTY && board->pieces[0][2]->get_type() == EMPTY && board->pieces[0][3]->get_type() == EMPTY) {
-          moves.push_back(std::make_pair(2, -1));
-        }
+      if (board->white_queen_castle && !(board->occupied & (square_bit(1) | square_bit(2) | square_bit(3)))) {
+        moves.add(pack_move(square, 2, MOVE_CASTLE));
       }
     } else {
-      if (board->black_king_castle) {
-        // Check if squares between king and rook are empty
-        if (board->pieces[7][5]->get_type() == EMPTY && board->pieces[7][6]->get_type() == EMPTY) {
-          moves.push_back(std::make_pair(62, -1));
-        }
+      if (board->black_king_castle && !(board->occupied & (square_bit(61) | square_bit(62)))) {
+        moves.add(pack_move(square, 62, MOVE_CASTLE));
       }
-      if (board->black_queen_castle) {
-        // Check if squares between king and rook are empty
-        if (board->pieces[7][1]->get_type() == EMPTY && board->pieces[7][2]->get_type() == EMPTY && board->pieces[7][3]->get_type() == EMPTY) {
-          moves.push_back(std::make_pair(58, -1));
-        }
+      if (board->black_queen_castle && !(board->occupied & (square_bit(57) | square_bit(58) | square_bit(59)))) {
+        moves.add(pack_move(square, 58, MOVE_CASTLE));
       }
     }
   } else if (type == QUEEN) {
-    // when encounter "edge of board", opponent piece, or own piece, stop
-    // Add opponent piece square to moves
-    for (int8_t dx = -1; dx <= 1; dx++) {
-      for (int8_t dy = -1; dy <= 1; dy++) {
-        if (dy == 0 && dx == 0) continue;
-        int8_t x_loop = x+dx;
-        int8_t y_loop = y+dy;
-        while (1) {
-          if (x_loop < 0 || y_loop < 0 || x_loop > 7 || y_loop > 7) break;  // if any coordinate is OOB, stop
-          if (board->pieces[y_loop][x_loop]->get_type() == EMPTY) {
-            // Empty square, no capture
-            moves.push_back(std::make_pair(y_loop * 8 + x_loop, -1));
-          } else if (board->pieces[y_loop][x_loop]->get_color() != color) {
-            // Enemy piece encountered; we can capture it, but don't look past it
-            moves.push_back(std::make_pair(y_loop * 8 + x_loop, y_loop * 8 + x_loop));
-            break;
-          } else {  // != EMPTY, == color
-            // Found a friendly piece; don't look past it
-            break;
-          }
-          // Look at the next coordinate in the current direction
-          x_loop += dx;
-          y_loop += dy;
-        }
-      }
-    }
+    // Rays stop at the first occupied square, which is included (capture or own piece, own pieces are removed below)
+    targets = queen_attacks(square, board->occupied);
   } else if (type == BISHOP) {
-    // Same as queen, but only 4 directions
-    for (int8_t dx = -1; dx <= 1; dx++) {
-      for (int8_t dy = -1; dy <= 1; dy++) {
-        if (dy == 0 && dx == 0) continue;
-        if (dy == 0 || dx == 0) continue; // only looking at diagonals
-        int8_t x_loop = x+dx;
-        int8_t y_loop = y+dy;
-        while (1) {
-          if (x_loop < 0 || y_loop < 0 || x_loop > 7 || y_loop > 7) break;  // if any coordinate is OOB, stop
-          if (board->pieces[y_loop][x_loop]->get_type() == EMPTY) {
-            moves.push_back(std::make_pair(y_loop * 8 + x_loop, -1));
-          } else if (board->pieces[y_loop][x_loop]->get_color() != color) {
-            // Enemy piece encountered; we can capture it, but don't look past it
-            moves.push_back(std::make_pair(y_loop * 8 + x_loop, y_loop * 8 + x_loop));
-            break;
-          } else {  // != EMPTY, == color
-            // Found a friendly piece; don't look past it
-            break;
-          }
-          // Look at the next coordinate in the current direction
-          x_loop += dx;
-          y_loop += dy;
-        }
-      }
-    }
+    targets = bishop_attacks(square, board->occupied);
   } else if (type == KNIGHT) {
-    // 8 possible moves - don't add if edge of board / own piece
-    
-    // Loop through all possible knight moves
-    for (int8_t knight_move_index = 0; knight_move_index < 8; knight_move_index++) {
-        int8_t newX = x + knight_dx[knight_move_index];
-        int8_t newY = y + knight_dy[knight_move_index];
-        
-        // Check if the move is within bounds of the board
-        if (newX >= 0 && newX < 8 && newY >= 0 && newY < 8) {
-            // If the square is empty or contains an opponent's piece
-            if (board->pieces[newY][newX]->get_type() == EMPTY) {
-                moves.push_back(std::make_pair(newY * 8 + newX, -1));
-            } else if (board->pieces[newY][newX]->get_color() != color) {
-                moves.push_back(std::make_pair(newY * 8 + newX, newY * 8 + newX));
-            }
-        }
-    }
+    targets = ATTACKS.knight[square];
   } else if (type == ROOK) {
-    // 4 possible directions - don't add if edge of board / own piece
-    for (int8_t dx = -1; dx <= 1; dx++) {
-      for (int8_t dy = -1; dy <= 1; dy++) {
-        if (dy == 0 && dx == 0) continue;
-        if (dy != 0 && dx != 0) continue; //if dy and dx are both nonzero, it's a diagonal
-        // loop in a direction to see valid moves
-        int8_t x_loop = x+dx;
-        int8_t y_loop = y+dy;
-        while (1) {
-          if (x_loop < 0 || y_loop < 0 || x_loop > 7 || y_loop > 7) break;  // if any coordinate is OOB, stop
-          if (board->pieces[y_loop][x_loop]->get_type() == EMPTY) {
-            moves.push_back(std::make_pair(y_loop * 8 + x_loop, -1));
-          } else if (board->pieces[y_loop][x_loop]->get_color() != color) {
-            // Enemy piece encountered; we can capture it, but don't look past it
-            moves.push_back(std::make_pair(y_loop * 8 + x_loop, y_loop * 8 + x_loop));
-            break;
-          } else {  // != EMPTY, == color
-            // Found a friendly piece; don't look past it
-            break;
-          }
-          // Look at the next coordinate in the current direction
-          x_loop += dx;
-          y_loop += dy;
-        }
-      }
-    }
+    targets = rook_attacks(square, board->occupied);
   } else if (type == PAWN) {
-    // TODO: Implement pawn moves
-
-    if (color == 0) { // White pawn. diagonally upwards
-      if (y+1 < 8 && x+1 < 8 && board->pieces[y+1][x+1]->get_type() != EMPTY && board->pieces[y+1][x+1]->get_color() != color) { // If the piece diagonally to the right is not empty
-        // When pushing a possible move, first pair is where the capturing
-        // piece goes, second pair is square of piece we captured
-        // In this case, it's the same
-        moves.push_back(std::make_pair((y+1)*8 + x+1, (y+1)*8 + x+1));
-      }
-      if (y+1 < 8 && x-1 >= 0 && board->pieces[y+1][x-1]->get_type() != EMPTY && board->pieces[y+1][x-1]->get_color() != color) { // If the piece diagonally to the right is opposite color
-        moves.push_back(std::make_pair((y+1)*8 + x-1, (y+1)*8 + x-1));
-      }
-        // Check if square immediately in front is empty (single move forward)
-      if (y+1 < 8 && board->pieces[y+1][x]->get_type() == EMPTY) {
-          moves.push_back(std::make_pair((y+1)*8 + x, -1));
-          
-          // Check if pawn can move 2 squares (first move only) and second square is also empty
-          if (double_move && y+2 < 8 && board->pieces[y+2][x]->get_type() == EMPTY) { // Initial position for white pawn
-              moves.push_back(std::make_pair((y+2)*8 + x, -1));
-          }
-      }
+    // Captures: diagonally forwards onto an enemy piece
+    targets = ATTACKS.pawn[color][square] & enemy;
 
-      // Capture moves (diagonally to the left and right)
-      if (x + 1 < 8 && y + 1 < 8 && board->pieces[y][x+1]->get_color() != color && board->en_passant_square_x == x+1 && board->en_passant_square_y == y) { // En passant to the right
-          moves.push_back(std::make_pair((y+1)*8 + x+1, (y)*8 + x+1));
-      }
-      if (x - 1 >= 0 && y + 1 < 8 && board->pieces[y][x-1]->get_color() != color && board->en_passant_square_x == x-1 && board->en_passant_square_y == y) { // En passant to the left
-          moves.push_back(std::make_pair((y+1)*8 + x-1, (y)*8 + x-1));
-      }
-    } else { // Black pawn. diagonally downwards
-      if (y-1 >= 0 && x+1 < 8 && board->pieces[y-1][x+1]->get_type() != EMPTY && board->pieces[y-1][x+1]->get_color() != color) { // If the piece diagonally to the right is not empty
-        moves.push_back(std::make_pair((y-1)*8 + x+1, (y-1)*8 + x+1));
-      }
-      if (y-1 >= 0 && x-1 >= 0 && board->pieces[y-1][x-1]->get_type() != EMPTY && board->pieces[y-1][x-1]->get_color() != color) { // If the piece diagonally to the right is opposite color
-        moves.push_back(std::make_pair((y-1)*8 + x-1, (y-1)*8 + x-1));
-      }
-      // Check if square immediately in front is empty (single move forward)
-      if (y-1 >= 0 && board->pieces[y-1][x]->get_type() == EMPTY) {
-          moves.push_back(std::make_pair((y-1)*8 + x, -1));
-
-          // Check if pawn can move 2 squares (first move only) and second square is also empty
-          if (double_move && y-2 >= 0 && board->pieces[y-2][x]->get_type() == EMPTY) { // Initial position for black pawn
-              moves.push_back(std::make_pair((y-2)*8 + x, -1));
-          }
+    // White pawns move up (y+1), black pawns move down (y-1). A pawn is never on its last rank here (it promotes).
+    int8_t forward = color == 0 ? 8 : -8;
+    if (y == (color == 0 ? 6 : 1)) {
+      flags = MOVE_PROMOTION;
+    }
+    // Check if square immediately in front is empty (single move forward)
+    if (!(board->occupied & square_bit(square + forward))) {
+      targets |= square_bit(square + forward);
+      // Check if pawn can move 2 squares (first move only, so it's still on its starting row) and second square is also empty
+      if (y == (color == 0 ? 1 : 6) && !(board->occupied & square_bit(square + 2 * forward))) {
+        targets |= square_bit(square + 2 * forward);
       }
+    }
 
-      // Capture moves (diagonally to the left and right)
-      if (x + 1 < 8 && y - 1 >= 0 && board->pieces[y][x+1]->get_color() != color && board->en_passant_square_x == x+1 && board->en_passant_square_y == y) { // En passant to the right
-          moves.push_back(std::make_pair((y-1)*8 + x+1, (y)*8 + x+1));
-      }
-      if (x - 1 >= 0 && y - 1 >= 0 && board->pieces[y][x-1]->get_color() != color && board->en_passant_square_x == x-1 && board->en_passant_square_y == y) { // En passant to the left
-          moves.push_back(std::make_pair((y-1)*8 + x-1, (y)*8 + x-1));
+    // En passant: the enemy pawn that can be taken is right beside this pawn
+    if (board->en_passant_square_y == y && abs(board->en_passant_square_x - x) == 1) {
+      int8_t en_passant_square = board->en_passant_square_y * 8 + board->en_passant_square_x;
+      if (enemy & square_bit(en_passant_square)) {
+        moves.add(pack_move(square, en_passant_square + forward, MOVE_CAPTURE | MOVE_EN_PASSANT));
       }
     }
   }
-  return moves;
+
+  // Can't move onto our own pieces
+  targets &= ~board->color_bitboards[color];
+  while (targets) {
+    int8_t destination = pop_lsb(targets);
+    moves.add(pack_move(square, destination, (enemy & square_bit(destination)) ? (flags | MOVE_CAPTURE) : flags));
+  }
 }
 
 // Constructor
@@ -246,5 +111,5 @@ Piece::Piece(PieceType new_type, bool new_color, int8_t new_x, int8_t new_y) {
   color = new_color;
   x = new_x;
   y = new_y;
-  double_move = true;
+  double_move = new_type == PAWN && new_y == (new_color == 0 ? 1 : 6);
 }
\ No newline at end of file
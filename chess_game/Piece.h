@@ -4,6 +4,7 @@
 // #include "ArduinoSTL.h"
 #include "Board.h"
 #include "PieceType.h"
+#include "Move.h"
 #include <stdint.h>
 #include <vector>
 #include <utility>
@@ -13,12 +14,9 @@
 class Board;
 
 // The Piece Class
+// A piece is not stored anywhere, it is a view of one square of the board (see Board::piece_at)
 class Piece {
   public:
-    // Knight move
-    static constexpr int8_t knight_dx[8] = {2, 2, -2, -2, 1, 1, -1, -1};
-    static constexpr int8_t knight_dy[8] = {1, -1, 1, -1, 2, -2, 2, -2};
-
     // Piece type:
     PieceType type;
     // Color of the piece:
@@ -26,22 +24,22 @@ class Piece {
     // X and Y coordinates of the piece: (-1, -1) for piece off grid
     int8_t x;
     int8_t y;
-    // Pawn: Double move flag - 1 if this pawn can move two squares
+    // Pawn: Double move flag - 1 if this pawn can move two squares (it is still on its starting row)
     bool double_move;
 
-    PieceType get_type();
+    PieceType get_type() const;
 
-    bool get_color();
+    bool get_color() const;
 
-    int8_t get_x();
+    int8_t get_x() const;
 
-    int8_t get_y();
+    int8_t get_y() const;
 
-    bool get_double_move();
+    bool get_double_move() const;
 
-    // Function that returns x,y coordinates of all possible moves
+    // Function that adds all possible moves of this piece to moves (not checked for leaving the king in check)
 
-    std::vector<std::pair<int8_t, int8_t>> get_possible_moves(Board* board) const;
+    void get_possible_moves(Board* board, MoveList<> &moves) const;
 
     // Constructor
 
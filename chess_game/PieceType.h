@@ -1,5 +1,7 @@
 #ifndef PIECETYPE_H
 #define PIECETYPE_H
+#include <stdint.h>
+
 enum PieceType {
   EMPTY,
   KING,
@@ -9,4 +11,20 @@ enum PieceType {
   ROOK,
   PAWN
 };
+
+// Material value of each piece type, in centipawns (the king is never captured, so it counts as 0)
+const int16_t PIECE_VALUE[7] = {0, 0, 900, 330, 320, 500, 100};
+
+// A square of the board as one byte: piece type in bits 0-2 (0 is EMPTY), color in bit 3 (0 for white, 1 for black)
+inline uint8_t square_code(PieceType type, bool color) {
+  return type == EMPTY ? 0 : type | (color << 3);
+}
+
+inline PieceType code_type(uint8_t code) {
+  return (PieceType)(code & 0x07);
+}
+
+inline bool code_color(uint8_t code) {
+  return code >> 3;
+}
 #endif
\ No newline at end of file
@@ -0,0 +1,426 @@
+#include "ResetPlanner.h"
+#include "Board.h"
+#include "Piece.h"
+#include "PieceType.h"
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+#include <utility>
+#include <Arduino.h>
+
+// Every piece moves at most once (32 pieces, 16 temp pieces), the parking of a cycle is part of its unit
+#define RESET_MAX_MOVES 48
+#define RESET_MAX_IMPROVE_PASSES 20
+
+static const int8_t PARK_SQUARES[2] = RESET_PARK_SQUARES;
+
+std::pair<int8_t, int8_t> graveyard_square(int8_t kind, bool color, int8_t count) {
+  if (color == 0) {
+    switch (kind) {
+      case 1: return std::make_pair(8, 7);  // only 1 queen can be captured
+      case 2: return std::make_pair(8, 6 - count);
+      case 3: return std::make_pair(8, 4 - count);
+      case 4: return std::make_pair(8, 2 - count);
+      case 5: return std::make_pair(9, 7 - count);
+      default: return std::make_pair(10, 7 - count);
+    }
+  }
+  switch (kind) {
+    case 1: return std::make_pair(-1, 0);
+    case 2: return std::make_pair(-1, 1 + count);
+    case 3: return std::make_pair(-1, 3 + count);
+    case 4: return std::make_pair(-1, 5 + count);
+    case 5: return std::make_pair(-2, count);
+    default: return std::make_pair(-3, count);
+  }
+}
+
+static void square_mm(int8_t square, float &x, float &y) {
+  int8_t column = square % 14 - 3;
+  x = column * RESET_MM_PER_SQUARE;
+  if (column < 0) {
+    x -= RESET_GRAVEYARD_GAP;
+  } else if (column > 7) {
+    x += RESET_GRAVEYARD_GAP;
+  }
+  y = (square / 14) * RESET_MM_PER_SQUARE;
+}
+
+static float carry_mm(int8_t from, int8_t to) {
+  float from_x, from_y, to_x, to_y;
+  square_mm(from, from_x, from_y);
+  square_mm(to, to_x, to_y);
+  return fabsf(to_x - from_x) + fabsf(to_y - from_y);
+}
+
+// Starting squares of a kind of piece, returns how many
+static uint8_t home_squares(PieceType type, bool color, int8_t* squares) {
+  int8_t row = color ? 7 : 0;
+  switch (type) {
+    case KING:
+      squares[0] = RESET_SQUARE(4, row);
+      return 1;
+    case QUEEN:
+      squares[0] = RESET_SQUARE(3, row);
+      return 1;
+    case ROOK:
+      squares[0] = RESET_SQUARE(0, row);
+      squares[1] = RESET_SQUARE(7, row);
+      return 2;
+    case BISHOP:
+      squares[0] = RESET_SQUARE(2, row);
+      squares[1] = RESET_SQUARE(5, row);
+      return 2;
+    case KNIGHT:
+      squares[0] = RESET_SQUARE(1, row);
+      squares[1] = RESET_SQUARE(6, row);
+      return 2;
+    case PAWN:
+      for (int8_t x = 0; x < 8; x++) {
+        squares[x] = RESET_SQUARE(x, color ? 6 : 1);
+      }
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+// Gantry position and distance so far, along a list of moves
+struct ResetWalk {
+  float x = RESET_CALIBRATE_X_MM;
+  float y = RESET_CALIBRATE_Y_MM;
+  uint8_t moves = 0;
+  float empty_mm = 0;
+  float carry_mm = 0;
+
+  void move(int8_t from, int8_t to) {
+    if (moves % RESET_CALIBRATE_EVERY == 0) {
+      empty_mm += hypotf(RESET_CALIBRATE_X_MM - x, RESET_CALIBRATE_Y_MM - y);
+      x = RESET_CALIBRATE_X_MM;
+      y = RESET_CALIBRATE_Y_MM;
+    }
+    float from_x, from_y;
+    square_mm(from, from_x, from_y);
+    empty_mm += hypotf(from_x - x, from_y - y);
+    carry_mm += ::carry_mm(from, to);
+    square_mm(to, x, y);
+    moves++;
+  }
+
+  float total_mm() const {
+    return empty_mm + carry_mm;
+  }
+};
+
+// One step of the order: a move, or a whole cycle entered by parking move (park: index in PARK_SQUARES, -1 if not)
+struct ResetUnit {
+  int8_t move;
+  int8_t park;
+};
+
+struct ResetPlan {
+  int8_t from[RESET_MAX_MOVES];
+  int8_t to[RESET_MAX_MOVES];
+  int8_t waits_for[RESET_MAX_MOVES];  // move that has to leave the destination first, -1 if it is empty
+  int8_t filler[RESET_MAX_MOVES];     // move that goes to this one's square once it left, -1 if none
+  bool in_cycle[RESET_MAX_MOVES];
+  uint8_t count = 0;
+
+  ResetUnit units[RESET_MAX_MOVES];
+  uint8_t unit_count = 0;
+
+  void walk_unit(const ResetUnit &unit, ResetWalk &walk, std::vector<std::pair<int8_t, int8_t>>* moves) const {
+    if (unit.park < 0) {
+      step(from[unit.move], to[unit.move], walk, moves);
+      return;
+    }
+    // Park the entry piece, the others follow each other into the square left empty, then it goes home
+    int8_t park = PARK_SQUARES[unit.park];
+    step(from[unit.move], park, walk, moves);
+    for (int8_t i = filler[unit.move]; i != unit.move; i = filler[i]) {
+      step(from[i], to[i], walk, moves);
+    }
+    step(park, to[unit.move], walk, moves);
+  }
+
+  float cost(const ResetUnit* order) const {
+    ResetWalk walk;
+    for (uint8_t i = 0; i < unit_count; i++) {
+      walk_unit(order[i], walk, nullptr);
+    }
+    return walk.total_mm();
+  }
+
+  // Every move comes after the one that empties its destination (cycles are emptied from within)
+  bool valid(const ResetUnit* order) const {
+    bool done[RESET_MAX_MOVES] = {false};
+    for (uint8_t i = 0; i < unit_count; i++) {
+      int8_t move = order[i].move;
+      if (order[i].park < 0 && waits_for[move] >= 0 && !done[waits_for[move]]) {
+        return false;
+      }
+      done[move] = true;
+    }
+    return true;
+  }
+
+  static void step(int8_t from, int8_t to, ResetWalk &walk, std::vector<std::pair<int8_t, int8_t>>* moves) {
+    walk.move(from, to);
+    if (moves) {
+      moves->push_back(std::make_pair(from, to));
+    }
+  }
+};
+
+// Matches pieces to starting squares (at most 8 of each) with the least total carrying distance, by trying every
+// subset of squares for the first pieces. to gets the square of each piece, there are at least as many squares
+static void assign_squares(const int8_t* pieces, uint8_t piece_count, const int8_t* squares, uint8_t square_count,
+                           int8_t* to) {
+  float best[1 << 8];
+  int8_t last[1 << 8];
+  uint16_t full = 1 << square_count;
+  for (uint16_t mask = 0; mask < full; mask++) {
+    best[mask] = INFINITY;
+  }
+  best[0] = 0;
+  uint16_t best_mask = 0;
+  for (uint16_t mask = 0; mask < full; mask++) {
+    if (best[mask] == INFINITY) {
+      continue;
+    }
+    uint8_t assigned = __builtin_popcount(mask);
+    if (assigned == piece_count) {
+      if (best_mask == 0 || best[mask] < best[best_mask]) {
+        best_mask = mask;
+      }
+      continue;
+    }
+    for (uint8_t i = 0; i < square_count; i++) {
+      if (mask & (1 << i)) {
+        continue;
+      }
+      float cost = best[mask] + carry_mm(pieces[assigned], squares[i]);
+      if (cost < best[mask | (1 << i)]) {
+        best[mask | (1 << i)] = cost;
+        last[mask | (1 << i)] = i;
+      }
+    }
+  }
+  for (uint16_t mask = best_mask; mask; mask &= ~(1 << last[mask])) {
+    to[__builtin_popcount(mask) - 1] = squares[last[mask]];
+  }
+}
+
+std::vector<std::pair<int8_t, int8_t>> plan_reset(const Board &board, int8_t* graveyard,
+                                                  const std::vector<std::pair<int8_t, int8_t>> &temp_pieces) {
+  ResetPlan plan;
+
+  // Temp pieces back to their graveyard column
+  bool is_temp[64] = {false};
+  for (uint8_t i = 0; i < temp_pieces.size(); i++) {
+    int8_t x = temp_pieces[i].first;
+    int8_t y = temp_pieces[i].second;
+    if (board.piece_at(x, y).type == EMPTY || is_temp[y * 8 + x] || plan.count >= RESET_MAX_MOVES) {
+      continue;
+    }
+    is_temp[y * 8 + x] = true;
+    bool color = board.piece_at(x, y).color;
+    std::pair<int8_t, int8_t> slot = graveyard_square(6, color, graveyard[10 + color]++);
+    plan.from[plan.count] = RESET_SQUARE(x, y);
+    plan.to[plan.count++] = RESET_SQUARE(slot.first, slot.second);
+  }
+
+  // Pieces already on one of their starting squares stay
+  bool taken[14 * 8] = {false};
+  int8_t homes[8];
+  for (int8_t square = 0; square < 64; square++) {
+    Piece piece = board.piece_at(square % 8, square / 8);
+    if (piece.type == EMPTY || is_temp[square]) {
+      continue;
+    }
+    uint8_t home_count = home_squares(piece.type, piece.color, homes);
+    for (uint8_t i = 0; i < home_count; i++) {
+      if (homes[i] == RESET_SQUARE(square % 8, square / 8)) {
+        taken[homes[i]] = true;
+      }
+    }
+  }
+
+  // The other pieces of each kind, on the board or in the graveyard, to the free starting squares of that kind
+  const PieceType types[6] = {KING, QUEEN, ROOK, BISHOP, KNIGHT, PAWN};
+  const int8_t graveyard_kind[6] = {0, 1, 2, 3, 4, 5};  // graveyard_square's kind, 0 for the king (never captured)
+  for (uint8_t color = 0; color < 2; color++) {
+    for (uint8_t t = 0; t < 6; t++) {
+      int8_t squares[8];
+      uint8_t square_count = 0;
+      uint8_t home_count = home_squares(types[t], color, homes);
+      for (uint8_t i = 0; i < home_count; i++) {
+        if (!taken[homes[i]]) {
+          squares[square_count++] = homes[i];
+        }
+      }
+      int8_t pieces[8];
+      uint8_t piece_count = 0;
+      for (int8_t square = 0; square < 64 && piece_count < square_count; square++) {
+        Piece piece = board.piece_at(square % 8, square / 8);
+        if (piece.type == types[t] && piece.color == color && !is_temp[square] &&
+            !taken[RESET_SQUARE(square % 8, square / 8)]) {
+          pieces[piece_count++] = RESET_SQUARE(square % 8, square / 8);
+        }
+      }
+      uint8_t from_graveyard = 0;
+      if (graveyard_kind[t]) {
+        int8_t index = graveyard_kind[t] - 1 + 5 * color;
+        while (from_graveyard < graveyard[index] && piece_count < square_count) {
+          std::pair<int8_t, int8_t> slot = graveyard_square(graveyard_kind[t], color, from_graveyard++);
+          pieces[piece_count++] = RESET_SQUARE(slot.first, slot.second);
+        }
+        graveyard[index] -= from_graveyard;
+      }
+      int8_t to[8];
+      assign_squares(pieces, piece_count, squares, square_count, to);
+      for (uint8_t i = 0; i < piece_count && plan.count < RESET_MAX_MOVES; i++) {
+        plan.from[plan.count] = pieces[i];
+        plan.to[plan.count++] = to[i];
+      }
+    }
+  }
+
+  // Who waits for whom, and which moves wait on each other in a cycle
+  for (uint8_t i = 0; i < plan.count; i++) {
+    plan.waits_for[i] = -1;
+    plan.filler[i] = -1;
+  }
+  for (uint8_t i = 0; i < plan.count; i++) {
+    for (uint8_t j = 0; j < plan.count; j++) {
+      if (plan.from[j] == plan.to[i]) {
+        plan.waits_for[i] = j;
+        plan.filler[j] = i;
+      }
+    }
+  }
+  for (uint8_t i = 0; i < plan.count; i++) {
+    int8_t j = plan.waits_for[i];
+    for (uint8_t length = 0; j >= 0 && j != i && length < plan.count; length++) {
+      j = plan.waits_for[j];
+    }
+    plan.in_cycle[i] = j == i;
+  }
+
+  // Nearest first: the move (or cycle) that adds the least distance from where the gantry is, among those that can go
+  bool done[RESET_MAX_MOVES] = {false};
+  ResetWalk walk;
+  while (true) {
+    ResetUnit best = {-1, -1};
+    float best_mm = INFINITY;
+    for (uint8_t i = 0; i < plan.count; i++) {
+      if (done[i] || (!plan.in_cycle[i] && plan.waits_for[i] >= 0 && !done[plan.waits_for[i]])) {
+        continue;
+      }
+      for (int8_t park = plan.in_cycle[i] ? 0 : -1; park < (plan.in_cycle[i] ? 2 : 0); park++) {
+        ResetUnit unit = {(int8_t)i, park};
+        ResetWalk next = walk;
+        plan.walk_unit(unit, next, nullptr);
+        if (next.total_mm() - walk.total_mm() < best_mm) {
+          best_mm = next.total_mm() - walk.total_mm();
+          best = unit;
+        }
+      }
+    }
+    if (best.move < 0) {
+      break;
+    }
+    plan.walk_unit(best, walk, nullptr);
+    done[best.move] = true;
+    if (best.park >= 0) {
+      for (int8_t i = plan.filler[best.move]; i != best.move; i = plan.filler[i]) {
+        done[i] = true;
+      }
+    }
+    plan.units[plan.unit_count++] = best;
+  }
+
+  // Improve: move a unit elsewhere, reverse a run of units, enter a cycle elsewhere, while it gets shorter
+  float best_mm = plan.cost(plan.units);
+  ResetUnit order[RESET_MAX_MOVES];
+  for (uint8_t pass = 0; pass < RESET_MAX_IMPROVE_PASSES; pass++) {
+    bool improved = false;
+    for (uint8_t i = 0; i < plan.unit_count; i++) {
+      for (uint8_t j = 0; j < plan.unit_count; j++) {
+        if (i == j) {
+          continue;
+        }
+        memcpy(order, plan.units, sizeof(ResetUnit) * plan.unit_count);
+        ResetUnit unit = order[i];
+        if (i < j) {
+          memmove(order + i, order + i + 1, sizeof(ResetUnit) * (j - i));
+        } else {
+          memmove(order + j + 1, order + j, sizeof(ResetUnit) * (i - j));
+        }
+        order[j] = unit;
+        float mm = plan.cost(order);
+        if (mm < best_mm - 0.01f && plan.valid(order)) {
+          memcpy(plan.units, order, sizeof(ResetUnit) * plan.unit_count);
+          best_mm = mm;
+          improved = true;
+        }
+      }
+    }
+    for (uint8_t i = 0; i + 1 < plan.unit_count; i++) {
+      for (uint8_t j = i + 1; j < plan.unit_count; j++) {
+        memcpy(order, plan.units, sizeof(ResetUnit) * plan.unit_count);
+        for (uint8_t a = i, b = j; a < b; a++, b--) {
+          ResetUnit unit = order[a];
+          order[a] = order[b];
+          order[b] = unit;
+        }
+        float mm = plan.cost(order);
+        if (mm < best_mm - 0.01f && plan.valid(order)) {
+          memcpy(plan.units, order, sizeof(ResetUnit) * plan.unit_count);
+          best_mm = mm;
+          improved = true;
+        }
+      }
+    }
+    for (uint8_t i = 0; i < plan.unit_count; i++) {
+      if (plan.units[i].park < 0) {
+        continue;
+      }
+      memcpy(order, plan.units, sizeof(ResetUnit) * plan.unit_count);
+      int8_t first = plan.units[i].move;
+      int8_t entry = first;
+      do {
+        for (int8_t park = 0; park < 2; park++) {
+          order[i] = {entry, park};
+          float mm = plan.cost(order);
+          if (mm < best_mm - 0.01f) {
+            plan.units[i] = order[i];
+            best_mm = mm;
+            improved = true;
+          }
+        }
+        entry = plan.filler[entry];
+      } while (entry != first);
+    }
+    if (!improved) {
+      break;
+    }
+  }
+
+  std::vector<std::pair<int8_t, int8_t>> moves;
+  ResetWalk final_walk;
+  for (uint8_t i = 0; i < plan.unit_count; i++) {
+    plan.walk_unit(plan.units[i], final_walk, &moves);
+  }
+  return moves;
+}
+
+float reset_moves_mm(const std::vector<std::pair<int8_t, int8_t>> &moves, float &carry) {
+  ResetWalk walk;
+  for (uint16_t i = 0; i < moves.size(); i++) {
+    walk.move(moves[i].first, moves[i].second);
+  }
+  carry = walk.carry_mm;
+  return walk.total_mm();
+}
@@ -0,0 +1,54 @@
+// ResetPlanner.h file
+
+#ifndef RESET_PLANNER_H
+#define RESET_PLANNER_H
+#include "Board.h"
+#include "PieceType.h"
+#include <stdint.h>
+#include <vector>
+#include <utility>
+#include <Arduino.h>
+
+// Plans the gantry moves that put every piece back on its starting square after a game (reset_board in chess_game.ino)
+//
+// Squares of the playing area are (y * 14 + 3) + x, x from -3 to 10 (the graveyards are outside 0 to 7), y 0 to 7
+// Every piece off its starting squares gets one: pieces of the same kind and color are matched to the free starting
+// squares of their kind so the carrying distance is the least (two rooks, eight pawns...), the temp pieces go back to
+// their graveyard column. A piece can only move to an empty square, so a move waits for the piece on its destination
+// to leave. Pieces that wait on each other in a cycle park one of them first (RESET_PARK_SQUARES) and move it last.
+// The moves are ordered nearest first from where the gantry is, then improved by moving single moves (or whole cycles)
+// elsewhere in the order and reversing runs of moves while the total distance goes down.
+//
+// Distances are in mm: the gantry goes from one move's end to the next one's start in a straight line, and carries a
+// piece along the square edges (about the taxicab distance). GAME_RESET calibrates before every RESET_CALIBRATE_EVERY
+// moves, which takes the gantry back to the graveyard corner first.
+
+#define RESET_SQUARE(x, y) ((y) * 14 + 3 + (x))
+#define RESET_CALIBRATE_EVERY 5
+// Same as arduino_subordinate.ino
+#define RESET_MM_PER_SQUARE 66.7f
+#define RESET_GRAVEYARD_GAP 10.0f
+// Where the gantry is after a calibration (x, y in mm)
+#define RESET_CALIBRATE_X_MM (-3 * RESET_MM_PER_SQUARE)
+#define RESET_CALIBRATE_Y_MM 0.0f
+// Free squares of the graveyards (no piece has its slot there)
+#define RESET_PARK_SQUARES {RESET_SQUARE(8, 0), RESET_SQUARE(-1, 7)}
+
+// Graveyard square of a piece, kind: 1 for queen, 2 for rook, 3 for bishop, 4 for knight, 5 for pawn, 6 for temp piece
+// count is the number of pieces of that kind and color in the graveyard before it (chess_game.ino's graveyard[])
+// White is on the right: queen (8, 7), rooks (8, 6) and (8, 5), bishops (8, 4) and (8, 3), knights (8, 2) and
+// (8, 1), pawns (9, 7 to 0), temp pieces (10, 7 to 0). Black mirrors it on the left: queen (-1, 0), rooks (-1, 1)
+// and (-1, 2), bishops (-1, 3) and (-1, 4), knights (-1, 5) and (-1, 6), pawns (-2, 0 to 7), temp pieces (-3, 0 to 7)
+std::pair<int8_t, int8_t> graveyard_square(int8_t kind, bool color, int8_t count);
+
+// Moves (from, to) that reset the board, in the order to run them (RESET_CALIBRATE_EVERY per calibration)
+// graveyard: chess_game.ino's graveyard[] (0 to 4 white queen to pawn, 5 to 9 black, 10 and 11 the temp pieces
+// left), updated to what the moves leave there
+// temp_pieces: (x, y) of the promoted pawns standing in as temp pieces
+std::vector<std::pair<int8_t, int8_t>> plan_reset(const Board &board, int8_t* graveyard,
+                                                  const std::vector<std::pair<int8_t, int8_t>> &temp_pieces);
+
+// Distance in mm the gantry travels for moves (with the calibrations), empty and carrying a piece
+float reset_moves_mm(const std::vector<std::pair<int8_t, int8_t>> &moves, float &carry_mm);
+
+#endif
@@ -0,0 +1,423 @@
+#include "Search.h"
+#include "Board.h"
+#include "Move.h"
+#include <stdint.h>
+#include <Arduino.h>
+
+// Piece-square tables, in centipawns, for white (the first row is row 8, so a white piece on square s uses entry s ^ 56,
+// a black piece uses entry s as it is). Indexed by PieceType, the KING entry is for the middle game
+static const int8_t PIECE_SQUARE[7][64] = {
+  // EMPTY
+  {0},
+  // KING (middle game: stay behind the pawns)
+  {-30, -40, -40, -50, -50, -40, -40, -30,
+   -30, -40, -40, -50, -50, -40, -40, -30,
+   -30, -40, -40, -50, -50, -40, -40, -30,
+   -30, -40, -40, -50, -50, -40, -40, -30,
+   -20, -30, -30, -40, -40, -30, -30, -20,
+   -10, -20, -20, -20, -20, -20, -20, -10,
+    20,  20,   0,   0,   0,   0,  20,  20,
+    20,  30,  10,   0,   0,  10,  30,  20},
+  // QUEEN
+  {-20, -10, -10,  -5,  -5, -10, -10, -20,
+   -10,   0,   0,   0,   0,   0,   0, -10,
+   -10,   0,   5,   5,   5,   5,   0, -10,
+    -5,   0,   5,   5,   5,   5,   0,  -5,
+     0,   0,   5,   5,   5,   5,   0,  -5,
+   -10,   5,   5,   5,   5,   5,   0, -10,
+   -10,   0,   5,   0,   0,   0,   0, -10,
+   -20, -10, -10,  -5,  -5, -10, -10, -20},
+  // BISHOP
+  {-20, -10, -10, -10, -10, -10, -10, -20,
+   -10,   0,   0,   0,   0,   0,   0, -10,
+   -10,   0,   5,  10,  10,   5,   0, -10,
+   -10,   5,   5,  10,  10,   5,   5, -10,
+   -10,   0,  10,  10,  10,  10,   0, -10,
+   -10,  10,  10,  10,  10,  10,  10, -10,
+   -10,   5,   0,   0,   0,   0,   5, -10,
+   -20, -10, -10, -10, -10, -10, -10, -20},
+  // KNIGHT
+  {-50, -40, -30, -30, -30, -30, -40, -50,
+   -40, -20,   0,   0,   0,   0, -20, -40,
+   -30,   0,  10,  15,  15,  10,   0, -30,
+   -30,   5,  15,  20,  20,  15,   5, -30,
+   -30,   0,  15,  20,  20,  15,   0, -30,
+   -30,   5,  10,  15,  15,  10,   5, -30,
+   -40, -20,   0,   5,   5,   0, -20, -40,
+   -50, -40, -30, -30, -30, -30, -40, -50},
+  // ROOK
+  {  0,   0,   0,   0,   0,   0,   0,   0,
+     5,  10,  10,  10,  10,  10,  10,   5,
+    -5,   0,   0,   0,   0,   0,   0,  -5,
+    -5,   0,   0,   0,   0,   0,   0,  -5,
+    -5,   0,   0,   0,   0,   0,   0,  -5,
+    -5,   0,   0,   0,   0,   0,   0,  -5,
+    -5,   0,   0,   0,   0,   0,   0,  -5,
+     0,   0,   0,   5,   5,   0,   0,   0},
+  // PAWN
+  {  0,   0,   0,   0,   0,   0,   0,   0,
+    50,  50,  50,  50,  50,  50,  50,  50,
+    10,  10,  20,  30,  30,  20,  10,  10,
+     5,   5,  10,  25,  25,  10,   5,   5,
+     0,   0,   0,  20,  20,   0,   0,   0,
+     5,  -5, -10,   0,   0, -10,  -5,   5,
+     5,  10,  10, -20, -20,  10,  10,   5,
+     0,   0,   0,   0,   0,   0,   0,   0},
+};
+
+// King table once the queens are off: walk to the center
+static const int8_t KING_ENDGAME_SQUARE[64] = {
+  -50, -40, -30, -20, -20, -30, -40, -50,
+  -30, -20, -10,   0,   0, -10, -20, -30,
+  -30, -10,  20,  30,  30,  20, -10, -30,
+  -30, -10,  30,  40,  40,  30, -10, -30,
+  -30, -10,  30,  40,  40,  30, -10, -30,
+  -30, -10,  20,  30,  30,  20, -10, -30,
+  -30, -30,   0,   0,   0,   0, -30, -30,
+  -50, -30, -30, -30, -30, -30, -30, -50,
+};
+
+Move Search::find_best_move(Board* search_board, uint32_t time_budget_ms, int8_t max_depth) {
+  if (start_search(search_board, max_depth)) {
+    continue_search(time_budget_ms);
+  }
+  return best_move;
+}
+
+bool Search::start_search(Board* search_board, int8_t max_depth) {
+  board = search_board;
+  nodes = 0;
+  stopped = false;
+  completed_depth = 0;
+  best_score = 0;
+  if (max_depth >= SEARCH_MAX_PLY) {
+    max_depth = SEARCH_MAX_PLY - 1;
+  }
+  target_depth = max_depth;
+  iteration_depth = 1;
+  root_index = 0;
+
+  // Root moves, ordered once by MVV-LVA (later iterations put the previous best move first)
+  uint64_t checkers;
+  LegalMoveList &root_moves = ply_moves[0];
+  board->generate_legal_moves(board->side_to_move, root_moves, checkers);
+  if (root_moves.list.size() == 0) {
+    best_move = 0;
+    return false;
+  }
+  // A position already reached by an earlier search (e.g. the previous computer move) starts with its stored best move
+  // Searching the same position again (the move after a ponder hit) keeps the entries' age
+  if (board->zobrist_hash != last_root_hash) {
+    table.new_search();
+    last_root_hash = board->zobrist_hash;
+  }
+  TTEntry* entry = table.probe(board->zobrist_hash);
+  order_moves(root_moves.list, entry ? entry->best_move : 0);
+  // If not even depth 1 finishes, still play something
+  best_move = root_moves.list[0];
+  return true;
+}
+
+bool Search::continue_search(uint32_t time_budget_ms, uint16_t search_clock_mask) {
+  stopped = false;
+  deadline = millis() + time_budget_ms;
+  clock_mask = search_clock_mask;
+  LegalMoveList &root_moves = ply_moves[0];
+
+  // Iterative deepening: each depth starts with the best move of the previous one, which makes the cutoffs come early
+  while (iteration_depth <= target_depth) {
+    if (root_index == 0) {
+      order_moves(root_moves.list, best_move);
+      root_alpha = -SEARCH_INFINITY;
+      iteration_best = root_moves.list[0];
+    }
+    for (; root_index < root_moves.list.size(); root_index++) {
+      Move move = root_moves.list[root_index];
+      board->make_move(move, (move_flags(move) & MOVE_PROMOTION) ? QUEEN : EMPTY);
+      int16_t score = -alpha_beta(-SEARCH_INFINITY, -root_alpha, iteration_depth - 1, 1);
+      board->unmake_move();
+      // Out of time: this root move starts over on the next call (the table still has the parts that finished),
+      // and until the depth is done the result of the last full one is kept
+      if (stopped) {
+        return false;
+      }
+      if (score > root_alpha) {
+        root_alpha = score;
+        iteration_best = move;
+      }
+    }
+    best_move = iteration_best;
+    best_score = root_alpha;
+    completed_depth = iteration_depth;
+    table.store(board->zobrist_hash, iteration_depth, root_alpha, TT_BOUND_EXACT, best_move);
+    iteration_depth++;
+    root_index = 0;
+    // A forced mate was found, searching deeper won't change the move
+    if (root_alpha > SEARCH_MATE_SCORE - SEARCH_MAX_PLY || root_alpha < -SEARCH_MATE_SCORE + SEARCH_MAX_PLY) {
+      break;
+    }
+  }
+  return true;
+}
+
+void Search::difficulty_limits(uint8_t comp_diff, uint32_t &time_budget_ms, int8_t &max_depth) {
+  // Difficulty 0 looks 1 move ahead, every 3 levels add a ply (7 plies at level 18, 19)
+  // The time budget grows with it, from 0.2 s up to about 3 s, and is a hard limit whatever the depth reached
+  max_depth = 1 + comp_diff / 3;
+  time_budget_ms = 200 + 150 * (uint32_t)comp_diff;
+}
+
+int16_t Search::evaluate() {
+  // Material is kept up to date by the board, only the piece-square part is added up here
+  bool color = board->side_to_move;
+  int16_t score = board->material[color] - board->material[!color];
+  bool endgame = board->piece_counts[0][QUEEN] == 0 && board->piece_counts[1][QUEEN] == 0;
+  for (int8_t side = 0; side < 2; side++) {
+    int16_t side_score = 0;
+    uint64_t pieces = board->color_bitboards[side];
+    while (pieces) {
+      int8_t square = pop_lsb(pieces);
+      // White reads the tables upside down (they are written with row 8 first)
+      int8_t index = side == 0 ? square ^ 56 : square;
+      PieceType type = code_type(board->squares[square]);
+      side_score += (type == KING && endgame) ? KING_ENDGAME_SQUARE[index] : PIECE_SQUARE[type][index];
+    }
+    score += side == color ? side_score : -side_score;
+  }
+  return score;
+}
+
+int16_t Search::alpha_beta(int16_t alpha, int16_t beta, int8_t depth, int8_t ply) {
+  if (out_of_time()) {
+    return 0;
+  }
+  // Draws (same rules as the game: 50 move counter, insufficient material, repetition)
+  if (board->draw_move_counter >= 50 || board->is_insufficient_material() || is_repetition()) {
+    return 0;
+  }
+  // KPK, KRK and KQK are settled by the bitbases: a draw is final, a win is still searched (to find the mate or
+  // the promotion) but its leaves score as a known win instead of going into quiescence
+  int8_t bitbase_result = board->probe_bitbase();
+  if (bitbase_result == BITBASE_DRAW) {
+    return 0;
+  }
+  if (depth <= 0 || ply >= SEARCH_MAX_PLY - 1) {
+    if (bitbase_result != BITBASE_NOT_FOUND) {
+      return known_win_score(bitbase_result == BITBASE_WIN ? board->side_to_move : !board->side_to_move);
+    }
+    return quiescence(alpha, beta, ply);
+  }
+  nodes++;
+
+  // A result from the table is used as it is if it was searched at least as deep, and its bound settles the window
+  // Otherwise its best move is still the best guess, and is searched first
+  Move table_move = 0;
+  TTEntry* entry = table.probe(board->zobrist_hash);
+  if (entry) {
+    table_move = entry->best_move;
+    if (entry->depth >= depth) {
+      int16_t table_score = score_from_table(entry->score, ply);
+      if (entry->bound() == TT_BOUND_EXACT ||
+          (entry->bound() == TT_BOUND_LOWER && table_score >= beta) ||
+          (entry->bound() == TT_BOUND_UPPER && table_score <= alpha)) {
+        return table_score;
+      }
+    }
+  }
+
+  uint64_t checkers;
+  LegalMoveList &moves = ply_moves[ply];
+  board->generate_legal_moves(board->side_to_move, moves, checkers);
+  if (moves.list.size() == 0) {
+    // Checkmate (sooner is worse) or stalemate
+    return checkers ? -SEARCH_MATE_SCORE + ply : 0;
+  }
+  order_moves(moves.list, table_move);
+
+  int16_t original_alpha = alpha;
+  Move node_best_move = 0;
+  for (uint16_t i = 0; i < moves.list.size(); i++) {
+    Move move = moves.list[i];
+    board->make_move(move, (move_flags(move) & MOVE_PROMOTION) ? QUEEN : EMPTY);
+    int16_t score = -alpha_beta(-beta, -alpha, depth - 1, ply + 1);
+    board->unmake_move();
+    if (stopped) {
+      return 0;
+    }
+    if (score >= beta) {
+      // The opponent won't allow this line
+      table.store(board->zobrist_hash, depth, score_to_table(beta, ply), TT_BOUND_LOWER, move);
+      return beta;
+    }
+    if (score > alpha) {
+      alpha = score;
+      node_best_move = move;
+    }
+  }
+  table.store(board->zobrist_hash, depth, score_to_table(alpha, ply),
+              alpha > original_alpha ? TT_BOUND_EXACT : TT_BOUND_UPPER, node_best_move);
+  return alpha;
+}
+
+int16_t Search::known_win_score(bool strong_color) {
+  // Progress towards the mate: the lone king pushed to the edge, the kings close together, the pawn (if any) advanced
+  int8_t strong_king = lsb(board->piece_bitboards[strong_color][KING]);
+  int8_t weak_king = lsb(board->piece_bitboards[!strong_color][KING]);
+  int8_t king_distance = max(abs(strong_king % 8 - weak_king % 8), abs(strong_king / 8 - weak_king / 8));
+  int16_t score = SEARCH_KNOWN_WIN_SCORE + board->material[strong_color] - board->material[!strong_color];
+  score += 20 * (7 - king_distance) - KING_ENDGAME_SQUARE[weak_king];
+  if (board->piece_bitboards[strong_color][PAWN]) {
+    int8_t pawn_row = lsb(board->piece_bitboards[strong_color][PAWN]) / 8;
+    score += 20 * (strong_color == 0 ? pawn_row : 7 - pawn_row);
+  }
+  return board->side_to_move == strong_color ? score : -score;
+}
+
+// Mate scores count plies from the root, but an entry can be reached at another ply:
+// the table keeps them counted from the position itself
+int16_t Search::score_to_table(int16_t score, int8_t ply) {
+  if (score > SEARCH_MATE_SCORE - SEARCH_MAX_PLY) {
+    return score + ply;
+  }
+  if (score < -SEARCH_MATE_SCORE + SEARCH_MAX_PLY) {
+    return score - ply;
+  }
+  return score;
+}
+
+int16_t Search::score_from_table(int16_t score, int8_t ply) {
+  if (score > SEARCH_MATE_SCORE - SEARCH_MAX_PLY) {
+    return score - ply;
+  }
+  if (score < -SEARCH_MATE_SCORE + SEARCH_MAX_PLY) {
+    return score + ply;
+  }
+  return score;
+}
+
+int16_t Search::quiescence(int16_t alpha, int16_t beta, int8_t ply) {
+  if (out_of_time()) {
+    return 0;
+  }
+  nodes++;
+
+  // In check every evasion is searched (and no move is mate), otherwise the side to move can stand pat:
+  // it doesn't have to capture, so the evaluation is a lower bound and only captures and promotions are tried
+  bool in_check = board->sources_of_check(board->side_to_move) != 0;
+  if (!in_check) {
+    int16_t stand_pat = evaluate();
+    if (stand_pat >= beta) {
+      return beta;
+    }
+    if (stand_pat > alpha) {
+      alpha = stand_pat;
+    }
+  }
+  if (ply >= SEARCH_MAX_PLY - 1) {
+    return in_check ? evaluate() : alpha;
+  }
+
+  uint64_t checkers;
+  LegalMoveList &moves = ply_moves[ply];
+  board->generate_legal_moves(board->side_to_move, moves, checkers);
+  uint16_t i = 0;
+  if (in_check) {
+    if (moves.list.size() == 0) {
+      return -SEARCH_MATE_SCORE + ply;
+    }
+  } else {
+    // Only keep captures and promotions
+    while (i < moves.list.size()) {
+      if (move_flags(moves.list[i]) & (MOVE_CAPTURE | MOVE_PROMOTION)) {
+        i++;
+      } else {
+        moves.list.remove(i);
+      }
+    }
+  }
+  order_moves(moves.list, 0);
+
+  for (i = 0; i < moves.list.size(); i++) {
+    Move move = moves.list[i];
+    board->make_move(move, (move_flags(move) & MOVE_PROMOTION) ? QUEEN : EMPTY);
+    int16_t score = -quiescence(-beta, -alpha, ply + 1);
+    board->unmake_move();
+    if (stopped) {
+      return 0;
+    }
+    if (score >= beta) {
+      return beta;
+    }
+    if (score > alpha) {
+      alpha = score;
+    }
+  }
+  return alpha;
+}
+
+// Ordering key of a move: captures by MVV-LVA, promotions by the queen they make, quiet moves 0
+static int16_t move_order_key(Board* board, Move move) {
+  int16_t key = 0;
+  uint8_t flags = move_flags(move);
+  if (flags & MOVE_CAPTURE) {
+    PieceType victim = (flags & MOVE_EN_PASSANT) ? PAWN : code_type(board->squares[move_to(move)]);
+    PieceType attacker = code_type(board->squares[move_from(move)]);
+    key += 10 * PIECE_VALUE[victim] - PIECE_VALUE[attacker];
+  }
+  if (flags & MOVE_PROMOTION) {
+    key += PIECE_VALUE[QUEEN];
+  }
+  return key;
+}
+
+void Search::order_moves(MoveList<> &moves, Move first_move) {
+  // Insertion sort, highest key first (move lists are short, and mostly quiet moves with key 0)
+  for (uint16_t i = 1; i < moves.size(); i++) {
+    Move move = moves.moves[i];
+    int16_t key = move_order_key(board, move);
+    uint16_t j = i;
+    while (j > 0 && move_order_key(board, moves.moves[j - 1]) < key) {
+      moves.moves[j] = moves.moves[j - 1];
+      j--;
+    }
+    moves.moves[j] = move;
+  }
+  // Then bring first_move to the front, keeping the order of the rest
+  for (uint16_t i = 0; first_move && i < moves.size(); i++) {
+    if (moves.moves[i] == first_move) {
+      for (uint16_t j = i; j > 0; j--) {
+        moves.moves[j] = moves.moves[j - 1];
+      }
+      moves.moves[0] = first_move;
+      break;
+    }
+  }
+}
+
+bool Search::is_repetition() {
+  // k plies back is undo_stack[undo_count - k] while that is on the undo stack (the search, and a pondered move),
+  // and the game's repetition_history before that (its current entry is the position before the first make_move),
+  // as far back as it was recorded
+  // Only positions with the same side to move (every second ply) and after the last pawn move or capture can match
+  for (int8_t k = 2; k <= board->draw_move_counter; k += 2) {
+    uint64_t hash;
+    if (k <= board->undo_count) {
+      hash = board->undo_stack[board->undo_count - k].zobrist_hash;
+    } else if (k - board->undo_count < board->repetition_count) {
+      hash = board->repetition_history[(board->repetition_index - (k - board->undo_count)) & (REPETITION_HISTORY_SIZE - 1)];
+    } else {
+      break;
+    }
+    if (hash == board->zobrist_hash) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool Search::out_of_time() {
+  if (!stopped && (nodes & clock_mask) == 0 && (long)(millis() - deadline) >= 0) {
+    stopped = true;
+  }
+  return stopped;
+}
@@ -0,0 +1,106 @@
+// Search.h file
+
+#ifndef SEARCH_H
+#define SEARCH_H
+#include "Board.h"
+#include "Move.h"
+#include "PieceType.h"
+#include "TranspositionTable.h"
+#include <stdint.h>
+#include <Arduino.h>
+
+// Deepest ply the search (including quiescence) can reach, also the number of move lists kept (each about 580 bytes)
+// Has to stay below MAX_UNDO_DEPTH, since every ply is a make_move
+#define SEARCH_MAX_PLY 24
+
+// The clock is read when nodes & clock_mask is 0: every 256 nodes by default (a few milliseconds on the ESP32),
+// a slice of pondering passes a smaller mask so it doesn't run that far past its few milliseconds
+#define SEARCH_CLOCK_MASK 255
+
+// Score of being checkmated at the root (mates closer to the root score higher)
+#define SEARCH_MATE_SCORE 30000
+#define SEARCH_INFINITY 32000
+// Base score of a position the endgame bitbases say is won (below every mate score)
+#define SEARCH_KNOWN_WIN_SCORE 20000
+
+// Computer difficulties (comp_diff, 0 to 19) up to this one are played by the board itself,
+// higher ones are sent to stockfish on the Pi (when USING_STOCKFISH is on)
+#define LOCAL_ENGINE_MAX_DIFFICULTY 9
+
+// On-device chess engine: iterative deepening alpha-beta with quiescence search, searching on the Board in place
+// with make_move / unmake_move (the board is back to where it started when the search returns)
+// Everything it needs is inside the object (a move list per ply, the transposition table), so it should be a static/global variable
+class Search {
+  public:
+    // Board being searched
+    Board* board;
+    // Move list of every ply (ply 0 is the root)
+    LegalMoveList ply_moves[SEARCH_MAX_PLY];
+    // Results of positions already searched, kept between searches (call table.init() from setup() to use PSRAM)
+    TranspositionTable table;
+    // Position the last search started from (the table is only aged when a new position is searched)
+    uint64_t last_root_hash;
+    // Positions visited by the current search
+    uint32_t nodes;
+    // millis() value at which the search has to stop
+    unsigned long deadline;
+    // Set once the time is up, every ply then returns straight away
+    bool stopped;
+    // The clock is read every clock_mask + 1 nodes (a power of 2)
+    uint16_t clock_mask;
+    // Result of the deepest fully searched iteration
+    Move best_move;
+    int16_t best_score;
+    int8_t completed_depth;
+    // Where an unfinished search is, so continue_search can pick it up: the iteration being searched, the next root move
+    // to search and the best of the root moves already searched in that iteration
+    int8_t target_depth;
+    int8_t iteration_depth;
+    uint16_t root_index;
+    int16_t root_alpha;
+    Move iteration_best;
+
+    // Finds the best move for the side to move, searching deeper until max_depth is done or time_budget_ms runs out
+    // Promotions are always made to a queen
+    // Returns 0 if the side to move has no legal moves
+    Move find_best_move(Board* search_board, uint32_t time_budget_ms, int8_t max_depth);
+
+    // The same search split into time slices (for pondering): start_search sets it up (false if there are no legal moves),
+    // then each continue_search call searches for at most time_budget_ms and returns true once max_depth is done
+    // (it can run over by the nodes between two reads of the clock, see SEARCH_CLOCK_MASK)
+    // The board has to be in the same position for every call (best_move always holds the best move found so far)
+    bool start_search(Board* search_board, int8_t max_depth);
+    bool continue_search(uint32_t time_budget_ms, uint16_t search_clock_mask = SEARCH_CLOCK_MASK);
+
+    // Time budget and depth for a computer difficulty (comp_diff, 0 to 19)
+    static void difficulty_limits(uint8_t comp_diff, uint32_t &time_budget_ms, int8_t &max_depth);
+
+    // Static evaluation in centipawns, from the side to move's point of view (material and piece-square tables)
+    int16_t evaluate();
+
+    // Score of a bitbase win for strong_color, from the side to move's point of view
+    // Higher for positions closer to the mate / promotion, so the search makes progress instead of shuffling
+    int16_t known_win_score(bool strong_color);
+
+    // Negamax alpha-beta search, drops into quiescence at depth 0
+    int16_t alpha_beta(int16_t alpha, int16_t beta, int8_t depth, int8_t ply);
+
+    // Searches captures and promotions only, so the evaluation isn't taken in the middle of an exchange
+    int16_t quiescence(int16_t alpha, int16_t beta, int8_t ply);
+
+    // Mate scores are stored in the table relative to the position instead of the root
+    static int16_t score_to_table(int16_t score, int8_t ply);
+    static int16_t score_from_table(int16_t score, int8_t ply);
+
+    // Sorts moves so the likely best come first: first_move (if found), then captures by MVV-LVA
+    // (most valuable victim, least valuable attacker) and promotions, then the quiet moves
+    void order_moves(MoveList<> &moves, Move first_move);
+
+    // Checks if the position already happened since the last pawn move or capture (in the search or in the game)
+    bool is_repetition();
+
+    // Checks the clock every clock_mask + 1 nodes, and sets stopped once the deadline has passed
+    bool out_of_time();
+};
+
+#endif
@@ -0,0 +1,94 @@
+#include "TranspositionTable.h"
+#include "Move.h"
+#include <stdint.h>
+#include <string.h>
+#include <Arduino.h>
+
+// Static table in SRAM: always there, so the table works even if init() isn't called or PSRAM allocation fails
+#ifdef BOARD_HAS_PSRAM
+#define TT_STATIC_SIZE_BITS 8
+#else
+#define TT_STATIC_SIZE_BITS TT_SIZE_BITS
+#endif
+static TTEntry static_entries[1UL << TT_STATIC_SIZE_BITS];
+
+TranspositionTable::TranspositionTable() : entries(static_entries), mask((1UL << TT_STATIC_SIZE_BITS) - 1), age(0) {}
+
+bool TranspositionTable::init() {
+  bool allocated = true;
+#ifdef BOARD_HAS_PSRAM
+  // Allocated once for the whole uptime, a new game only clears it
+  if (entries == static_entries) {
+    TTEntry* psram_entries = (TTEntry*)ps_malloc(sizeof(TTEntry) << TT_SIZE_BITS);
+    if (psram_entries) {
+      entries = psram_entries;
+      mask = (1UL << TT_SIZE_BITS) - 1;
+    } else {
+      allocated = false;
+    }
+  }
+#endif
+  clear();
+  return allocated;
+}
+
+void TranspositionTable::clear() {
+  memset(entries, 0, sizeof(TTEntry) * (mask + 1));
+  age = 0;
+}
+
+void TranspositionTable::new_search() {
+  // 6 bits of age in an entry
+  age = (age + 1) & 0x3F;
+}
+
+TTEntry* TranspositionTable::probe(uint64_t key) {
+  TTEntry* entry = &entries[key & mask];
+  if (entry->key == key && entry->bound() != 0) {
+    return entry;
+  }
+  return nullptr;
+}
+
+void TranspositionTable::store(uint64_t key, int8_t depth, int16_t score, uint8_t bound, Move best_move) {
+  TTEntry* entry = &entries[key & mask];
+  // Keep a deeper result of the current search for another position
+  if (entry->key != key && entry->bound() != 0 && entry->age() == age && entry->depth > depth) {
+    return;
+  }
+  // Don't lose the best move of the position if this search didn't find one (e.g. every move failed low)
+  if (entry->key != key || best_move != 0) {
+    entry->best_move = best_move;
+  }
+  entry->key = key;
+  entry->score = score;
+  entry->depth = depth;
+  entry->bound_and_age = bound | (age << 2);
+}
+
+MoveListCache::MoveListCache() {
+  clear();
+}
+
+void MoveListCache::clear() {
+  for (uint8_t i = 0; i < MOVE_LIST_CACHE_SIZE; i++) {
+    slots[i].key = 0;
+  }
+}
+
+bool MoveListCache::probe(uint64_t key, LegalMoveList &moves, uint64_t &checkers) {
+  CachedMoveList &slot = slots[key & (MOVE_LIST_CACHE_SIZE - 1)];
+  if (slot.key != key || key == 0) {
+    return false;
+  }
+  moves = slot.moves;
+  checkers = slot.checkers;
+  return true;
+}
+
+void MoveListCache::store(uint64_t key, const LegalMoveList &moves, uint64_t checkers) {
+  CachedMoveList &slot = slots[key & (MOVE_LIST_CACHE_SIZE - 1)];
+  slot.key = key;
+  slot.moves = moves;
+  slot.checkers = checkers;
+}
@@ -0,0 +1,107 @@
+// TranspositionTable.h file
+
+#ifndef TRANSPOSITION_TABLE_H
+#define TRANSPOSITION_TABLE_H
+#include "Move.h"
+#include <stdint.h>
+#include <Arduino.h>
+
+// Number of entries is 1 << TT_SIZE_BITS (16 bytes each), can be set from the build flags (-DTT_SIZE_BITS=...)
+// With PSRAM (BOARD_HAS_PSRAM, set by the ESP32 core when PSRAM is enabled) the table is allocated there by init(),
+// otherwise it is a static array in SRAM, so it has to stay small
+#ifndef TT_SIZE_BITS
+#ifdef BOARD_HAS_PSRAM
+#define TT_SIZE_BITS 17  // 131072 entries, 2 MB of PSRAM
+#else
+#define TT_SIZE_BITS 11  // 2048 entries, 32 KB of SRAM
+#endif
+#endif
+
+// Number of legal move lists kept by MoveListCache (power of 2, each is about 600 bytes)
+#ifndef MOVE_LIST_CACHE_SIZE
+#define MOVE_LIST_CACHE_SIZE 16
+#endif
+
+// What the score of an entry means (the search only knows the exact score when it fell inside the alpha-beta window)
+#define TT_BOUND_EXACT 1  // the score is exact
+#define TT_BOUND_LOWER 2  // the score is at least this (the search failed high, a beta cutoff)
+#define TT_BOUND_UPPER 3  // the score is at most this (no move raised alpha)
+
+// One position's search result, 16 bytes
+struct TTEntry {
+  // Full zobrist hash of the position (0 for an empty entry)
+  uint64_t key;
+  // Best move found, or the move that caused the cutoff (0 if none)
+  Move best_move;
+  int16_t score;
+  // Depth the position was searched to
+  int8_t depth;
+  // Bound (TT_BOUND_*) in bits 0-1, age of the search that stored it in bits 2-7
+  uint8_t bound_and_age;
+
+  uint8_t bound() const {
+    return bound_and_age & 0x3;
+  }
+
+  uint8_t age() const {
+    return bound_and_age >> 2;
+  }
+};
+
+// Fixed size hash table of search results, indexed by the low bits of the zobrist hash
+// Replacement: an entry is kept over a new one only if it is from the current search and was searched deeper
+// (the same position is always replaced, results from earlier searches are always replaced)
+class TranspositionTable {
+  public:
+    TTEntry* entries;
+    // Number of entries - 1 (the size is a power of 2)
+    uint32_t mask;
+    // Incremented by every search, so entries from older moves get replaced first
+    uint8_t age;
+
+    TranspositionTable();
+
+    // Allocates the table in PSRAM when there is some (call once from setup()), and clears it
+    // Returns false if the allocation failed, the table then falls back to the static SRAM table
+    bool init();
+
+    // Empties every entry (for a new game)
+    void clear();
+
+    // Starts a new search (ages the entries that are already there)
+    void new_search();
+
+    // Returns the entry of the position, nullptr if it isn't in the table
+    TTEntry* probe(uint64_t key);
+
+    // Stores a search result, if the replacement policy allows it
+    void store(uint64_t key, int8_t depth, int16_t score, uint8_t bound, Move best_move);
+};
+
+// A generated legal move list with the position it belongs to
+struct CachedMoveList {
+  uint64_t key;
+  uint64_t checkers;
+  LegalMoveList moves;
+};
+
+// Small direct-mapped cache of legal move lists, keyed by zobrist hash like the transposition table
+// (the entries are far too big to go in the table itself)
+// A position that comes back (pieces moved back and forth) then gets its moves without generating them again
+class MoveListCache {
+  public:
+    CachedMoveList slots[MOVE_LIST_CACHE_SIZE];
+
+    MoveListCache();
+
+    // Empties every slot (for a new game)
+    void clear();
+
+    // Copies the moves and checkers of the position into moves/checkers if they are cached, returns false if not
+    bool probe(uint64_t key, LegalMoveList &moves, uint64_t &checkers);
+
+    // Keeps the moves of a position, replacing whatever was in its slot
+    void store(uint64_t key, const LegalMoveList &moves, uint64_t checkers);
+};
+
+#endif
@@ -0,0 +1,5 @@
+#include "Zobrist.h"
+#include <stdint.h>
+
+// Define the zobrist keys (computed at compile time)
+constexpr ZobristKeys ZOBRIST;
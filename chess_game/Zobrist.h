@@ -0,0 +1,50 @@
+// Zobrist.h file
+
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+#include <stdint.h>
+
+// Random keys for Zobrist hashing. The hash of a position is the XOR of the key of every piece on its square,
+// plus the keys of the castling rights, the en passant column and the side to move.
+// Moving a piece only XORs out its old key and XORs in the new one, so the hash is cheap to keep up to date.
+struct ZobristKeys {
+  // piece[color][piece_type][square], the EMPTY entry is unused
+  uint64_t piece[2][7][64];
+  // One key per castling flag: white king side, white queen side, black king side, black queen side
+  uint64_t castling[4];
+  // Column (x) of the pawn that can be taken en passant
+  uint64_t en_passant[8];
+  // XORed in when black is to move
+  uint64_t black_to_move;
+
+  // Keys come from a splitmix64 generator with a fixed seed, computed at compile time (they live in flash on the ESP32)
+  constexpr ZobristKeys() : piece(), castling(), en_passant(), black_to_move(0) {
+    uint64_t seed = 0x5DEECE66DULL;
+    for (int8_t color = 0; color < 2; color++) {
+      for (int8_t type = 1; type < 7; type++) {
+        for (int8_t square = 0; square < 64; square++) {
+          piece[color][type][square] = next_key(seed);
+        }
+      }
+    }
+    for (int8_t i = 0; i < 4; i++) {
+      castling[i] = next_key(seed);
+    }
+    for (int8_t i = 0; i < 8; i++) {
+      en_passant[i] = next_key(seed);
+    }
+    black_to_move = next_key(seed);
+  }
+
+  static constexpr uint64_t next_key(uint64_t &seed) {
+    seed += 0x9E3779B97F4A7C15ULL;
+    uint64_t z = seed;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+};
+
+extern const ZobristKeys ZOBRIST;
+
+#endif
@@ -15,6 +15,16 @@
 // #include "MemoryFree.h"
 #include "Piece.h"
 #include "PieceType.h"
+#include "Move.h"
+#include "Search.h"
+#include "OpeningBook.h"
+#include "PiLink.h"
+#include "MotorQueue.h"
+#include "ResetPlanner.h"
+#include "MotionScheduler.h"
+#include "PathRouter.h"
+#include "LedMap.h"
+#include "OledRegions.h"
 #include "Timer.h"
 
 // SOME DEBUG DEFINES...
@@ -79,14 +89,16 @@ Timer game_timer;
 // 0 for white to move, 1 for black to move
 bool player_turn;
 int8_t player_is_computer[2];  // 0 for human, 1 for computer
-bool game_has_computer_player; // If true, at least one player is a computer
+bool game_has_computer_player; // If true, at least one player is played by stockfish on the Pi (so moves are sent to it)
+int8_t computer_difficulty[2];  // comp_diff (0 to 19) picked in the idle screen, for computer players
+bool computer_uses_local_engine[2];  // If true, this computer player is played by the on-device Search instead of the Pi
 
 // 0 for player is not under check, 1 for player is under check
 bool current_player_under_check;
 
-// Sources of check, if any (x, y coordinates of the piece that is checking the
-// king)
-std::vector<std::pair<int8_t, int8_t>> sources_of_check;
+// Sources of check, if any (bitboard of the pieces that are checking the
+// king, bit y*8 + x)
+uint64_t sources_of_check;
 
 // User selection memory
 int8_t selected_x;
@@ -97,7 +109,7 @@ int8_t capture_x;
 int8_t capture_y;
 int8_t promotable_pawn_x;
 int8_t promotable_pawn_y;
-int8_t promotion_type;  // 0 for queen, 1 for rook, 2 for bishop, 3 for knight
+int8_t promotion_type;  // promotion selection: 0 for queen, 1 for knight, 2 for bishop, 3 for rook
 int8_t previous_destination_x = 0;
 int8_t previous_destination_y = 0;
 int8_t previous_selected_x = 0;
@@ -112,6 +124,7 @@ bool draw_three_fold_repetition;  // If true, the game is a draw due to three fo
 bool draw_fifty_move_rule;        // If true, the game is a draw due to fifty move rule
 bool draw_stalemate;              // If true, the game is a draw due to stalemate
 bool draw_insufficient_material;  // If true, the game is a draw due to insufficient material
+bool draw_known_endgame;  // If true, the game is a draw because the endgame bitbase says it can't be won (see GAME_BEGIN_TURN)
 
 // Graveyard will be updated when a piece is captured - must consider cases of:
 // 1. normal piece captured - it can immediately replace a temp piece (update graveyard by moving the pawn to the graveyard)
@@ -126,743 +139,333 @@ int8_t graveyard[12];  // Graveyard, each for one piece type. 0 is queen, 1 is
 // This records the position of promoted pawns that are using temp pieces
 std::vector<std::pair<int8_t, int8_t>> promoted_pawns_using_temp_pieces;
 
-// Initialize Memory for the Board Object and Moves Vector (keeping track of possible moves)
-Board *p_board;
-std::vector<std::pair<int8_t, int8_t>>
-  all_moves[8][8];
+// Initialize Memory for the Board Object and Moves List (keeping track of possible moves)
+// The board lives in static memory for the whole uptime, a new game just resets it (nothing is allocated)
+Board game_board;
+Board *p_board = &game_board;
+// Legal moves of the player to move, one flat list sorted by origin square (see LegalMoveList in Move.h)
+LegalMoveList all_moves;
+// On-device engine for computer players (static too, it keeps a move list for every ply of the search)
+Search search;
+// Legal moves of the last few positions, so a position that comes back doesn't generate its moves again
+MoveListCache move_list_cache;
+// Opening book move for a computer player this turn (found in GAME_BEGIN_TURN), 0 if out of book
+Move book_move;
+
+// Pondering: work done in small slices while a human is choosing a move (see ponder_step)
+#define PONDER_SLICE_MS 4        // longest a slice may take, so joysticks and LEDs stay responsive
+#define PONDER_CLOCK_MASK 15     // the search reads the clock every 16 nodes in a slice (instead of 256), so it stops
+                                 // within 16 nodes of PONDER_SLICE_MS
+#define PONDER_MAX_STALLED 50     // slices a single root move may start over before the search is given up on
+#define PONDER_PREDICT_DEPTH 3   // depth of the search that guesses the human's move
+#define PONDER_MAX_REPLIES MOVE_LIST_CACHE_SIZE  // most replies whose legal moves are precomputed (no more than the cache holds)
+#define PONDER_PREDICT 0         // searching the human's position for the likeliest moves
+#define PONDER_CACHE 1           // generating the legal moves after each likely reply (into move_list_cache)
+#define PONDER_THINK 2           // the computer opponent searching the position after the predicted move
+#define PONDER_DONE 3
+int8_t ponder_stage;
+uint64_t ponder_root_hash;           // position of the human's turn being pondered on
+int8_t ponder_selected_square;       // piece the human has selected (-1 if none), its moves are the likeliest replies
+Move ponder_replies[PONDER_MAX_REPLIES];
+uint8_t ponder_reply_count;
+uint8_t ponder_reply_index;          // next reply to precompute
+bool ponder_search_started;          // search.start_search was called for the current stage
+uint8_t ponder_stalled_slices;       // slices in a row that didn't finish a root move (the table is too small for it)
+uint16_t ponder_progress;            // iteration and root move the search was at after the last slice
+Move ponder_predicted_move;
+uint64_t ponder_hash;                // position after the predicted move
+Move ponder_best_move;               // computer's answer to the predicted move, once PONDER_DONE
+LegalMoveList ponder_moves;          // legal moves after a reply, on their way into move_list_cache
+
+// Sets destination_x/y and capture_x/y (-1 if nothing is captured) from a packed move
+void set_destination_and_capture(Move move) {
+  destination_x = move_to(move) % 8;
+  destination_y = move_to(move) / 8;
+  int8_t capture_square = move_capture_square(move);
+  capture_x = capture_square == -1 ? -1 : capture_square % 8;
+  capture_y = capture_square == -1 ? -1 : capture_square / 8;
+}
 
-std::pair<int8_t, int8_t> get_graveyard_empty_coordinate(int8_t piece_type,
-                                                         bool color) {
-  // Get the graveyard coordinate for a piece type (THE FIRST EMPTY SPACE)
-  // piece_type: 1 for queen, 2 for rook, 3 for bishop, 4 for knight,
-  //    5 for pawn, 6 for temp piece
-  // color: 0 for white, 1 for black
-  // Returns the x, y coordinate for this piece in the graveyard as a pair
-
-  // This function should be called BEFORE the graveyard is updated
-  //    (since a value of 0 is used for the first piece of each type)
-  // We treat the white queen moves to coordinate (8,7),
-  //    rook to (8,6) and (8,5), bishop to (8,4) and (8,3),
-  //    knight to (8,2) and (8,1), pawn to (9,7 to 9,0)
-  // We treat the black queen moves to coordinate (-1,0),
-  //    rook to (-1,1) and (-1,2), bishop to (-1,3) and (-1,4), knight to (-1,5) and (-1,6),
-  //    pawn to (-2,0 to -2,7)
-  // The specific coordinate is decided by graveyard[index] and index is decided by piece_type and color
-
-  int8_t graveyard_index = 0;
-  if (piece_type == 1) {
-    graveyard_index = 0;
-  } else if (piece_type == 2) {
-    graveyard_index = 1;
-  } else if (piece_type == 3) {
-    graveyard_index = 2;
-  } else if (piece_type == 4) {
-    graveyard_index = 3;
-  } else if (piece_type == 5) {
-    graveyard_index = 4;
+// Looks for the move of the selected piece to (destination_x, destination_y), and sets capture_x/y from it
+// Returns false if the selected piece can't move there
+bool find_selected_move() {
+  int8_t selected_square = selected_y * 8 + selected_x;
+  for (uint8_t i = 0; i < all_moves.count_from(selected_square); i++) {
+    Move move = all_moves.from(selected_square, i);
+    if (move_to(move) == destination_y * 8 + destination_x) {
+      set_destination_and_capture(move);
+      return true;
+    }
   }
+  return false;
+}
 
-  // If black, add 5 to the index
-  if (color == 1) {
-    graveyard_index += 5;
-  }
+// Starts pondering over on the current position (new turn, or new game)
+void ponder_reset() {
+  ponder_stage = PONDER_PREDICT;
+  ponder_root_hash = p_board->zobrist_hash;
+  ponder_selected_square = -1;
+  ponder_reply_count = 0;
+  ponder_reply_index = 0;
+  ponder_search_started = false;
+  ponder_predicted_move = 0;
+  ponder_hash = 0;
+  ponder_best_move = 0;
+}
 
-  // If piece is temp, 10 index is for white, 11 index is for black
-  if (piece_type == 6) {
-    if (color == 0) {
-      graveyard_index = 10;
-    } else {
-      graveyard_index = 11;
+// Runs one slice of the search started by the current ponder stage, returns true once the search is finished
+// (or stalled: a root move that never finishes within a slice starts over every time, so it is given up on)
+bool ponder_search_slice(int8_t max_depth) {
+  if (!ponder_search_started) {
+    ponder_search_started = true;
+    ponder_stalled_slices = 0;
+    ponder_progress = 0;
+    if (!search.start_search(p_board, max_depth)) {
+      return true;
     }
   }
-
-  if (color == 0) {
-    // White
-    if (piece_type == 1) {          // Queen
-      return std::make_pair(8, 7);  // only 1 queen can be captured
-    } else if (piece_type == 2) {   // Rook
-      return std::make_pair(8, 6 - graveyard[graveyard_index]);
-    } else if (piece_type == 3) {  // Bishop
-      return std::make_pair(8, 4 - graveyard[graveyard_index]);
-    } else if (piece_type == 4) {  // Knight
-      return std::make_pair(8, 2 - graveyard[graveyard_index]);
-    } else if (piece_type == 5) {  // Pawn
-      return std::make_pair(9, 7 - graveyard[graveyard_index]);
-    } else if (piece_type == 6) {  // Temp piece
-      return std::make_pair(10, 7 - graveyard[graveyard_index]);
-    }
-  } else {
-    // Black
-    if (piece_type == 1) {
-      return std::make_pair(-1, 0);
-    } else if (piece_type == 2) {
-      return std::make_pair(-1, 1 + graveyard[graveyard_index]);
-    } else if (piece_type == 3) {
-      return std::make_pair(-1, 3 + graveyard[graveyard_index]);
-    } else if (piece_type == 4) {
-      return std::make_pair(-1, 5 + graveyard[graveyard_index]);
-    } else if (piece_type == 5) {
-      return std::make_pair(-2, graveyard[graveyard_index]);
-    } else if (piece_type == 6) {
-      return std::make_pair(-3, graveyard[graveyard_index]);  // small bug that was ignored before, used 11 instead of -3.
-    }
+  bool finished = search.continue_search(PONDER_SLICE_MS, PONDER_CLOCK_MASK);
+  uint16_t progress = search.iteration_depth * 256 + search.root_index;
+  if (!finished && progress == ponder_progress && ++ponder_stalled_slices >= PONDER_MAX_STALLED) {
+    return true;
+  }
+  if (progress != ponder_progress) {
+    ponder_stalled_slices = 0;
+    ponder_progress = progress;
   }
-  // Default return value (should never reach here)
-  return std::make_pair(-1, -1);
+  return finished;
 }
 
-// Function to return a vector of motor moves that would
-// result in the board being reset to starting position.
-
-// The pair consists of Board indices, calculated using (y * 14 + 3) + x (this 14+3 is to handle negative x coordinate from -3 all the way to 10)
-std::vector<std::pair<int8_t, int8_t>> reset_board(Board *p_board) {  // instead of _ * 14 + 3 + col, --> _ * 14 + col
-
-  /*
-  This function will return a vector of motor moves that will result in the board being reset to the starting position.
-  1. The function moves all temp pieces on the board back to their starting squares.
-  2. Function moves all pieces currently on board to their starting squares.
-  3. Function moves all pieces in the graveyard to their starting squares.
-
-  RETURN VALUE: vector of integers. From and to squares in the form of (y * 14 + 3) + x
-  */
-
-  // temporary -- check to be sure
-  int8_t temp_x = -1, temp_y = 0;
-  bool loop_detected;
-  std::vector<int8_t> current_chain;                   // Chain to hold the current chain of indices we're moving (acts like a stack)
-  std::vector<std::pair<int8_t, int8_t>> reset_moves;  // The vector to be returned
-
-  // An array to keep track of where each piece wants to move to (for 2nd step)
-  int8_t destination_arr[14 * 8] = { -1 };                 // Initialize every element to -1
-  bool square_is_already_destination[14 * 8] = { false };  // Initialize every element to false, this array is to keep track if a square has been designated a destination already (so 2 pieces of same kind don't move to same square)
-
-  // ### Moving all temp pieces off of the board ###
-  // Looping through all of the pieces in the board to find temp pieces
-  for (int8_t i = 0; i < 8; i++) {
-    for (int8_t j = 0; j < 8; j++) {
-      // i is x, j is y
-      if (p_board->pieces[i][j]->type == EMPTY || p_board->pieces[i][j]->type == PAWN) {
-        // Ignore pawn or empty squares
-        continue;
-      } else {
-        // check if this piece is currently using a temp piece
-        for (int8_t temp_piece_index = 0; temp_piece_index < promoted_pawns_using_temp_pieces.size(); temp_piece_index++) {
-          if (promoted_pawns_using_temp_pieces[temp_piece_index].first == j && promoted_pawns_using_temp_pieces[temp_piece_index].second == i) {
-            // This piece is using a temp piece
-            // Find first empty square in graveyard, send it back (graveyard (6 == temp piece))
-            std::pair<int8_t, int8_t> graveyard_coordinate = get_graveyard_empty_coordinate(6, p_board->pieces[i][j]->get_color());
-            // Add the move to the reset_moves vector
-            reset_moves.push_back(std::make_pair((i * 14 + 3) + j, (graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first));
-            // Update the graveyard memory
-            graveyard[10 + p_board->pieces[i][j]->get_color()]++;
-            // Update the board object, make it think this square is empty
-            p_board->pieces[i][j]->type = EMPTY;
-            break;
-          }
-        }
-      }
-    }
+// One slice of pondering (at most PONDER_SLICE_MS), called every loop() while a human is choosing a move
+// selected_square is the piece the human has picked (-1 while still selecting)
+// The board is always back to the game position when it returns
+void ponder_step(int8_t selected_square) {
+  if (p_board->zobrist_hash != ponder_root_hash) {
+    ponder_reset();
   }
-
-  // TODO: loop thru the board, and find ALL R,B,N,pawns that are at ONE of their valid destination squares.
-  // The idea of this code is to prevent the case where a piece is at its destination square, and then we move it to another square.
-  for (int8_t j = 0; j < 8; j++) {
-    for (int8_t i = 0; i < 8; i++) {
-      // We are looping in column major order (for purpose of allowing each piece to get to the "closer" square)
-      if (p_board->pieces[i][j]->type == EMPTY) {
-        // Ignore empty squares
-        continue;
-      } else {
-        // Find out if this piece is currently at its destination square
-        if (p_board->pieces[i][j]->type == KING) {
-          // White king:
-          if (p_board->pieces[i][j]->color == 0) {
-            if ((i == 0) && (j == 4)) {
-              destination_arr[i * 14 + 3 + j] = -1;
-              square_is_already_destination[i * 14 + 3 + j] = true;
-            }
-            // Black king:
-          } else {
-            if ((i == 7) && (j == 4)) {
-              destination_arr[i * 14 + 3 + j] = -1;
-              square_is_already_destination[i * 14 + 3 + j] = true;
-            }
-          }
-        } else if (p_board->pieces[i][j]->type == QUEEN) {
-          // White queen:
-          if (p_board->pieces[i][j]->color == 0) {
-            if ((i == 0) && (j == 3)) {
-              destination_arr[i * 14 + 3 + j] = -1;
-              square_is_already_destination[i * 14 + 3 + j] = true;
-            }
-            // Black queen:
-          } else {
-            if ((i == 7) && (j == 3)) {
-              destination_arr[i * 14 + 3 + j] = -1;
-              square_is_already_destination[i * 14 + 3 + j] = true;
-            }
-          }
-        } else if (p_board->pieces[i][j]->type == ROOK) {
-          // For rooks, we have to check if the "leftmore" square is already occupied
-          // White rook:
-          if (p_board->pieces[i][j]->color == 0) {
-            if ((i == 0) && (j == 0 || j == 7)) {
-              destination_arr[i * 14 + 3 + j] = -1;
-              square_is_already_destination[i * 14 + 3 + j] = true;
-            }
-            // Black rook:
-          } else {
-            if ((i == 7) && (j == 0 || j == 7)) {
-              destination_arr[i * 14 + 3 + j] = -1;
-              square_is_already_destination[i * 14 + 3 + j] = true;
-            }
-          }
-        } else if (p_board->pieces[i][j]->type == BISHOP) {
-          // For bishops, we have to check if the "leftmore" square is already occupied
-          // White bishop:
-          if (p_board->pieces[i][j]->color == 0) {
-            if ((i == 0) && (j == 2 || j == 5)) {
-              destination_arr[i * 14 + 3 + j] = -1;
-              square_is_already_destination[i * 14 + 3 + j] = true;
-            }
-            // Black bishop:
-          } else {
-            if ((i == 7) && (j == 2 || j == 5)) {
-              destination_arr[i * 14 + 3 + j] = -1;
-              square_is_already_destination[i * 14 + 3 + j] = true;
-            }
-          }
-        } else if (p_board->pieces[i][j]->type == KNIGHT) {
-          // For knights, we have to check if the "leftmore" square is already occupied
-          // White knight:
-          if (p_board->pieces[i][j]->color == 0) {
-            if ((i == 0) && (j == 1 || j == 6)) {
-              destination_arr[i * 14 + 3 + j] = -1;
-              square_is_already_destination[i * 14 + 3 + j] = true;
-            }
-            // Black knight:
-          } else {
-            if ((i == 7) && (j == 1 || j == 6)) {
-              destination_arr[i * 14 + 3 + j] = -1;
-              square_is_already_destination[i * 14 + 3 + j] = true;
-            }
-          }
-        } else if (p_board->pieces[i][j]->type == PAWN) {
-          // For pawn, we have a small for loop to check if the "leftmore" square is already occupied
-          // White pawn:
-          if (p_board->pieces[i][j]->color == 0) {
-            if ((i == 1)) {
-              destination_arr[i * 14 + 3 + j] = -1;
-              square_is_already_destination[i * 14 + 3 + j] = true;
-            }
-            // Black pawn:
-          } else {
-            if (i == 6) {
-              destination_arr[i * 14 + 3 + j] = -1;
-              square_is_already_destination[i * 14 + 3 + j] = true;
-            }
-          }
-        }
+  // Once a piece is picked, its moves are the likeliest replies (the prediction search is skipped)
+  if (selected_square != ponder_selected_square) {
+    ponder_selected_square = selected_square;
+    if (selected_square >= 0) {
+      ponder_reply_count = 0;
+      for (uint8_t i = 0; i < all_moves.count_from(selected_square) && ponder_reply_count < PONDER_MAX_REPLIES; i++) {
+        ponder_replies[ponder_reply_count++] = all_moves.from(selected_square, i);
       }
-    }
-  }
-
-  // ### Find out where each piece that's currently on the board wants to move to ###
-  // If the piece is currently on their destination, destination_arr = -1, square_is_already_destination = true
-  for (int8_t j = 0; j < 8; j++) {
-    for (int8_t i = 0; i < 8; i++) {
-      // We are looping in column major order (for purpose of allowing each piece to get to the "closer" square)
-      if (p_board->pieces[i][j]->type == EMPTY) {
-        // Ignore empty squares
-        // However we should set its destination to -1, so that it doesn't get moved
-        destination_arr[(i * 14 + 3) + j] = -1;
-        continue;
-      } else if (destination_arr[(i * 14 + 3) + j] == -1) {
-        // If this square is already designated a destination, continue, don't do anything
-        continue;
-      } else {
-        // Find out where this piece originally belongs to
-        if (p_board->pieces[i][j]->type == KING) {
-          // White king:
-          if (p_board->pieces[i][j]->color == 0) {
-            destination_arr[(i * 14 + 3) + j] = (0 * 14 + 3) + 4;
-            square_is_already_destination[(0 * 14 + 3) + 4] = true;
-            // Black king:
-          } else {
-            destination_arr[(i * 14 + 3) + j] = (7 * 14 + 3) + 4;
-            square_is_already_destination[(7 * 14 + 3) + 4] = true;
-          }
-        } else if (p_board->pieces[i][j]->type == QUEEN) {
-          // White queen:
-          if (p_board->pieces[i][j]->color == 0) {
-            destination_arr[(i * 14 + 3) + j] = (0 * 14 + 3) + 3;
-            square_is_already_destination[(0 * 14 + 3) + 3] = true;
-            // Black queen:
-          } else {
-            destination_arr[(i * 14 + 3) + j] = (7 * 14 + 3) + 3;
-            square_is_already_destination[(7 * 14 + 3) + 3] = true;
-          }
-        } else if (p_board->pieces[i][j]->type == ROOK) {
-          // For rooks, we have to check if the "leftmore" square is already occupied
-          // White rook:
-          if (p_board->pieces[i][j]->color == 0) {
-            if (square_is_already_destination[(0 * 14 + 3) + 0] == false) {
-              destination_arr[(i * 14 + 3) + j] = (0 * 14 + 3) + 0;
-              square_is_already_destination[(0 * 14 + 3) + 0] = true;
-            } else {
-              destination_arr[(i * 14 + 3) + j] = (0 * 14 + 3) + 7;
-              square_is_already_destination[(0 * 14 + 3) + 7] = true;
-            }
-            // Black rook:
-          } else {
-            if (square_is_already_destination[(7 * 14 + 3) + 0] == false) {
-              destination_arr[(i * 14 + 3) + j] = (7 * 14 + 3) + 0;
-              square_is_already_destination[(7 * 14 + 3) + 0] = true;
-            } else {
-              destination_arr[(i * 14 + 3) + j] = (7 * 14 + 3) + 7;
-              square_is_already_destination[(7 * 14 + 3) + 7] = true;
-            }
-          }
-        } else if (p_board->pieces[i][j]->type == BISHOP) {
-          // For bishops, we have to check if the "leftmore" square is already occupied
-          // White bishop:
-          if (p_board->pieces[i][j]->color == 0) {
-            if (square_is_already_destination[(0 * 14 + 3) + 2] == false) {
-              destination_arr[(i * 14 + 3) + j] = (0 * 14 + 3) + 2;
-              square_is_already_destination[(0 * 14 + 3) + 2] = true;
-            } else {
-              destination_arr[(i * 14 + 3) + j] = (0 * 14 + 3) + 5;
-              square_is_already_destination[(0 * 14 + 3) + 5] = true;
-            }
-            // Black bishop:
-          } else {
-            if (square_is_already_destination[(7 * 14 + 3) + 2] == false) {
-              destination_arr[(i * 14 + 3) + j] = (7 * 14 + 3) + 2;
-              square_is_already_destination[(7 * 14 + 3) + 2] = true;
-            } else {
-              destination_arr[(i * 14 + 3) + j] = (7 * 14 + 3) + 5;
-              square_is_already_destination[(7 * 14 + 3) + 5] = true;
-            }
-          }
-        } else if (p_board->pieces[i][j]->type == KNIGHT) {
-          // For knights, we have to check if the "leftmore" square is already occupied
-          // White knight:
-          if (p_board->pieces[i][j]->color == 0) {
-            if (square_is_already_destination[(0 * 14 + 3) + 1] == false) {
-              destination_arr[(i * 14 + 3) + j] = (0 * 14 + 3) + 1;
-              square_is_already_destination[(0 * 14 + 3) + 1] = true;
-            } else {
-              destination_arr[(i * 14 + 3) + j] = (0 * 14 + 3) + 6;
-              square_is_already_destination[(0 * 14 + 3) + 6] = true;
-            }
-            // Black knight:
-          } else {
-            if (square_is_already_destination[(7 * 14 + 3) + 1] == false) {
-              destination_arr[(i * 14 + 3) + j] = (7 * 14 + 3) + 1;
-              square_is_already_destination[(7 * 14 + 3) + 1] = true;
-            } else {
-              destination_arr[(i * 14 + 3) + j] = (7 * 14 + 3) + 6;
-              square_is_already_destination[(7 * 14 + 3) + 6] = true;
-            }
-          }
-        } else if (p_board->pieces[i][j]->type == PAWN) {
-          // For pawn, we have a small for loop to check if the "leftmore" square is already occupied
-          // White pawn:
-          if (p_board->pieces[i][j]->color == 0) {
-            for (int8_t k = 0; k < 8; k++) {
-              if (square_is_already_destination[(1 * 14 + 3) + k] == false) {
-                destination_arr[(i * 14 + 3) + j] = (1 * 14 + 3) + k;
-                square_is_already_destination[(1 * 14 + 3) + k] = true;
-                break;
-              }
-            }
-            // Black pawn:
-          } else {
-            for (int8_t k = 0; k < 8; k++) {
-              if (square_is_already_destination[(6 * 14 + 3) + k] == false) {
-                destination_arr[(i * 14 + 3) + j] = (6 * 14 + 3) + k;
-                square_is_already_destination[(6 * 14 + 3) + k] = true;
-                break;
-              }
-            }
-          }
-        }
-        // Check if the piece is already on its destination. If so, set destination_arr to -1
-        if ((i * 14 + 3) + j == destination_arr[(i * 14 + 3) + j]) {
-          destination_arr[(i * 14 + 3) + j] = -1;
-        }
+      ponder_reply_index = 0;
+      if (ponder_stage == PONDER_PREDICT) {
+        ponder_stage = PONDER_CACHE;
       }
     }
   }
 
-  // ### Handling destination square chains and loops ###
-  // We loop across the board, find a square that wants to move to another square. Loop thru the chain until it reaches a -1 or a loop
-  // If -1, add chain to reset_moves in reverse order
-  // If loop, add a move to temp, then add the chain to reset_moves in reverse order
-
-  for (int8_t i = 0; i < 8; i++) {
-    for (int8_t j = 0; j < 8; j++) {
-      int8_t curr_idx = (i * 14 + 3) + j;
-      // If we've come across an index that is -1, continue
-      // This accounts for free squares as well as pieces moved in previous chains
-      if (destination_arr[curr_idx] < 0)
-        continue;
-
-      // First reset the loop chain and the loop_detected flag
-      current_chain.clear();
-      loop_detected = 0;
-
-      // Remember the first index in the chain
-      int8_t starting_x = j;
-      int8_t starting_y = i;
-
-      // Handle the chain of indices
-      while (1) {
-        current_chain.push_back(curr_idx);     // push_back adds an element to the end of the vector
-        curr_idx = destination_arr[curr_idx];  // Go to the index that curr_idx wants to move to
-
-        if (destination_arr[curr_idx] == -1) {  // chain ends in a -1, means no loop.
-          break;                                // Exit while loop
-        }                                       // else, chain continues and we go to the next index
-
-        // Check if curr_idx wants to move to the first index in the chain
-        if (curr_idx == (starting_y * 14 + 3) + starting_x) {
-          loop_detected = 1;  // Loop detected
-          break;              // Exit while loop
-        }
+  bool opponent_is_local_engine = player_is_computer[!player_turn] && computer_uses_local_engine[!player_turn];
+  if (ponder_stage == PONDER_PREDICT) {
+    // Search the human's position a few plies deep, the best move is the prediction
+    if (ponder_search_slice(PONDER_PREDICT_DEPTH)) {
+      // Predicted move first, then the rest in search order (the last iteration's move, then captures)
+      ponder_predicted_move = search.best_move;
+      ponder_reply_count = 0;
+      if (ponder_predicted_move) {
+        ponder_replies[ponder_reply_count++] = ponder_predicted_move;
       }
-
-      // If loop detected, move first square to temp. Add the chain in reverse order, then add temp to first square destination.
-      if (loop_detected) {
-        // The temp square is at: 8,0 or -1,8. Move it to closer square
-        if (starting_x < starting_y) {
-          temp_x = -1;
-          temp_y = 7;
-        } else {
-          temp_x = 8;
-          temp_y = 0;
+      for (uint16_t i = 0; i < search.ply_moves[0].list.size() && ponder_reply_count < PONDER_MAX_REPLIES; i++) {
+        if (search.ply_moves[0].list[i] != ponder_predicted_move) {
+          ponder_replies[ponder_reply_count++] = search.ply_moves[0].list[i];
         }
-        reset_moves.push_back(std::make_pair(current_chain[0], (temp_y * 14 + 3) + temp_x));  // Move the first square to temp
-        // Remove first square from chain
-        current_chain.erase(current_chain.begin());
       }
-
-      // While the chain is not empty, add the moves in reverse order. And set the destination_arr to -1
-      while (!current_chain.empty()) {
-        reset_moves.push_back(std::make_pair(current_chain.back(), destination_arr[current_chain.back()]));
-        // Now, update the destination_arr to -1
-        destination_arr[current_chain.back()] = -1;
-        current_chain.pop_back();
+      ponder_reply_index = 0;
+      ponder_stage = PONDER_CACHE;
+    }
+  } else if (ponder_stage == PONDER_CACHE) {
+    // One reply per slice: its legal moves, checkers (so the game-over checks too) go into the cache GAME_BEGIN_TURN reads
+    if (ponder_reply_index < ponder_reply_count) {
+      Move reply = ponder_replies[ponder_reply_index++];
+      // A promotion's piece isn't known yet
+      if (!(move_flags(reply) & MOVE_PROMOTION)) {
+        p_board->make_move(reply);
+        uint64_t reply_checkers;
+        if (!move_list_cache.probe(p_board->zobrist_hash, ponder_moves, reply_checkers)) {
+          p_board->generate_legal_moves(p_board->side_to_move, ponder_moves, reply_checkers);
+          move_list_cache.store(p_board->zobrist_hash, ponder_moves, reply_checkers);
+        }
+        p_board->unmake_move();
       }
-
-      // If loop detected, add the temp square to the first square destination
-      if (loop_detected) {
-        // cuz the one moved to temp location is always the starting square
-        reset_moves.push_back(std::make_pair((temp_y * 14 + 3) + temp_x, destination_arr[starting_y * 14 + 3 + starting_x]));
-        destination_arr[starting_y * 14 + 3 + starting_x] = -1;
+    } else if (opponent_is_local_engine && ponder_predicted_move && !(move_flags(ponder_predicted_move) & MOVE_PROMOTION)) {
+      ponder_search_started = false;
+      ponder_stage = PONDER_THINK;
+    } else {
+      ponder_stage = PONDER_DONE;
+    }
+  } else if (ponder_stage == PONDER_THINK) {
+    // The computer thinks on the predicted move, up to the depth it would search for its difficulty
+    uint32_t search_time_budget_ms;
+    int8_t search_max_depth;
+    Search::difficulty_limits(computer_difficulty[!player_turn], search_time_budget_ms, search_max_depth);
+    p_board->make_move(ponder_predicted_move);
+    ponder_hash = p_board->zobrist_hash;
+    bool finished = ponder_search_slice(search_max_depth);
+    p_board->unmake_move();
+    if (finished) {
+      // Only a search that reached the full depth answers for the computer (a stalled one still left its work in the table)
+      if (ponder_stalled_slices < PONDER_MAX_STALLED) {
+        ponder_best_move = search.best_move;
       }
-      // Flush the stack
-      current_chain.clear();
+      ponder_stage = PONDER_DONE;
     }
   }
+}
 
-  // ### Moving pieces in graveyard to their starting squares
-  // For each graveyard types, as long as the graveyard[index] is not 0, move the piece to its starting square. Ignore index 10 and 11 as they are temp pieces
-  for (int8_t i = 0; i < 10; i++) {
-    while (graveyard[i] > 0) {
-      // Update the graveyard memory
-      graveyard[i]--;  // we decrease first cuz we want the piece square, not the empty square.
-      // Find the first empty square in graveyard (the function takes 1 for queen, 2 for rook, 3 for bishop, 4 for knight, 5 for pawn)
-      std::pair<int8_t, int8_t> graveyard_coordinate = get_graveyard_empty_coordinate((i % 5) + 1, i > 4); // i 0-4 is white
-      // Find the first available square on the board
-      if (i == 0) {
-        // White queen
-        reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (0 * 14 + 3) + 3));
-      } else if (i == 1) {
-        // White Rook
-        if (!square_is_already_destination[(0 * 14 + 3) + 7]) {
-          reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (0 * 14 + 3) + 7));
-          square_is_already_destination[(0 * 14 + 3) + 7] = true;
-        } else {
-          reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (0 * 14 + 3) + 0));
-          square_is_already_destination[(0 * 14 + 3) + 0] = true;
-        }
-      } else if (i == 2) {
-        // White Bishop
-        if (!square_is_already_destination[(0 * 14 + 3) + 5]) {
-          reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (0 * 14 + 3) + 5));
-          square_is_already_destination[(0 * 14 + 3) + 5] = true;
-        } else {
-          reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (0 * 14 + 3) + 2));
-          square_is_already_destination[(0 * 14 + 3) + 2] = true;
-        }
-      } else if (i == 3) {
-        // White Knight
-        if (!square_is_already_destination[(0 * 14 + 3) + 6]) {
-          reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (0 * 14 + 3) + 6));
-          square_is_already_destination[(0 * 14 + 3) + 6] = true;
-        } else {
-          reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (0 * 14 + 3) + 1));
-          square_is_already_destination[(0 * 14 + 3) + 1] = true;
-        }
-      } else if (i == 4) {
-        // White Pawn
-        for (int8_t k = 7; k >= 0; k--) {
-          if (!square_is_already_destination[(1 * 14 + 3) + k]) {
-            reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (1 * 14 + 3) + k));
-            square_is_already_destination[(1 * 14 + 3) + k] = true;
-            break;
-          }
-        }
-      } else if (i == 5) {
-        // Black Queen
-        reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (7 * 14 + 3) + 3));
-      } else if (i == 6) {
-        // Black Rook
-        if (!square_is_already_destination[(7 * 14 + 3) + 0]) {
-          reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (7 * 14 + 3) + 0));
-          square_is_already_destination[(7 * 14 + 3) + 0] = true;
-        } else {
-          reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (7 * 14 + 3) + 7));
-          square_is_already_destination[(7 * 14 + 3) + 7] = true;
-        }
-      } else if (i == 7) {
-        // Black Bishop
-        if (!square_is_already_destination[(7 * 14 + 3) + 2]) {
-          reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (7 * 14 + 3) + 2));
-          square_is_already_destination[(7 * 14 + 3) + 2] = true;
-        } else {
-          reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (7 * 14 + 3) + 5));
-          square_is_already_destination[(7 * 14 + 3) + 5] = true;
-        }
-      } else if (i == 8) {
-        // Black Knight
-        if (!square_is_already_destination[(7 * 14 + 3) + 1]) {
-          reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (7 * 14 + 3) + 1));
-          square_is_already_destination[(7 * 14 + 3) + 1] = true;
-        } else {
-          reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (7 * 14 + 3) + 6));
-          square_is_already_destination[(7 * 14 + 3) + 6] = true;
-        }
-      } else if (i == 9) {
-        // Black Pawn
-        for (int8_t k = 0; k < 8; k++) {
-          if (!square_is_already_destination[(6 * 14 + 3) + k]) {
-            reset_moves.push_back(std::make_pair((graveyard_coordinate.second * 14 + 3) + graveyard_coordinate.first, (6 * 14 + 3) + k));
-            square_is_already_destination[(6 * 14 + 3) + k] = true;
-            break;
-          }
-        }
-      }
+// Looks the current position up in the opening book, returns the book move if it is one of all_moves (0 otherwise)
+Move find_book_move() {
+  Move move = opening_book_move(p_board->zobrist_hash, random());
+  if (!move) {
+    return 0;
+  }
+  int8_t from = move_from(move);
+  for (uint8_t i = 0; i < all_moves.count_from(from); i++) {
+    if (all_moves.from(from, i) == move) {
+      return move;
     }
   }
-  return reset_moves;
+  return 0;
+}
+
+// Function to return a vector of motor moves that would
+// result in the board being reset to starting position.
+
+// The pair consists of Board indices, calculated using (y * 14 + 3) + x (this 14+3 is to handle negative x coordinate from -3 all the way to 10)
+std::vector<std::pair<int8_t, int8_t>> reset_board(Board *p_board) {
+  // Temp pieces go back to their graveyard column, the pieces on the board and in the graveyard to their starting
+  // squares, in the order (and to the squares) that keep the gantry's travel short (see ResetPlanner.h)
+  // The graveyard memory is updated like the moves leave it
+  return plan_reset(*p_board, graveyard, promoted_pawns_using_temp_pieces);
 }
 
 // ############################################################
 // #                          STOCKFISH                       #
 // ############################################################
 
-// Pin definitions
-const int clk = 0;
-const int WValid = 15;
-const int WReady = 2;
-const int WData = 4;
-const int RValid = 16;
-const int RReady = 17;
-const int RData = 5;
-const int OVERWRITE = 5; // TEMP: cannot be same as RData
-const int clock_half_period = 10;  // how long a clock half period is in ms
-
-int stockfish_received_data = 0;  // an int storing whatever stockfish sends us
-
-int stockfish_read() {
-  //
-  // State variables
-  int receiving = 0;
-  int i = 0;
-
-  // Begin with not ready
-  digitalWrite(clk, LOW);
-  digitalWrite(RReady, LOW);
-
-  // Rising clock - do one cycle for fun
-  delay(clock_half_period);
-  digitalWrite(clk, HIGH);
-  delay(clock_half_period);
-  digitalWrite(clk, LOW);
-
-  // Set ready
-  digitalWrite(RReady, HIGH);  // Indicate ready to receive
-  delay(clock_half_period);
-  int receivedData[14];
-  int current_data;
-
-  // Loop:
-  while (1) {
-    // Read data and valid status before edge
-    current_data = digitalRead(RData);
-    if (!receiving) receiving = digitalRead(RValid);
-
-    // Rising edge and falling edge
-    digitalWrite(clk, HIGH);
-    delay(clock_half_period);
-    digitalWrite(clk, LOW);
-
-    // load in data
-    if (receiving) {
-      digitalWrite(RReady, LOW);
-      receivedData[i++] = current_data;
-    }
-    if (i >= 14) {
-      break;
+// Framed message link to the Pi over UART2 (see PiLink.h), replacing the bit-banged valid/ready pins
+#define PI_LINK_BAUD 921600
+#define PI_LINK_RX_PIN 16
+#define PI_LINK_TX_PIN 17
+#define PI_ENGINE_REPLY_TIMEOUT_MS 60000  // longest stockfish may think before the local engine moves instead
+const int OVERWRITE = 5;  // set once the Pi said hello
+
+// PiChannel on one of the ESP32's hardware serial ports
+class SerialPiChannel : public PiChannel {
+  public:
+    SerialPiChannel(HardwareSerial &port) : port(port) {}
+    int available() override {
+      return port.available();
+    }
+    int read() override {
+      return port.read();
+    }
+    void write(const uint8_t* data, uint16_t length) override {
+      port.write(data, length);
     }
-  }
 
-  Serial.println("Data read from Raspberry Pi.");
-  int num_received = 0;
-  for (int j = 0; j < 14; j++) {
-    Serial.print(receivedData[j]);
-    Serial.print(" ");
-    num_received += receivedData[j] << j;
-  }
-  Serial.print("\t");
-  Serial.println(num_received);
-  num_received = 0;
-  for (int j = 0; j < 14; j++) {
-    num_received |= (receivedData[j] << (14 - j - 1));
+  private:
+    HardwareSerial &port;
+};
+
+SerialPiChannel pi_channel(Serial2);
+PiLink pi_link;
+bool pi_link_started = false;  // UART, link and hello from the Pi, once after power up (not again for every game)
+uint8_t pi_position_id = 0;  // id of the last position sent, the engine reply has to carry it
+
+// Sends the current position to the Pi, in the same frame as whatever is already batched (the move that led to it)
+// Returns false if the Pi never acked it
+bool pi_send_position() {
+  char fen[FEN_MAX_LENGTH];
+  p_board->to_fen(fen);
+  pi_link.add_fen(++pi_position_id, fen);
+  if (!pi_link.send_batch()) {
+    Serial.println("Pi link: position not acked");
+    return false;
   }
-  digitalWrite(RReady, LOW);
-  digitalWrite(WValid, LOW);
-  return num_received;
+  return true;
 }
 
-int pi_return_to_from_square(int value) {
-  // return the from square value
-  return (value >> 8) & 0b111111;
-  ;
-}
-int pi_return_to_to_square(int value) {
-  // return the to square value
-  return (value >> 2) & 0b111111;
-}
-int pi_return_to_promotion(int value) {
-  // return the promotion value
-  return value & 0b11;
+// ############################################################
+// #                       MOTOR CONTROL                      #
+// ############################################################
+
+// SERVO MOTOR CONTROL VARIABLES
+
+// Segments are queued while a state works out the whole sequence (capture, move, castling rook...), then sent to the
+// subordinate in a few transactions by motor_queue_run, which waits for the done line (MotorQueue.h)
+#define MOTOR_DONE_PIN 4                 // subordinate's done line, high once its queue is empty (through a level shifter)
+// Longest a segment may take before the game carries on without the signal, added up over the segments sent
+#define MOTOR_SEGMENT_TIMEOUT_MS 15000   // a corner to corner taxicab move takes about 10 s at the old constant rate
+#define MOTOR_CALIBRATE_TIMEOUT_MS 30000 // homing at the slow rate from the far corner
+
+MotorQueue motor_queue;
+MotionScheduler motion;  // where the gantry is, and the steps of the move being planned
+volatile bool motor_done = false;  // set by the done line's rising edge
+
+void IRAM_ATTR motor_done_isr() {
+  motor_done = true;
 }
 
-int stockfish_write(bool writing_all_zeros, int is_programming, int programming_colour,
-                    bool is_human, int programming_difficulty, int from_square,
-                    int to_square, bool is_promotion,
-                    int promotion_piece) {  // could change argument to: "Is programming"
-                                            // "programming_colour"
-                                            // "programming_difficulty" "from square" "to
-                                            // square" "if promotion" "promotion piece"
-  // 010000000000000 // a promotion is happening and we are promoting to queen.
-  // 000000000... // No promotion hapening
-  // 0100000000000011 // a promotion is happening, and we promoting to a knight.
-  uint8_t transmitting = 0;
-  int i = 0;
-  uint8_t temp_difficulty = programming_difficulty;
-  uint8_t temp_from = from_square;
-  uint8_t temp_to = to_square;
-  int datas[16] = { 0 };  // Example data, all zeros
-  if (!writing_all_zeros) {
-    if (is_programming) {
-      datas[0] = 1;
-      datas[1] = programming_colour;
-      for (i = 2; i < 16; i++) {
-        datas[i] = temp_difficulty & 1 | is_human;
-        temp_difficulty = temp_difficulty >> 1;
-      }
-    } else {
-      datas[0] = 0;
-      datas[1] = is_promotion;
-      for (i = 7; i >= 2; i--) {
-        datas[i] = temp_from & 1;
-        temp_from = temp_from >> 1;
-      }
-      for (i = 13; i >= 8; i--) {
-        datas[i] = temp_to & 1;
-        temp_to = temp_to >> 1;
-      }
-      datas[14] = promotion_piece & 1;
-      datas[15] = promotion_piece >> 1;
-    }
+// Sends the queued segments and waits for the subordinate to finish them (blocking)
+void motor_queue_run() {
+  if (motor_queue.count == 0) {
+    return;
+  }
+  // The line only goes low once the subordinate has the first transaction, so the next rising edge is this sequence's
+  motor_done = false;
+  uint32_t timeout_ms = 0;
+  for (uint8_t i = 0; i < motor_queue.count; i++) {
+    timeout_ms += motor_queue.segments[i].mode == MOTOR_MODE_CALIBRATE ? MOTOR_CALIBRATE_TIMEOUT_MS
+                                                                       : MOTOR_SEGMENT_TIMEOUT_MS;
   }
+  uint8_t buffer[1 + MOTOR_QUEUE_MAX_BATCH * MOTOR_QUEUE_SEGMENT_BYTES];
+  for (uint8_t first = 0; first < motor_queue.count; first += MOTOR_QUEUE_MAX_BATCH) {
+    uint8_t length = motor_queue.pack(first, buffer);
+    Wire.beginTransmission(SUBORDINATE_ADDR);
+    Wire.write(buffer, length);
+    Wire.endTransmission();
+  }
+  motor_queue.clear();
 
-  digitalWrite(clk, LOW);
-  digitalWrite(WValid, LOW);
-  digitalWrite(WData, datas[0]);
-
-  delay(clock_half_period);
-  digitalWrite(clk, HIGH);
-  delay(clock_half_period);
-  digitalWrite(clk, LOW);
-
-  digitalWrite(WValid, HIGH);  // Indicate data is valid
-  delay(clock_half_period);
-
-  i = 0;
-
-  while (true) {
-    if (!transmitting) {
-      transmitting = digitalRead(WReady);
-    }  // Set valid back to zero
-    // Serial.print("WREADY: ");
-    // Serial.println(digitalRead(WReady));
-    digitalWrite(clk, HIGH);
-    delay(clock_half_period);
-    digitalWrite(clk, LOW);
-    if (transmitting) {
-      // Serial.print("WRITING BIT: ");
-      // Serial.print(i);
-      // Serial.print(" ");
-      // Serial.println(datas[i]);
-
-      digitalWrite(WValid, LOW);
-      i++;
-      if (i >= 16) {
-        break;
-      }
-      digitalWrite(WData, datas[i]);
+  unsigned long start = millis();
+  while (!motor_done) {
+    if (millis() - start > timeout_ms) {
+      Serial.println("Motor queue: no done signal");
+      break;
     }
-    delay(clock_half_period);
+    delay(1);
   }
-  // Serial.println("Data sent to Raspberry Pi.");
-  // for (int j = 0; j < 16; j++) {
-  //   Serial.print(datas[j]);
-  //   Serial.print(" ");
-  // }
-  digitalWrite(RReady, LOW);
-  digitalWrite(WValid, LOW);
-  // Serial.println("");
-  // delay(5000);
-  return 0;
 }
 
+// Queues a move of the gantry (runs the queue first if it is full)
+void motor_queue_add(int8_t x0, int8_t y0, int8_t x1, int8_t y1, uint8_t motor_mode) { // y: [0, 7], x: [-3, 10], motor_mode -> [0:n/a, 1:taxicab, 2:calibrate]
+  if (!motor_queue.add(x0, y0, x1, y1, motor_mode)) {
+    motor_queue_run();
+    motor_queue.add(x0, y0, x1, y1, motor_mode);
+  }
+  motion.moved({x0, y0, x1, y1, motor_mode});
+}
 
-// ############################################################
-// #                       MOTOR CONTROL                      #
-// ############################################################
-
-// SERVO MOTOR CONTROL VARIABLES
-
-void motor_i2c(int8_t x0, int8_t y0, int8_t x1, int8_t y1, uint8_t motor_mode) { // y: [0, 7], x: [-3, 10], motor_mode -> [0:n/a, 1:taxicab, 2:calibrate]
-  Wire.beginTransmission(SUBORDINATE_ADDR);
-  Wire.write((y0 << 4) | (x0 + 3)); // +3 to shift x into positive range
-  Wire.write((y1 << 4) | (x1 + 3));
-  Wire.write(motor_mode);
-  Wire.endTransmission();
+// Queues a segment with its route around the other pieces (PathRouter.h), occupancy follows the piece
+void motor_queue_add_routed(Occupancy &occupancy, const MotorSegment &segment) {
+  MotorSegment records[ROUTE_MAX_WAYPOINTS + 1];
+  uint8_t count = route_segment(occupancy, segment, records);
+  for (uint8_t i = 0; i < count; i++) {
+    motor_queue_add(records[i].x0, records[i].y0, records[i].x1, records[i].y1, records[i].mode);
+  }
+}
 
-  while (1) {
-    delay(100);
-    Wire.requestFrom(SUBORDINATE_ADDR, 1);
-    if (Wire.available() != 0) {
-      uint8_t status = Wire.read();
-      if (status == 0x96) break;
-    }
+// Queues the steps added to motion in the order with the least travel
+void motion_queue_steps() {
+  uint8_t order[MOTION_MAX_STEPS];
+  motion.plan(order);
+  for (uint8_t i = 0; i < motion.count; i++) {
+    motor_queue_add_routed(motion.occupancy, motion.steps[order[i]].segment);
   }
+  motion.clear();
 }
 
 // ############################################################
@@ -894,70 +497,119 @@ enum {
   JOYSTICK_PINS_COUNT
 };
 
+// The subordinate debounces the joysticks and queues their presses and releases, raising its event line while it
+// has some; they are only read (in batches) once the line rose, instead of polling the pins over I2C every loop
+#define JOYSTICK_EVENT_PIN 23   // subordinate's joystick event line, high while it has events queued (through a level shifter)
+#define JOYSTICK_MAX_BATCH 9    // events per request (the subordinate's Wire buffer is 32 bytes)
+#define JOYSTICK_PRESS_QUEUE 8  // presses of a player's joystick not used yet
+
+volatile bool joystick_signalled = true;  // read once at start up for the levels
+
+void IRAM_ATTR joystick_event_isr() {
+  joystick_signalled = true;
+}
+
+// Kinds of presses, the same order as the pin indices above (index / 2, index % 2 is the color)
+enum {
+  JOYSTICK_POS_X,
+  JOYSTICK_POS_Y,
+  JOYSTICK_NEG_X,
+  JOYSTICK_NEG_Y,
+  JOYSTICK_BUTTON
+};
+
+// Presses of each player's joystick not used yet, oldest first. A direction only counts when the joystick was neutral
+// before it (the 4 directions released), like a button it has to be released before it counts again
+uint8_t joystick_presses[2][JOYSTICK_PRESS_QUEUE];
+uint8_t joystick_press_count[2];
+uint16_t joystick_held;  // bit of the pin index, set while pressed
+
+void joystick_event(uint8_t index, bool pressed) {
+  bool color = index % 2;
+  uint8_t kind = index / 2;
+  uint16_t directions = 0;
+  for (uint8_t i = JOYSTICK_POS_X; i <= JOYSTICK_NEG_Y; i++) {
+    directions |= 1 << (2 * i + color);
+  }
+  if (pressed && (kind == JOYSTICK_BUTTON || !(joystick_held & directions)) &&
+      joystick_press_count[color] < JOYSTICK_PRESS_QUEUE) {
+    joystick_presses[color][joystick_press_count[color]++] = kind;
+  }
+  if (pressed) {
+    joystick_held |= 1 << index;
+  } else {
+    joystick_held &= ~(1 << index);
+  }
+}
+
+// Takes the oldest press of the player's joystick, false if there is none
+bool joystick_next_press(bool color, uint8_t &kind) {
+  if (joystick_press_count[color] == 0) {
+    return false;
+  }
+  kind = joystick_presses[color][0];
+  joystick_press_count[color]--;
+  memmove(joystick_presses[color], joystick_presses[color] + 1, joystick_press_count[color]);
+  return true;
+}
+
 bool update_joystick_values() {
-  // Read joystick values from I2C
+  // Read the joystick events from I2C if the subordinate signalled new ones
   // Return true if successful, false otherwise
-  Wire.requestFrom(SUBORDINATE_ADDR, 2);  // Request 2 bytes from slave
-  if (Wire.available() < 2) {
-    Serial.println("NO DATA");
-    return false;  // Not enough data received
+  while (joystick_signalled) {
+    joystick_signalled = false;
+    // Number of events, the pin levels now (bit of the pin index, high is released, LSB first), then per event the pin
+    // index | 0x80 if pressed and the subordinate's time in ms (LSB first)
+    Wire.requestFrom(SUBORDINATE_ADDR, 3 + 3 * JOYSTICK_MAX_BATCH);
+    if (Wire.available() < 3) {
+      Serial.println("NO DATA");
+      return false;  // Not enough data received
+    }
+    uint8_t count = Wire.read();
+    uint16_t levels = Wire.read();
+    levels |= Wire.read() << 8;
+    for (uint8_t i = 0; i < count && i < JOYSTICK_MAX_BATCH && Wire.available() >= 3; i++) {
+      uint8_t pin = Wire.read();
+      Wire.read();  // the subordinate's time of the event (2 bytes), the order is all that's used
+      Wire.read();
+      joystick_event(pin & 0x7F, pin & 0x80);
+    }
+    while (Wire.available()) {
+      Wire.read();  // rest of the requested bytes
+    }
+    JOYSTICK_POS_X_VALUE[0] = (levels >> JOYSTICK_0_POS_X_INDEX) & 1;
+    JOYSTICK_POS_X_VALUE[1] = (levels >> JOYSTICK_1_POS_X_INDEX) & 1;
+    JOYSTICK_POS_Y_VALUE[0] = (levels >> JOYSTICK_0_POS_Y_INDEX) & 1;
+    JOYSTICK_POS_Y_VALUE[1] = (levels >> JOYSTICK_1_POS_Y_INDEX) & 1;
+    JOYSTICK_NEG_X_VALUE[0] = (levels >> JOYSTICK_0_NEG_X_INDEX) & 1;
+    JOYSTICK_NEG_X_VALUE[1] = (levels >> JOYSTICK_1_NEG_X_INDEX) & 1;
+    JOYSTICK_NEG_Y_VALUE[0] = (levels >> JOYSTICK_0_NEG_Y_INDEX) & 1;
+    JOYSTICK_NEG_Y_VALUE[1] = (levels >> JOYSTICK_1_NEG_Y_INDEX) & 1;
+    JOYSTICK_BUTTON_VALUE[0] = (levels >> JOYSTICK_0_BUTTON_INDEX) & 1;
+    JOYSTICK_BUTTON_VALUE[1] = (levels >> JOYSTICK_1_BUTTON_INDEX) & 1;
+    // More events came in while reading, or didn't fit in the batch (no new rising edge then)
+    if (digitalRead(JOYSTICK_EVENT_PIN)) {
+      joystick_signalled = true;
+    } else {
+      // Every queued event is applied, the levels are the ones after them: back in step with the pins if the
+      // subordinate dropped events while its queue was full
+      joystick_held = ~levels & ((1 << JOYSTICK_PINS_COUNT) - 1);
+    }
   }
-  uint8_t data1 = Wire.read();  // Read first byte
-  uint8_t data2 = Wire.read();  // Read second byte
-  // Combine the two bytes into a single 16-bit value
-  // Note, data1 is lower byte and data2 is higher byte
-  // So LSB of data2 is the 8th bit of the combined value
-  uint16_t combinedData = data1 | (data2 << 8);  // Combine the two bytes
-  // Print the received data for debugging
-  // Serial.print("Received data: ");
-  // Serial.print(combinedData, BIN); // Print in binary format
-  // Serial.print(" (0x");
-  // Serial.print(combinedData, HEX); // Print in hexadecimal format
-  // Serial.println(")");
-  // Update joystick values based on the received data
-  JOYSTICK_POS_X_VALUE[0] = (combinedData >> JOYSTICK_0_POS_X_INDEX) & 1;
-  JOYSTICK_POS_X_VALUE[1] = (combinedData >> JOYSTICK_1_POS_X_INDEX) & 1;
-  JOYSTICK_POS_Y_VALUE[0] = (combinedData >> JOYSTICK_0_POS_Y_INDEX) & 1;
-  JOYSTICK_POS_Y_VALUE[1] = (combinedData >> JOYSTICK_1_POS_Y_INDEX) & 1;
-  JOYSTICK_NEG_X_VALUE[0] = (combinedData >> JOYSTICK_0_NEG_X_INDEX) & 1;
-  JOYSTICK_NEG_X_VALUE[1] = (combinedData >> JOYSTICK_1_NEG_X_INDEX) & 1;
-  JOYSTICK_NEG_Y_VALUE[0] = (combinedData >> JOYSTICK_0_NEG_Y_INDEX) & 1;
-  JOYSTICK_NEG_Y_VALUE[1] = (combinedData >> JOYSTICK_1_NEG_Y_INDEX) & 1;
-  JOYSTICK_BUTTON_VALUE[0] = (combinedData >> JOYSTICK_0_BUTTON_INDEX) & 1;
-  JOYSTICK_BUTTON_VALUE[1] = (combinedData >> JOYSTICK_1_BUTTON_INDEX) & 1;
-  // Print the joystick values for debugging
-  // Serial.print("Joystick Values: ");
-  // Serial.print("White X: ");
-  // Serial.print(JOYSTICK_POS_X_VALUE[0]);
-  // Serial.print(", White Y: ");
-  // Serial.print(JOYSTICK_POS_Y_VALUE[0]);
-  // Serial.print(", Black X: ");
-  // Serial.print(JOYSTICK_POS_X_VALUE[1]);
-  // Serial.print(", Black Y: ");
-  // Serial.print(JOYSTICK_POS_Y_VALUE[1]);
-  // Serial.print(", White Neg X: ");
-  // Serial.print(JOYSTICK_NEG_X_VALUE[0]);
-  // Serial.print(", White Neg Y: ");
-  // Serial.print(JOYSTICK_NEG_Y_VALUE[0]);
-  // Serial.print(", Black Neg X: ");
-  // Serial.print(JOYSTICK_NEG_X_VALUE[1]);
-  // Serial.print(", Black Neg Y: ");
-  // Serial.print(JOYSTICK_NEG_Y_VALUE[1]);
-  // Serial.print(", White Button: ");
-  // Serial.print(JOYSTICK_BUTTON_VALUE[0]);
-  // Serial.print(", Black Button: ");
-  // Serial.println(JOYSTICK_BUTTON_VALUE[1]);
-  // Decode the pin value from the combined data
   return true;
 }
 
+// Forgets the presses made so far (a button held now has to be released and pressed again)
+void joystick_discard_presses() {
+  update_joystick_values();
+  joystick_press_count[0] = 0;
+  joystick_press_count[1] = 0;
+}
+
 // User Joystick Location - keeping track of white x, black x, white y, black y
 int8_t joystick_x[2];
 int8_t joystick_y[2];
 bool confirm_button_pressed[2];
-// Previous joystick input -- for edge detection (true if the button / joystick was pressed in the previous detection cycle)
-bool prev_confirm_button_pressed[2];
-bool prev_joystick_neutral[2];
 // Promotion Joystick Selection - index of promotion piece selected (0,1,2,3)
 int8_t promotion_joystick_selection;  // only happening on one player's turn, so no need for 2
 // Joystick selection for idle screen difficulty selection
@@ -980,13 +632,12 @@ void move_user_joystick_x_y(bool color) {
 
   // Also display the OLED if a joystick movement is detected
 
-  // Read the joystick values -- low is pressed, high is not pressed
-  update_joystick_values();  // Read joystick values from I2C
+  update_joystick_values();  // Read the joystick events from I2C (if there are new ones)
+  // Joystick levels -- low is pressed, high is not pressed
   int8_t x_val = JOYSTICK_POS_X_VALUE[color];
   int8_t y_val = JOYSTICK_POS_Y_VALUE[color];
   int8_t neg_x_val = JOYSTICK_NEG_X_VALUE[color];
   int8_t neg_y_val = JOYSTICK_NEG_Y_VALUE[color];
-  int8_t button_val = JOYSTICK_BUTTON_VALUE[color];
 
   // If all 4 directions are pressed at once, we consider this player is resigning. 
   if (x_val == 0 && neg_x_val == 0 && y_val == 0 && neg_y_val == 0) {
@@ -1004,62 +655,38 @@ void move_user_joystick_x_y(bool color) {
     return;
   }
 
-  // Update the joystick values if joystick WAS neutral and now has a value.
-  // Update neutral flag. Note active low for button (pressed is low 0)
-  if (prev_joystick_neutral[color]) {
-    // If previous joystick WAS neutral
-    bool change_happened =
-      false;  // For displaying, only serial printif change happened.
-    if (x_val == 0) {
+  // Apply the presses in the order they were made, up to the confirm button (the state machine acts on it before the
+  // rest, they stay for the next call)
+  bool change_happened = false;  // For displaying, only serial printif change happened.
+  confirm_button_pressed[color] = false;
+  uint8_t press;
+  while (!confirm_button_pressed[color] && joystick_next_press(color, press)) {
+    if (press == JOYSTICK_POS_X) {
       joystick_x[color]++;
-      prev_joystick_neutral[color] = false;
-      change_happened = true;
-    } else if (neg_x_val == 0) {
+    } else if (press == JOYSTICK_NEG_X) {
       joystick_x[color]--;
-      prev_joystick_neutral[color] = false;
-      change_happened = true;
-    } else if (y_val == 0) {
+    } else if (press == JOYSTICK_POS_Y) {
       joystick_y[color]++;
-      prev_joystick_neutral[color] = false;
-      change_happened = true;
-    } else if (neg_y_val == 0) {
+    } else if (press == JOYSTICK_NEG_Y) {
       joystick_y[color]--;
-      prev_joystick_neutral[color] = false;
-      change_happened = true;
-    }
-    // joystick x and y loop from 0 to 7
-    joystick_x[color] = (joystick_x[color] + 8) % 8;
-    joystick_y[color] = (joystick_y[color] + 8) % 8;
-    // if no joystick movement, joystick_neutral stays true
-
-    // TEMP DISPLAY CODE:
-    if (change_happened) {
-      serial_display_board_and_selection();
-
-      // Display OLED
-      display_turn_select(color, joystick_x[color], joystick_y[color], selected_x, selected_y, destination_x, destination_y, display_one, display_two);
-    }
-  } else {
-    // If previous joystick was NOT neutral
-    if (x_val == 1 && neg_x_val == 1 && y_val == 1 && neg_y_val == 1) {
-      prev_joystick_neutral[color] = true;
+    } else {
+      confirm_button_pressed[color] = true;
     }
+    change_happened |= press != JOYSTICK_BUTTON;
   }
+  // joystick x and y loop from 0 to 7
+  joystick_x[color] = (joystick_x[color] + 8) % 8;
+  joystick_y[color] = (joystick_y[color] + 8) % 8;
+  // The other player's joystick isn't used on this turn
+  joystick_press_count[!color] = 0;
 
-  // Update the confirm button pressed flag
-  // Note active low for button (pressed is low 0)
-  // Flag is true if button was pressed from previous state
-  if (button_val == 0 && prev_confirm_button_pressed[color] == 0) {
-    confirm_button_pressed[color] = true;
-  } else {
-    confirm_button_pressed[color] = false;
-    // Note: this also automatically reset the confirm_button_pressed flag
-    // If your state machine requires multiple cycles to "load in" the confirm
-    // button press, you need to remove this line from this function
+  // TEMP DISPLAY CODE:
+  if (change_happened) {
+    serial_display_board_and_selection();
+
+    // Display OLED
+    display_turn_select(color, joystick_x[color], joystick_y[color], selected_x, selected_y, destination_x, destination_y, display_one, display_two);
   }
-  // Update the previous confirm button pressed flag (true if button was
-  // pressed, but button is active low)
-  prev_confirm_button_pressed[color] = !button_val;  // active low
 }
 
 void move_user_joystick_promotion(bool color) {
@@ -1070,40 +697,26 @@ void move_user_joystick_promotion(bool color) {
 
   // Also show the OLED screen for joystick promotion selection
 
-  // Read the joystick values -- low is pressed, high is not pressed
-  update_joystick_values();  // Read joystick values from I2C
+  update_joystick_values();  // Read the joystick events from I2C (if there are new ones)
 
-  // Black joystick's left-right is reversed, so we use color to determine which joystick value corresponds to left and right
-  int8_t x_val = color ? JOYSTICK_NEG_X_VALUE[color] : JOYSTICK_POS_X_VALUE[color];
-  int8_t y_val = JOYSTICK_POS_Y_VALUE[color];
-  int8_t neg_x_val = color ? JOYSTICK_POS_X_VALUE[color] : JOYSTICK_NEG_X_VALUE[color];
-  int8_t neg_y_val = JOYSTICK_NEG_Y_VALUE[color];
-  int8_t button_val = JOYSTICK_BUTTON_VALUE[color];
-
-  // Update the joystick values if joystick WAS neutral and now has a value.
-  // Update neutral flag. Note active low for button (pressed is low 0)
+  // Apply the presses in the order they were made, up to the confirm button
   bool change_happened = false;  // For displaying, only serial printif change happened.
-
-  if (prev_joystick_neutral[color]) {
-    // If previous joystick WAS neutral
-    if (x_val == 0) {
+  confirm_button_pressed[color] = false;
+  uint8_t press;
+  while (!confirm_button_pressed[color] && joystick_next_press(color, press)) {
+    // Black joystick's left-right is reversed
+    if (press == (color ? JOYSTICK_NEG_X : JOYSTICK_POS_X)) {
       promotion_joystick_selection = (promotion_joystick_selection + 1) % 4;
-      if (promotion_joystick_selection < 0) promotion_joystick_selection = promotion_joystick_selection + 4;
-      prev_joystick_neutral[color] = false;
       change_happened = true;
-    } else if (neg_x_val == 0) {
-      promotion_joystick_selection = (promotion_joystick_selection - 1) % 4;
-      if (promotion_joystick_selection < 0) promotion_joystick_selection = promotion_joystick_selection + 4;
-      prev_joystick_neutral[color] = false;
+    } else if (press == (color ? JOYSTICK_POS_X : JOYSTICK_NEG_X)) {
+      promotion_joystick_selection = (promotion_joystick_selection + 3) % 4;
       change_happened = true;
-    }
-    // if no joystick movement, joystick_neutral stays true
-  } else {
-    // If previous joystick was NOT neutral
-    if (x_val == 1 && neg_x_val == 1 && y_val == 1 && neg_y_val == 1) {
-      prev_joystick_neutral[color] = true;
+    } else if (press == JOYSTICK_BUTTON) {
+      confirm_button_pressed[color] = true;
     }
   }
+  // Only the promoting player's joystick is used
+  joystick_press_count[!color] = 0;
 
   if (change_happened) {
     // TEMP DISPLAY CODE:
@@ -1114,19 +727,6 @@ void move_user_joystick_promotion(bool color) {
 
     display_promotion(color, promotion_joystick_selection, display_one, display_two);
   }
-
-  // Update the confirm button pressed flag
-  // Note active low for button (pressed is low 0)
-  // Flag is true if button was pressed from previous state
-  if (button_val == 0 && prev_confirm_button_pressed[color] == 0) {
-    confirm_button_pressed[color] = true;
-  } else {
-    confirm_button_pressed[color] = false;
-  }
-
-  // Update the previous confirm button pressed flag (true if button was
-  // pressed, but button is active low)
-  prev_confirm_button_pressed[color] = !button_val;  // active low
 }
 
 void move_user_joystick_idle(bool color, bool update_y, int8_t max_y) {
@@ -1141,48 +741,42 @@ void move_user_joystick_idle(bool color, bool update_y, int8_t max_y) {
 
   // Handle displaying the IDLE screen. Only run if a change happened (joystick moved or button pressed)
 
-  // Read the joystick values -- low is pressed, high is not pressed
-  update_joystick_values();  // Read joystick values from I2C
-  int8_t x_val = JOYSTICK_POS_X_VALUE[color];
-  int8_t y_val = JOYSTICK_POS_Y_VALUE[color];
-  int8_t neg_x_val = JOYSTICK_NEG_X_VALUE[color];
-  int8_t neg_y_val = JOYSTICK_NEG_Y_VALUE[color];
-  int8_t button_val = JOYSTICK_BUTTON_VALUE[color];
+  update_joystick_values();  // Read the joystick events from I2C (if there are new ones)
 
-  // Update the joystick values if joystick WAS neutral and now has a value.
-  // Update neutral flag. Note active low for button (pressed is low 0)
+  // Apply the presses in the order they were made, up to the confirm button
   bool change_happened = false;  // For displaying, only serial printif change happened.
-  if (prev_joystick_neutral[color]) {
-    // a joystick movement happened, reset the idle timer
-
-    // If previous joystick WAS neutral
-    if (x_val == 0) {
+  confirm_button_pressed[color] = false;
+  uint8_t press;
+  while (!confirm_button_pressed[color] && joystick_next_press(color, press)) {
+    if (press == JOYSTICK_POS_X) {
       idle_joystick_x[color]++;
-      prev_joystick_neutral[color] = false;
       change_happened = true;
-    } else if (neg_x_val == 0) {
+    } else if (press == JOYSTICK_NEG_X) {
       idle_joystick_x[color]--;
-      prev_joystick_neutral[color] = false;
       change_happened = true;
-    } else if (y_val == 0 && update_y) {
+    } else if (press == JOYSTICK_POS_Y && update_y) {
       idle_joystick_y[color]++;
-      prev_joystick_neutral[color] = false;
       change_happened = true;
-    } else if (neg_y_val == 0 && update_y) {
+    } else if (press == JOYSTICK_NEG_Y && update_y) {
       idle_joystick_y[color]--;
-      prev_joystick_neutral[color] = false;
       change_happened = true;
-    }
-    // joystick x and y loop from 0 to 7
-    idle_joystick_x[color] = (idle_joystick_x[color] + 2) % 2;
-    idle_joystick_y[color] = (idle_joystick_y[color] + max_y) % max_y;
-    // if no joystick movement, joystick_neutral stays true
-  } else {
-    // If previous joystick was NOT neutral, set to neutral if all joystick values are high
-    if (x_val == 1 && neg_x_val == 1 && y_val == 1 && neg_y_val == 1) {
-      prev_joystick_neutral[color] = true;
+    } else if (press == JOYSTICK_BUTTON) {
+      last_idle_change_time = game_timer.read();  // a button press happened, reset the idle timer
+      if (in_idle_screen) {
+        // We are currently in idle screen, just break out of the idle state. Don't update the joystick values
+        in_idle_screen = false;
+        // Issue: Do note that this code will have issues if both buttons are tied together. Since this case, player_0's button will trigger an "exit idle screen", but player_1's button (which is the same thing), triggers button press...
+        // This should be fine since in reality they are not the same button, and will have at least some sort of delay between them
+        display_idle_screen(game_timer, in_idle_screen, idle_joystick_x[1], idle_joystick_y[1], display_two, 1);
+        display_idle_screen(game_timer, in_idle_screen, idle_joystick_x[0], idle_joystick_y[0], display_one, 0);
+      } else {
+        confirm_button_pressed[color] = true;
+      }
     }
   }
+  // joystick x loops from 0 to 1, y from 0 to max_y - 1
+  idle_joystick_x[color] = (idle_joystick_x[color] + 2) % 2;
+  idle_joystick_y[color] = (idle_joystick_y[color] + max_y) % max_y;
 
   if (change_happened) {
     if (in_idle_screen) {
@@ -1193,31 +787,6 @@ void move_user_joystick_idle(bool color, bool update_y, int8_t max_y) {
     display_idle_screen(game_timer, in_idle_screen, idle_joystick_x[1], idle_joystick_y[1], display_two, 1);
     display_idle_screen(game_timer, in_idle_screen, idle_joystick_x[0], idle_joystick_y[0], display_one, 0);
   }
-
-  // Update the confirm button pressed flag
-  // Note active low for button (pressed is low 0)
-  // Flag is true if button was pressed from previous state
-  if (button_val == 0 && prev_confirm_button_pressed[color] == 0) {
-    last_idle_change_time = game_timer.read();  // a button press happened, reset the idle timer
-    if (in_idle_screen) {
-      // We are currently in idle screen, just break out of the idle state. Don't update the joystick values
-      in_idle_screen = false;
-      // Issue: Do note that this code will have issues if both buttons are tied together. Since this case, player_0's button will trigger an "exit idle screen", but player_1's button (which is the same thing), triggers button press...
-      // This should be fine since in reality they are not the same button, and will have at least some sort of delay between them
-      display_idle_screen(game_timer, in_idle_screen, idle_joystick_x[1], idle_joystick_y[1], display_two, 1);
-      display_idle_screen(game_timer, in_idle_screen, idle_joystick_x[0], idle_joystick_y[0], display_one, 0);
-    } else {
-      confirm_button_pressed[color] = true;
-    }
-  } else {
-    confirm_button_pressed[color] = false;
-    // Note: this also automatically reset the confirm_button_pressed flag
-    // If your state machine requires multiple cycles to "load in" the confirm
-    // button press, you need to remove this line from this function
-  }
-  // Update the previous confirm button pressed flag (true if button was
-  // pressed, but button is active low)
-  prev_confirm_button_pressed[color] = !button_val;  // active low
 }
 
 // ############################################################
@@ -1225,13 +794,8 @@ void move_user_joystick_idle(bool color, bool update_y, int8_t max_y) {
 // ############################################################
 // LED variables
 
-// Decleration for number of rows, the number of leds in a single 1x8 row,
-// and he number of nuber of leds in a row of a single 4x4 chess square
-// LED colours, led_display struct and strip length are defined.
-const uint8_t COLUMNS = 32;
-const uint8_t ROWINDEX = 7;
-const uint8_t LEDSPERROW = 128;
-const uint8_t LEDSPERSQUAREROW = 4;
+// LED colours, pattern types, led_display struct and strip length are defined.
+// Where each LED is on the strips comes from LED_MAP (LedMap.h)
 const struct CRGB CYAN(0, 255, 255);
 const struct CRGB GREEN(0, 255, 15);
 const struct CRGB YELLOW(255, 247, 18);
@@ -1254,84 +818,110 @@ struct CRGB led_display[6][STRIP_LEN];
 // Thus led_display[3] and led_display[4] are both for the 4th block of 256 LEDs
 // led_display[5] is both for the promotion LEDs, first half white, second half black
 
+// A frame of the board is drawn like before (clearLEDs, set_LED_Pattern for each highlighted square, show_LEDs), but
+// set_LED_Pattern only records the square's patterns: show_LEDs redraws the squares whose patterns changed since the
+// last frame, and only sends the strips those squares are on (and the promotion strip once its LEDs were set)
+#define LED_MAX_PATTERNS 4  // a solid pattern covers the ones before it, so a square rarely has more than 2
 
-// If we wish to add cosmetic things, add another array of "previous states", or "pre-set patterns" or other stuff
-// Also we may need a separate LED strip timer variable to keep track "how long ago was the last LED update"
-// A function to update LED strip in each situation
-
-// Takes in a chess square coordinate and a local LED coordinate. Returns index and data line of the selected LED
-// Assuming 3D coordinate system with normal out of page, (x,y) is right-handed, (u,v) is left-handed
-void coordinate_to_index(int x, int y, int u, int v, int &index, int &data_line) {
-  // NOTE: jank fix, but led is 180 degrees rotated relative to motors, so do a 180 rotation on x, y, u, v
-  x = 7 - x;
-  y = 7 - y;
-  u = 3 - u;
-  v = 3 - v;
+// Patterns of a square, in the order they were set
+struct SquareLEDs {
+  uint8_t count;
+  struct CRGB colour[LED_MAX_PATTERNS];
+  uint8_t pattern[LED_MAX_PATTERNS];
 
-  if (v % 2 == 0) {
-    index = u + (COLUMNS * v) + (LEDSPERSQUAREROW * x) + (LEDSPERROW * (ROWINDEX - y));
-  } else {
-    index = -u + (COLUMNS * (v + 1)) - (LEDSPERSQUAREROW * x) + (LEDSPERROW * (ROWINDEX - y)) - 1;
+  bool same(const SquareLEDs &other) const {
+    if (count != other.count) {
+      return false;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+      if (pattern[i] != other.pattern[i] || colour[i] != other.colour[i]) {
+        return false;
+      }
+    }
+    return true;
   }
+};
 
-  if (index < 928) {  // 928 is the first index of the 2nd type of LED
-    data_line = index / 256;
-    index -= data_line * 256;
-  } else {
-    data_line = 4;
-    index -= 928;
-  }
-}
+SquareLEDs shown_squares[64];  // what the strips show
+SquareLEDs frame_squares[64];  // the frame being drawn
+bool strip_changed[6];
 
 // Sets specific LED to a specific colour
 void set_LED(int x, int y, int u, int v, struct CRGB colour) {
-  int index, data_line;
-
-  coordinate_to_index(x, y, u, v, index, data_line);
-  led_display[data_line][index] = colour;
+  const LedAddress &address = LED_MAP.led[y * 8 + x][v * LED_SQUARE_SIDE + u];
+  led_display[address.strip][address.index] = colour;
+  strip_changed[address.strip] = true;
 }
 
-// Assumes a fill_solid is called before this function
-// This function will NOT reset LEDs of squares that are not being used
+// Adds a pattern to the square in the frame being drawn, on top of the ones set since clearLEDs
 void set_LED_Pattern(int x, int y, struct CRGB colour, int patternType) {
   // Pattern Types
   // 0-Solid, 1-Cursor, 2-Capture
+  SquareLEDs &square = frame_squares[y * 8 + x];
+  if (patternType == SOLID) {
+    square.count = 0;
+  } else if (square.count == LED_MAX_PATTERNS) {
+    // Drop the bottom one
+    memmove(square.colour, square.colour + 1, (LED_MAX_PATTERNS - 1) * sizeof(square.colour[0]));
+    memmove(square.pattern, square.pattern + 1, LED_MAX_PATTERNS - 1);
+    square.count--;
+  }
+  square.colour[square.count] = colour;
+  square.pattern[square.count] = patternType;
+  square.count++;
+}
 
+// Writes one pattern of a square to led_display
+void draw_LED_Pattern(int x, int y, struct CRGB colour, int patternType) {
   if (patternType == SOLID) {
-    for (int i = 0; i < LEDSPERSQUAREROW; i++) {
-      for (int j = 0; j < LEDSPERSQUAREROW; j++) {
+    for (int i = 0; i < LED_SQUARE_SIDE; i++) {
+      for (int j = 0; j < LED_SQUARE_SIDE; j++) {
         set_LED(x, y, i, j, colour);
       }
     }
   } else if (patternType == CURSOR) {
-    for (int i = 1; i < LEDSPERSQUAREROW - 1; i++) {
-      for (int j = 1; j < LEDSPERSQUAREROW - 1; j++) {
+    for (int i = 1; i < LED_SQUARE_SIDE - 1; i++) {
+      for (int j = 1; j < LED_SQUARE_SIDE - 1; j++) {
         set_LED(x, y, i, j, colour);
       }
     }
   } else if (patternType == CAPTURE) {
-    for (int i = 0; i < LEDSPERSQUAREROW; i++) {
+    for (int i = 0; i < LED_SQUARE_SIDE; i++) {
       set_LED(x, y, i, i, colour);
-      set_LED(x, y, i, LEDSPERSQUAREROW - 1 - i, colour);
+      set_LED(x, y, i, LED_SQUARE_SIDE - 1 - i, colour);
     }
   }
 }
 
-// Sets all the LEDs of the main board to off
+// Starts a new frame with all the squares of the main board off
 // Does not clear the promotion LEDs
 void clearLEDs() {
-  int led_len;
+  for (int i = 0; i < 64; i++) {
+    frame_squares[i].count = 0;
+  }
+}
 
-  for (int i = 0; i < 5; i++) {
-    if (i < 3) {
-      led_len = STRIP_LEN;
-    } else if (i == 3) {
-      led_len = 5 * (STRIP_LEN / 8);
-    } else if (i == 4) {
-      led_len = 3 * (STRIP_LEN / 8);
+// Draws the squares of the frame that changed, then sends the strips that changed
+// Use instead of FastLED.show(); set strip_changed[5] after changing the promotion LEDs
+void show_LEDs() {
+  for (int i = 0; i < 64; i++) {
+    if (frame_squares[i].same(shown_squares[i])) {
+      continue;
+    }
+    for (int j = 0; j < LED_SQUARE_COUNT; j++) {
+      set_LED(i % 8, i / 8, j % LED_SQUARE_SIDE, j / LED_SQUARE_SIDE, CRGB(0, 0, 0));
+    }
+    for (int j = 0; j < frame_squares[i].count; j++) {
+      draw_LED_Pattern(i % 8, i / 8, frame_squares[i].colour[j], frame_squares[i].pattern[j]);
+    }
+    shown_squares[i] = frame_squares[i];
+  }
+  // Controllers are in the order of the addLeds calls in setup, the same as led_display
+  for (int i = 0; i < 6; i++) {
+    if (strip_changed[i]) {
+      FastLED[i].showLeds(FastLED.getBrightness());
+      strip_changed[i] = false;
     }
-
-    fill_solid(led_display[i], led_len, CRGB(0, 0, 0));
   }
 }
 
@@ -1390,6 +980,56 @@ uint32_t last_interacted_time, last_idle_change;
 // So we don't display idle or waiting screen multiple times...
 bool idle_one, idle_two;
 
+// What each screen shows (display_one, display_two), kept across display_init / free_displays since the screens keep it
+OledScreen oled_screens[2];
+#define OLED_I2C_CLOCK 400000  // while sending to a screen, like Adafruit_SSD1306::display
+#define I2C_CLOCK 100000       // the subordinate's rate, the rest of the time
+
+// Use instead of display->display(): sends only the parts of the buffer that changed since the last time
+void display_show(Adafruit_SSD1306 *display) {
+  bool second = display == display_two;
+  uint8_t address = second ? SCREEN_ADDRESS_TWO : SCREEN_ADDRESS_ONE;
+  const uint8_t* buffer = display->getBuffer();
+  OledRegion regions[OLED_PAGES];
+  uint8_t count = oled_changed_regions(oled_screens[second], buffer, regions);
+  if (count == 0) {
+    return;
+  }
+
+  Wire.setClock(OLED_I2C_CLOCK);
+  for (uint8_t i = 0; i < count; i++) {
+    const OledRegion &region = regions[i];
+    Wire.beginTransmission(address);
+    Wire.write((uint8_t)0x00);  // commands follow
+    Wire.write((uint8_t)SSD1306_COLUMNADDR);
+    Wire.write(region.first_column);
+    Wire.write(region.last_column);
+    Wire.write((uint8_t)SSD1306_PAGEADDR);
+    Wire.write(region.first_page);
+    Wire.write(region.last_page);
+    Wire.endTransmission();
+
+    // Data fills the window a page at a time
+    Wire.beginTransmission(address);
+    Wire.write((uint8_t)0x40);  // data follows
+    uint8_t written = 1;
+    for (uint8_t page = region.first_page; page <= region.last_page; page++) {
+      for (uint16_t column = region.first_column; column <= region.last_column; column++) {
+        if (written == OLED_WIRE_MAX) {
+          Wire.endTransmission();
+          Wire.beginTransmission(address);
+          Wire.write((uint8_t)0x40);
+          written = 1;
+        }
+        Wire.write(buffer[page * OLED_COLUMNS + column]);
+        written++;
+      }
+    }
+    Wire.endTransmission();
+  }
+  Wire.setClock(I2C_CLOCK);
+}
+
 void free_displays() {
   if (!USING_OLED) {
     return;  // Don't do anything about displays if not using OLED
@@ -1484,8 +1124,9 @@ void display_idle_screen(Timer timer, bool is_idle, bool is_display_computer, ui
   }
 
   if (!is_idle) {
-    // Stop the scrolling that may be happening
+    // Stop the scrolling that may be happening (it moved the screen's content, so the next update sends all of it)
     display->stopscroll();
+    oled_invalidate(oled_screens[display == display_two]);
 
     if (!is_display_computer) {
       // Player
@@ -1573,8 +1214,8 @@ void display_turn_select(int8_t player_id, int8_t joystick_x, int8_t joystick_y,
     }
   }
 
-  display_one->display();
-  display_two->display();
+  display_show(display_one);
+  display_show(display_two);
 }
 
 // This part is run by motor code once
@@ -1621,8 +1262,8 @@ void display_while_motor_moving(int8_t player_id, int8_t selected_x, int8_t sele
     display_two->print(msg);
   }
 
-  display_one->display();
-  display_two->display();
+  display_show(display_one);
+  display_show(display_two);
 }
 
 // Only call in the promotion_joystick when joystick is moving, or right before entering the promotion select state
@@ -1666,8 +1307,8 @@ void display_promotion(int8_t player_promoting, int8_t piece, Adafruit_SSD1306 *
     }
     // Player 2 is waiting
     display_one->print(F("Your opponent is promoting..."));
-    display_one->display();
-    display_two->display();
+    display_show(display_one);
+    display_show(display_two);
 
   } else {
 
@@ -1690,8 +1331,8 @@ void display_promotion(int8_t player_promoting, int8_t piece, Adafruit_SSD1306 *
     }
     // Player 1 is waiting
     display_two->print(F("Your opponent is promoting..."));
-    display_one->display();
-    display_two->display();
+    display_show(display_one);
+    display_show(display_two);
   }
 }
 
@@ -1707,6 +1348,7 @@ void display_game_over(int8_t winner, int8_t draw, Adafruit_SSD1306 *display_one
       1 for 50 move draw
       2 for 3 fold repetition    
       3 for draw via insufficient material
+      5 for a drawn KPK / KRK / KQK endgame (bitbase)
     
     depending on winner value, the corresponding helper functions will be called to display information to each display
 
@@ -1743,7 +1385,7 @@ void display_select_player(Adafruit_SSD1306 *display) {
   display->println(F("PLAYER"));
   display->println(F("HUMAN  Comp>"));
   display->print(F("MODE"));
-  display->display();
+  display_show(display);
 }
 
 void display_select_computer(Adafruit_SSD1306 *display, uint8_t comp_diff) {
@@ -1757,7 +1399,7 @@ void display_select_computer(Adafruit_SSD1306 *display, uint8_t comp_diff) {
   display->print(F("<Human  LV:"));
   // Draw bitmap
   display->print(comp_diff + 1, DEC);
-  display->display();
+  display_show(display);
 }
 
 void display_idle_scroll(Adafruit_SSD1306 *display) {
@@ -1769,9 +1411,10 @@ void display_idle_scroll(Adafruit_SSD1306 *display) {
   display->setCursor(0, 0);
   display->println(F(" > Spark <"));
   display->print(F("SMARTCHESS"));
-  display->display();
+  display_show(display);
   // display->startscrollleft(0, 1); // (row 1, row 2). Scrolls just the first row of text.
   display->startscrollright(2, 3);  // SSD1306 can't handle two concurrent scroll directions.
+  oled_invalidate(oled_screens[display == display_two]);
 
   // Serial.print("Free memory: ");
   // Serial.println(freeMemory());
@@ -1787,6 +1430,7 @@ void display_draw(int8_t draw, Adafruit_SSD1306 *display) {
     1 for 50 move draw
     2 for 3 fold repetition    
     3 for draw via insufficient material 
+    5 for a drawn KPK / KRK / KQK endgame (bitbase)
 
   */
 
@@ -1811,11 +1455,15 @@ void display_draw(int8_t draw, Adafruit_SSD1306 *display) {
 
     display->println(F("Insufficient material!"));
 
+  } else if (draw == 5) {
+
+    display->println(F("Known draw!"));
+
   } else {
     return;
   }
 
-  display->display();
+  display_show(display);
 }
 
 void display_winner(int8_t winner, Adafruit_SSD1306 *display) {
@@ -1831,7 +1479,7 @@ void display_winner(int8_t winner, Adafruit_SSD1306 *display) {
   else display->print("Black");
   display->println(F(" wins!"));
 
-  display->display();
+  display_show(display);
 }
 
 void display_loser(int8_t loser, Adafruit_SSD1306 *display) {
@@ -1847,7 +1495,7 @@ void display_loser(int8_t loser, Adafruit_SSD1306 *display) {
   else display->print("Black");
   display->print(F(" loses!"));
 
-  display->display();
+  display_show(display);
 }
 // ############################################################
 // #                           UTIL                           #
@@ -1866,17 +1514,16 @@ void serial_display_board_and_selection() {
   for (int8_t row = 7; row >= 0; row--) {
     for (int8_t col = 0; col < 8; col++) {
       bool showed = false;
-      for (int i = 0; i < all_moves[selected_y][selected_x].size(); i++) {
-        if (selected_x == -1 || selected_y == -1) {
-          break;
-        }
-        if (all_moves[selected_y][selected_x][i].second % 8 == col && all_moves[selected_y][selected_x][i].second / 8 == row) {
+      int8_t selected_square = selected_y * 8 + selected_x;
+      for (uint8_t i = 0; selected_x != -1 && selected_y != -1 && i < all_moves.count_from(selected_square); i++) {
+        Move move = all_moves.from(selected_square, i);
+        if (move_capture_square(move) == row * 8 + col) {
           Serial.print("X");
           Serial.print("\t");
           showed = true;
           break;
         }
-        if (all_moves[selected_y][selected_x][i].first % 8 == col && all_moves[selected_y][selected_x][i].first / 8 == row) {
+        if (move_to(move) == row * 8 + col) {
           Serial.print("O");
           Serial.print("\t");
           showed = true;
@@ -1886,13 +1533,13 @@ void serial_display_board_and_selection() {
       if (showed) {
         continue;
       }
-      if (p_board->pieces[row][col]->get_type() == EMPTY) {
+      if (p_board->piece_at(col, row).get_type() == EMPTY) {
         Serial.print(" ");
       } else {
-        // Print CHESS_PIECE_CHAR[p_board->pieces[row][col]->get_type() +
-        // 6*p_board->pieces[row][col]->get_color()];
+        // Print CHESS_PIECE_CHAR[p_board->piece_at(col, row).get_type() +
+        // 6*p_board->piece_at(col, row).get_color()];
         Serial.print(
-          CHESS_PIECE_CHAR[p_board->pieces[row][col]->get_type() + 6 * p_board->pieces[row][col]->get_color()]);
+          CHESS_PIECE_CHAR[p_board->piece_at(col, row).get_type() + 6 * p_board->piece_at(col, row).get_color()]);
       }
       Serial.print("\t");
     }
@@ -1938,6 +1585,19 @@ void setup() {
   LEDS.addLeds<WS2812B, 26, GRB>(led_display[5], 2 * PROMOTION_STRIP_LEN);
   FastLED.setBrightness(dim8_lin(LED_BRIGHTNESS));
 
+  // Done line of the motor subordinate (rising edge = its queue of moves is finished)
+  pinMode(MOTOR_DONE_PIN, INPUT);
+  attachInterrupt(digitalPinToInterrupt(MOTOR_DONE_PIN), motor_done_isr, RISING);
+
+  // Event line of the subordinate (rising edge = it has joystick events queued)
+  pinMode(JOYSTICK_EVENT_PIN, INPUT);
+  attachInterrupt(digitalPinToInterrupt(JOYSTICK_EVENT_PIN), joystick_event_isr, RISING);
+
+  // Transposition table of the local engine (moves to PSRAM if the board has it)
+  if (!search.table.init()) {
+    Serial.println("Transposition table: PSRAM allocation failed, using SRAM");
+  }
+
   // Initial game state
   game_state = GAME_POWER_ON;
 }
@@ -1991,10 +1651,7 @@ void loop() {
     joystick_y[1] = 7;
     confirm_button_pressed[0] = false;
     confirm_button_pressed[1] = false;
-    prev_confirm_button_pressed[0] = true;  // Assume the button is pressed before the game starts, so force user to release the button
-    prev_confirm_button_pressed[1] = true;
-    prev_joystick_neutral[0] = true;
-    prev_joystick_neutral[1] = true;
+    joystick_discard_presses();  // Presses from before don't count, a held button has to be released and pressed again
 
     idle_joystick_x[0] = 0;
     idle_joystick_y[0] = 0;
@@ -2014,36 +1671,32 @@ void loop() {
     display_idle_screen(game_timer, in_idle_screen, idle_joystick_x[0], idle_joystick_y[0], display_one, 0);
 
     Serial.print("Game Power ON7");
-    // STOCKFISHTODO: Read from stockfish data pins until we get 10101010101010.... or 01010101010101... Then set OVERWRITE pin to true.
-    pinMode(clk, OUTPUT);
-    pinMode(RValid, INPUT);
-    pinMode(RReady, OUTPUT);
-    pinMode(RData, INPUT);
-    pinMode(WValid, OUTPUT);
-    pinMode(WReady, INPUT);
-    pinMode(WData, OUTPUT);
-    pinMode(OVERWRITE, OUTPUT);
-
-    Serial.print("Game Power ON8");
-
-    // Set initial state of pins
-    digitalWrite(clk, LOW);
-    digitalWrite(RReady, LOW);
-    digitalWrite(WValid, LOW);
-    digitalWrite(WData, LOW);
-    digitalWrite(OVERWRITE, LOW);
-    Serial.print("Game Power ON9");
-    bool initialized = false;
-
-    // Wait for the stockfish to initialize
-    while (!initialized && USING_STOCKFISH) {  // skip if not using stockfish
-      stockfish_received_data = stockfish_read();
-      if (stockfish_received_data == 0b10101010101010 || stockfish_received_data == 0b01010101010101) {
-        initialized = true;
-        digitalWrite(OVERWRITE, HIGH);
+    // Pi link on UART2, then wait for the Pi to say hello (stockfish is running). Then set OVERWRITE pin to true.
+    // Only the first time: GAME_RESET comes back here after every game, and the Pi only says hello once per session
+    // (beginning the link again would also start a new session the Pi doesn't know about)
+    if (!pi_link_started) {
+      Serial2.begin(PI_LINK_BAUD, SERIAL_8N1, PI_LINK_RX_PIN, PI_LINK_TX_PIN);
+      pi_link.begin(&pi_channel);
+      pinMode(OVERWRITE, OUTPUT);
+
+      Serial.print("Game Power ON8");
+
+      // Set initial state of pins
+      digitalWrite(OVERWRITE, LOW);
+      Serial.print("Game Power ON9");
+      bool initialized = false;
+
+      // Wait for the stockfish to initialize
+      PiMessage hello;
+      while (!initialized && USING_STOCKFISH) {  // skip if not using stockfish
+        if (pi_link.wait_for(PI_MSG_HELLO, hello, 1000)) {
+          initialized = true;
+          digitalWrite(OVERWRITE, HIGH);
+        }
       }
+      pi_link_started = true;
+      Serial.println("Stockfish initialized");
     }
-    Serial.println("Stockfish initialized");
 
     // TODO
     game_state = GAME_IDLE;
@@ -2114,7 +1767,7 @@ void loop() {
 
     // Board LED IDLE animation
     idleAnimationLEDs(in_idle_screen, game_timer.read(), player_ready[0], player_ready[1]);
-    FastLED.show();
+    show_LEDs();
 
     // OLED display: show the current selection
     // TODO:
@@ -2128,38 +1781,27 @@ void loop() {
 
       // STOCKFISHTODO: Send player types and game difficulty of BOTH players to Stockfish
       // STOCKFISHTODO: If white is a computer, also write all zeros to indicate a beginning move
-      if (USING_STOCKFISH) {
-        // Remember if players are human or computer
-        // 0 = human, 1 = computer
-        player_is_computer[0] = idle_joystick_x[0];
-        player_is_computer[1] = idle_joystick_x[1];
-        game_has_computer_player = player_is_computer[0] || player_is_computer[1];
-        if (game_has_computer_player) {
-          stockfish_write(0,                    // writing_all_zeros
-                          1,                    // is programming
-                          0,                    // programming colour
-                          !idle_joystick_x[0],  // is human
-                          idle_joystick_y[0],   // difficulty
-                          0,                    // from square (doesn't matter)
-                          0,                    // to square (doesn't matter)
-                          0,                    // is promotion (doesn't matter)
-                          0);                   // promotion square (doesn't matter)
-
-          stockfish_write(0,                    // writing_all_zeros
-                          1,                    // is programming
-                          1,                    // programming colour
-                          !idle_joystick_x[1],  // is human
-                          idle_joystick_y[1],   // difficulty
-                          0,                    // from square (doesn't matter)
-                          0,                    // to square (doesn't matter)
-                          0,                    // is promotion (doesn't matter)
-                          0);                   // promotion square (doesn't matter)
+      // Remember if players are human or computer
+      // 0 = human, 1 = computer
+      player_is_computer[0] = idle_joystick_x[0];
+      player_is_computer[1] = idle_joystick_x[1];
+      // Low difficulties (and every difficulty when not using stockfish) are played by the board itself, no Pi round trip
+      for (int8_t color = 0; color < 2; color++) {
+        computer_difficulty[color] = idle_joystick_y[color];
+        computer_uses_local_engine[color] = !USING_STOCKFISH || computer_difficulty[color] <= LOCAL_ENGINE_MAX_DIFFICULTY;
+      }
+      // Stockfish only needs to know about the game if it plays one of the sides
+      game_has_computer_player = (player_is_computer[0] && !computer_uses_local_engine[0]) ||
+                                 (player_is_computer[1] && !computer_uses_local_engine[1]);
+      if (USING_STOCKFISH && game_has_computer_player) {
+        // A side played by the local engine is a human for stockfish (it only waits for its moves)
+        // Both sides' configuration goes in one frame
+        for (int8_t color = 0; color < 2; color++) {
+          pi_link.add_config(color, !(player_is_computer[color] && !computer_uses_local_engine[color]), computer_difficulty[color]);
+        }
+        if (!pi_link.send_batch()) {
+          Serial.println("Pi link: configuration not acked");
         }
-      } else {
-        // Set both to players if not using stockfish
-        player_is_computer[0] = 0;
-        player_is_computer[1] = 0;
-        game_has_computer_player = false;
       }
 
       // reset confirm button pressed
@@ -2181,16 +1823,20 @@ void loop() {
 
     Serial.println("Game init");
     // Initialize the board
-    p_board = new Board();           // Initialize the board object to a new board
+    p_board->reset();                // Put the board back to the starting position (static, nothing is allocated)
     player_turn = 0;                 // White to move first
     current_player_under_check = 0;  // No player is under check initially
-    sources_of_check.clear();        // clean memory for sources of check
+    sources_of_check = 0;            // No sources of check initially
+    search.table.clear();            // Nothing searched yet in this game
+    move_list_cache.clear();
+    ponder_reset();
 
     // Draw reason is false by default
     draw_three_fold_repetition = false;  // If true, the game is a draw due to three fold repetition
     draw_fifty_move_rule = false;        // If true, the game is a draw due to fifty move rule
     draw_stalemate = false;              // If true, the game is a draw due to stalemate
     draw_insufficient_material = false;  // If true, the game is a draw due to insufficient material
+    draw_known_endgame = false;          // If true, the game is a draw due to a drawn KPK / KRK / KQK endgame
 
     // Currently no piece is selected, so initialize to -1, -1
     selected_x = -1;
@@ -2223,21 +1869,22 @@ void loop() {
     joystick_y[1] = 7;
     confirm_button_pressed[0] = false;
     confirm_button_pressed[1] = false;
-    prev_confirm_button_pressed[0] = true;  // Assume the button is pressed before the game starts, so force user to release the button
-    prev_confirm_button_pressed[1] = true;
-    prev_joystick_neutral[0] = true;
-    prev_joystick_neutral[1] = true;
+    joystick_discard_presses();  // Presses from before don't count, a held button has to be released and pressed again
 
     // Promotion joystick selection - default is 0 which is queen
     promotion_joystick_selection = 0;
 
-    motor_i2c(0, 0, 0, 0, 2); // Motor calibrate (state = 2)
+    motor_queue_add(0, 0, 0, 0, 2); // Motor calibrate (state = 2)
+    motor_queue_run();
 
     game_state = GAME_BEGIN_TURN;
   } else if (game_state == GAME_BEGIN_TURN) {
     // Free display memory
     free_displays();
 
+    // Presses made while the last move ran (motors, computer) don't count, as when the joysticks were only read here
+    joystick_discard_presses();
+
     // Begin a turn - generate moves, remove illegal moves, check for
     // checkmate/draw
     // This is a software state, one cycle happens here
@@ -2269,30 +1916,15 @@ void loop() {
       return;
     }
 
-    // Generate all possible moves for the player, and remove illegal moves
-    bool no_moves = true;
-    for (int8_t i = 0; i < 8; i++) {
-      for (int8_t j = 0; j < 8; j++) {
-        // Non-player's piece should have empty moves
-        all_moves[i][j].clear();
-        if (p_board->pieces[i][j]->get_type() == EMPTY || p_board->pieces[i][j]->get_color() != player_turn) {
-          continue;
-        }
-        all_moves[i][j] = p_board->pieces[i][j]->get_possible_moves(p_board);
-        p_board->remove_illegal_moves_for_a_piece(
-          j, i, all_moves[i][j]);  // NOTE it's j, i!!!!!
-        if (all_moves[i][j].size() > 0) {
-          no_moves = false;
-        }
-      }
-    }
-
-    // Find if we are under check
-    current_player_under_check = p_board->under_check(player_turn);
-    sources_of_check.clear();
-    if (current_player_under_check) {
-      sources_of_check = p_board->sources_of_check(player_turn);
+    // Generate all legal moves for the player in one pass (non-player's pieces get empty moves)
+    // This also finds the sources of check, so we know if we are under check
+    // A position that was already reached (same zobrist hash) takes its moves from the cache instead
+    if (!move_list_cache.probe(p_board->zobrist_hash, all_moves, sources_of_check)) {
+      p_board->generate_legal_moves(player_turn, all_moves, sources_of_check);
+      move_list_cache.store(p_board->zobrist_hash, all_moves, sources_of_check);
     }
+    bool no_moves = all_moves.list.size() == 0;
+    current_player_under_check = sources_of_check != 0;
 
     // If no more moves, checkmate or stalemate
     if (no_moves) {
@@ -2312,37 +1944,41 @@ void loop() {
     }
     Serial.println("No checkmate or stalemate");
 
+    // Check if the endgame bitbase (KPK, KRK, KQK) says the position is a draw with perfect play
+    // Only ends the game when the lone king is played by a computer, which never lets the win back in
+    // (a human could still blunder into a loss, so the game goes on)
+    if (p_board->probe_bitbase() == BITBASE_DRAW) {
+      bool lone_king_color = bit_count(p_board->color_bitboards[0]) == 1 ? 0 : 1;
+      if (player_is_computer[lone_king_color]) {
+        game_state = GAME_OVER_DRAW;
+        draw_known_endgame = true;
+        return;
+      }
+    }
+
+    // A computer player still in the opening book replies with the book move, before any engine is asked
+    // (only sides played by the local engine: stockfish on the Pi is already thinking about every move it plays)
+    book_move = 0;
+    if (player_is_computer[player_turn] && computer_uses_local_engine[player_turn]) {
+      book_move = find_book_move();
+    }
+
     // WE HAVE FINISHED ALL "GAME_OVER" CHECKS, tell stockfish what move just happened (this happened before the move variables are reset)
-    // STOCKFISHTODO: Send the move that was made (selected_x, selected_y, destination_x, destination_y) to stockfish
-    // STOCKFISHTODO: Also include promotion if there was any (see if promotion_type is -1 or not)
+    // The move and the position after it go in one frame, the position lets the Pi resync if it ever missed a move
     if (is_first_move) {
       // In the case of first move, only send something to stockfish if white is a computer
       is_first_move = false;
-      if (player_is_computer[0]) {
-        // If white is a computer, send all zeros to stockfish for the first move
-        stockfish_write(1,   // writing_all_zeros
-                        0,   // is programming
-                        0,   // programming colour
-                        0,   // is human
-                        0,   // difficulty
-                        0,   // from square
-                        0,   // to square
-                        0,   // is promotion (doesn't matter)
-                        0);  // promotion square (doesn't matter)
+      if (USING_STOCKFISH && player_is_computer[0] && !computer_uses_local_engine[0]) {
+        // If white is played by stockfish, the starting position tells it to make the first move
+        pi_send_position();
       }
     } else if (USING_STOCKFISH) {
       // If not first move, send the move to stockfish
       if (game_has_computer_player) {
         // Only send move to stockfish if there is a computer player, otherwise no need to send move info to stockfish
-        stockfish_write(0,                                  // writing_all_zeros
-                        0,                                  // is programming
-                        0,                                  // programming colour
-                        0,                                  // is human
-                        20,                                 // difficulty
-                        selected_y * 8 + selected_x,        // from square
-                        destination_y * 8 + destination_x,  // to square
-                        promotion_happened,                 // is promotion
-                        promotion_joystick_selection);      // promotion square
+        pi_link.add_move(selected_y * 8 + selected_x, destination_y * 8 + destination_x,
+                         promotion_happened ? pi_promotion_code(promotion_selection_type(promotion_joystick_selection)) : 0);
+        pi_send_position();
       }
     }
 
@@ -2388,12 +2024,9 @@ void loop() {
       while (true) {
         selected_x = random(0, 8);
         selected_y = random(0, 8);
-        if (all_moves[selected_y][selected_x].size() > 0) {
-          random_move_index = random(0, all_moves[selected_y][selected_x].size());
-          destination_x = all_moves[selected_y][selected_x][random_move_index].first % 8;
-          destination_y = all_moves[selected_y][selected_x][random_move_index].first / 8;
-          capture_x = all_moves[selected_y][selected_x][random_move_index].second % 8;
-          capture_y = all_moves[selected_y][selected_x][random_move_index].second / 8;
+        if (all_moves.count_from(selected_y * 8 + selected_x) > 0) {
+          random_move_index = random(0, all_moves.count_from(selected_y * 8 + selected_x));
+          set_destination_and_capture(all_moves.from(selected_y * 8 + selected_x, random_move_index));
           break;
         } else {
           continue;
@@ -2420,49 +2053,75 @@ void loop() {
     // STOCKFISHTODO: Stockfish may also return promotion piece. If so, set promotion_joystick_selection to the correct value.
     // STOCKFISHTODO: Then we directly move to GAME_MOVE_MOTOR
 
-    if (player_is_computer[player_turn]) {
-      // Receive from stockfish, convert to x,y coordinates
-      // Assuming stockfish doesn't return any errors. // TODO: if there happens to be error here we might need to check...
-      stockfish_received_data = stockfish_read();
-      int8_t stockfish_from_x = pi_return_to_from_square(stockfish_received_data) % 8;
-      int8_t stockfish_from_y = pi_return_to_from_square(stockfish_received_data) / 8;
-      int8_t stockfish_to_x = pi_return_to_to_square(stockfish_received_data) % 8;
-      int8_t stockfish_to_y = pi_return_to_to_square(stockfish_received_data) / 8;
-      int8_t stockfish_promotion = pi_return_to_promotion(stockfish_received_data);
-      selected_x = stockfish_from_x;
-      selected_y = stockfish_from_y;
-      destination_x = stockfish_to_x;
-      destination_y = stockfish_to_y;
-      promotion_joystick_selection = stockfish_promotion;
-      bool valid_move = false;
-      for (int8_t i = 0; i < all_moves[selected_y][selected_x].size(); i++) {
-        if (all_moves[selected_y][selected_x][i].first % 8 == destination_x && all_moves[selected_y][selected_x][i].first / 8 == destination_y) {
-          valid_move = true;
-          capture_x = all_moves[selected_y][selected_x][i].second % 8;
-          capture_y = all_moves[selected_y][selected_x][i].second / 8;
-          break;
-        }
+    if (player_is_computer[player_turn] && book_move) {
+      // Book move, no search needed
+      Serial.println("Opening book move");
+      selected_x = move_from(book_move) % 8;
+      selected_y = move_from(book_move) / 8;
+      set_destination_and_capture(book_move);
+      promotion_joystick_selection = 0;
+
+      // Computer move, straight to motor
+      game_state = GAME_MOVE_MOTOR;
+    } else if (player_is_computer[player_turn] && computer_uses_local_engine[player_turn] &&
+               ponder_stage == PONDER_DONE && ponder_best_move && p_board->zobrist_hash == ponder_hash) {
+      // Ponder hit: the human played the predicted move, and the answer was already searched during their turn
+      Serial.println("Ponder hit");
+      selected_x = move_from(ponder_best_move) % 8;
+      selected_y = move_from(ponder_best_move) / 8;
+      set_destination_and_capture(ponder_best_move);
+      promotion_joystick_selection = 0;  // the search only promotes to a queen
+
+      // Computer move, straight to motor
+      game_state = GAME_MOVE_MOTOR;
+    } else if (player_is_computer[player_turn] && computer_uses_local_engine[player_turn]) {
+      // Search on the game board itself (it is back to the same position afterwards), within the difficulty's time budget
+      uint32_t search_time_budget_ms;
+      int8_t search_max_depth;
+      Search::difficulty_limits(computer_difficulty[player_turn], search_time_budget_ms, search_max_depth);
+      Move computer_move = search.find_best_move(p_board, search_time_budget_ms, search_max_depth);
+      Serial.print("Local engine: depth ");
+      Serial.print(search.completed_depth);
+      Serial.print(", nodes ");
+      Serial.print(search.nodes);
+      Serial.print(", score ");
+      Serial.println(search.best_score);
+      // There is always a legal move here (no moves was caught as checkmate or stalemate in GAME_BEGIN_TURN)
+      selected_x = move_from(computer_move) % 8;
+      selected_y = move_from(computer_move) / 8;
+      set_destination_and_capture(computer_move);
+      promotion_joystick_selection = 0;  // the search only promotes to a queen
+
+      // Computer move, straight to motor
+      game_state = GAME_MOVE_MOTOR;
+    } else if (player_is_computer[player_turn]) {
+      // Receive from stockfish (the reply to the position sent last), convert to x,y coordinates
+      PiMessage reply;
+      if (pi_link.wait_for_engine_reply(pi_position_id, reply, PI_ENGINE_REPLY_TIMEOUT_MS)) {
+        selected_x = reply.body[0] % 8;
+        selected_y = reply.body[0] / 8;
+        destination_x = reply.body[1] % 8;
+        destination_y = reply.body[1] / 8;
+        promotion_joystick_selection = promotion_selection_of(pi_promotion_type(reply.body[2]));
+      } else {
+        // No reply: the local engine moves instead, at its highest difficulty
+        Serial.println("Pi link: no engine reply, using the local engine");
+        uint32_t search_time_budget_ms;
+        int8_t search_max_depth;
+        Search::difficulty_limits(LOCAL_ENGINE_MAX_DIFFICULTY, search_time_budget_ms, search_max_depth);
+        Move computer_move = search.find_best_move(p_board, search_time_budget_ms, search_max_depth);
+        selected_x = move_from(computer_move) % 8;
+        selected_y = move_from(computer_move) / 8;
+        destination_x = move_to(computer_move) % 8;
+        destination_y = move_to(computer_move) / 8;
+        promotion_joystick_selection = 0;
       }
+      bool valid_move = find_selected_move();
       if (!valid_move) {
-        // Invalid move, just take the first move.
-        for (int i = 0; i < 8; i++) {
-          bool found = false;
-          for (int j = 0; j < 8; j++) {
-            if (all_moves[i][j].size() > 0) {
-              selected_x = j;
-              selected_y = i;
-              destination_x = all_moves[i][j][0].first % 8;
-              destination_y = all_moves[i][j][0].first / 8;
-              capture_x = all_moves[i][j][0].second % 8;
-              capture_y = all_moves[i][j][0].second / 8;
-              found = true;
-              break;
-            }
-          }
-          if (found) {
-            break;
-          }
-        }
+        // Invalid move, just take the first move (the list is sorted by origin, so it's the first piece that can move)
+        selected_x = move_from(all_moves.list[0]) % 8;
+        selected_y = move_from(all_moves.list[0]) / 8;
+        set_destination_and_capture(all_moves.list[0]);
       }
 
       // Computer move, straight to motor
@@ -2478,11 +2137,17 @@ void loop() {
 
     set_LED_Pattern(joystick_x[player_turn], joystick_y[player_turn], CYAN, CURSOR);
 
-    if (p_board->under_check(player_turn % 2)) {
+    if (current_player_under_check) {
       set_LED_Pattern((player_turn % 2) ? p_board->black_king_x : p_board->white_king_x, (player_turn % 2) ? p_board->black_king_y : p_board->white_king_y, RED, SOLID);
+      // Sources of check (the checkers bitboard from generate_legal_moves)
+      uint64_t checkers = sources_of_check;
+      while (checkers) {
+        int8_t checker = pop_lsb(checkers);
+        set_LED_Pattern(checker % 8, checker / 8, RED, SOLID);
+      }
     }
 
-    FastLED.show();
+    show_LEDs();
 
     // OLED display: show the current selection
     // TODO
@@ -2495,6 +2160,9 @@ void loop() {
     
     // The code below is only for human players making moves selections. 
 
+    // Use the time the human takes to think (one short slice per loop)
+    ponder_step(-1);
+
     // Don't move until the confirm button is pressed
     if (confirm_button_pressed[player_turn]) {
       confirm_button_pressed[player_turn] = false;
@@ -2519,7 +2187,7 @@ void loop() {
       // Invalid input
       return;
     }
-    if (p_board->pieces[selected_y][selected_x]->get_type() == EMPTY || p_board->pieces[selected_y][selected_x]->get_color() != player_turn) {
+    if (p_board->piece_at(selected_x, selected_y).get_type() == EMPTY || p_board->piece_at(selected_x, selected_y).get_color() != player_turn) {
       // Not player's piece
       return;
     }
@@ -2562,18 +2230,18 @@ void loop() {
       set_LED_Pattern(previous_destination_x, previous_destination_y, YELLOW, SOLID);
     }
 
-    for (int i = 0; i < all_moves[selected_y][selected_x].size(); i++) {
-      int x_move = all_moves[selected_y][selected_x][i].first % 8;
-      int isCapture = all_moves[selected_y][selected_x][i].second;
-      int y_move = all_moves[selected_y][selected_x][i].first / 8;
+    for (uint8_t i = 0; i < all_moves.count_from(selected_y * 8 + selected_x); i++) {
+      Move move = all_moves.from(selected_y * 8 + selected_x, i);
+      int x_move = move_to(move) % 8;
+      int y_move = move_to(move) / 8;
 
-      if (isCapture != -1) {
+      if (move_flags(move) & MOVE_CAPTURE) {
         set_LED_Pattern(x_move, y_move, RED, CAPTURE);
       } else {
         set_LED_Pattern(x_move, y_move, W_WHITE, SOLID);
       }
 
-      if (p_board->under_check(player_turn % 2)) {
+      if (current_player_under_check) {
         set_LED_Pattern((player_turn % 2) ? p_board->black_king_x : p_board->white_king_x, (player_turn % 2) ? p_board->black_king_y : p_board->white_king_y, RED, SOLID);
       }
     }
@@ -2581,12 +2249,15 @@ void loop() {
     set_LED_Pattern(selected_x, selected_y, GREEN, SOLID);
     set_LED_Pattern(joystick_x[player_turn], joystick_y[player_turn], CYAN, CURSOR);
 
-    FastLED.show();
+    show_LEDs();
 
     // OLED display: show the current selection
     // TODO
     // display_turn_select()...
 
+    // Keep pondering, now on the moves of the selected piece
+    ponder_step(selected_y * 8 + selected_x);
+
     // Don't move until the confirm button is pressed
     if (confirm_button_pressed[player_turn]) {
       confirm_button_pressed[player_turn] = false;
@@ -2620,7 +2291,7 @@ void loop() {
       return;
     }
     // If we selected another piece of our own, replace selected piece
-    if (p_board->pieces[destination_y][destination_x]->get_type() != EMPTY && p_board->pieces[destination_y][destination_x]->get_color() == player_turn) {
+    if (p_board->piece_at(destination_x, destination_y).get_type() != EMPTY && p_board->piece_at(destination_x, destination_y).get_color() == player_turn) {
       // Replace selected piece, and repeat this state
       selected_x = destination_x;
       selected_y = destination_y;
@@ -2632,15 +2303,7 @@ void loop() {
       return;
     }
     // Check if the move is valid (if the destination is in the list of possible moves)
-    bool valid_move = false;
-    for (int8_t i = 0; i < all_moves[selected_y][selected_x].size(); i++) {
-      if (all_moves[selected_y][selected_x][i].first % 8 == destination_x && all_moves[selected_y][selected_x][i].first / 8 == destination_y) {
-        valid_move = true;
-        capture_x = all_moves[selected_y][selected_x][i].second % 8;
-        capture_y = all_moves[selected_y][selected_x][i].second / 8;
-        break;
-      }
-    }
+    bool valid_move = find_selected_move();
     if (!valid_move) {
       // Invalid move
       return;
@@ -2672,7 +2335,7 @@ void loop() {
     set_LED_Pattern(selected_x, selected_y, GREEN, SOLID);
     set_LED_Pattern(destination_x, destination_y, YELLOW, SOLID);
 
-    FastLED.show();
+    show_LEDs();
 
     // OLED display: show the current selection
     // TODO
@@ -2683,131 +2346,16 @@ void loop() {
     Serial.println("Moving piece by motor");
     // Serial.println(freeMemory());
 
-    // Check if capture:
-    if (capture_x != -1) {
-      // See if the captured piece is a temp piece
-      bool captured_piece_is_temp = false;
-      int8_t captured_temp_piece_x = -1;
-      int8_t captured_temp_piece_y = -1;
-      for (int8_t i = 0; i < promoted_pawns_using_temp_pieces.size(); i++) {
-        if (promoted_pawns_using_temp_pieces[i].first == capture_x && promoted_pawns_using_temp_pieces[i].second == capture_y) {
-          captured_piece_is_temp = true;
-          break;
-        }
-      }
-
-      if (captured_piece_is_temp) {
-        // The captured piece is a temp piece, so just move to graveyard (6 == temp piece)
-        std::pair<int8_t, int8_t> graveyard_coordinate =
-          get_graveyard_empty_coordinate(6, p_board->pieces[capture_y][capture_x]->get_color());
-        // Motor move the piece from capture_x, capture_y to graveyard_coordinate
-        motor_i2c(capture_x, capture_y, graveyard_coordinate.first, graveyard_coordinate.second, true);
-        // Update the graveyard memory
-        graveyard[10 + p_board->pieces[capture_y][capture_x]->get_color()]++;
-        // Remove the promoted pawn from the vector
-        for (int8_t i = 0; i < promoted_pawns_using_temp_pieces.size(); i++) {
-          if (promoted_pawns_using_temp_pieces[i].first == capture_x && promoted_pawns_using_temp_pieces[i].second == capture_y) {
-            promoted_pawns_using_temp_pieces.erase(promoted_pawns_using_temp_pieces.begin() + i);
-            break;
-          }
-        }
-      } else {
-        // The captured piece is not a temp, do the regular replacement
-        bool capture_piece_can_replace_promoted_pawn = false;
-        // This part is about seeing if the captured piece can replace a
-        // promoted pawn. So, we can add a check to see if captured-piece is a temp piece
-        for (int8_t i = 0; i < promoted_pawns_using_temp_pieces.size(); i++) {
-          // Check for all promoted pawns, if colour matches captured_x,
-          // captured_y's piece AND type matches If they do match, tell the
-          // motor to make a replacement.
-          int8_t pawn_x = promoted_pawns_using_temp_pieces[i].first;
-          int8_t pawn_y = promoted_pawns_using_temp_pieces[i].second;
-          if (p_board->pieces[capture_y][capture_x]->get_color() == p_board->pieces[pawn_y][pawn_x]->get_color() && p_board->pieces[capture_y][capture_x]->get_type() == p_board->pieces[pawn_y][pawn_x]->get_type()) {
-            // There exists a promoted pawn that can be replaced by the captured
-            // piece Move temp piece to graveyard (6 == temp piece)
-            std::pair<int8_t, int8_t> graveyard_coordinate =
-              get_graveyard_empty_coordinate(6, p_board->pieces[pawn_y][pawn_x]->get_color());
-            motor_i2c(pawn_x, pawn_y, graveyard_coordinate.first, graveyard_coordinate.second, true);
-
-            // Move captured piece to the pawn's location (use safe move)
-            motor_i2c(capture_x, capture_y, pawn_x, pawn_y, true);
-
-            // Remove the promoted pawn from the vector - since it's replaced,
-            // and can be treated as a normal piece
-            promoted_pawns_using_temp_pieces.erase(promoted_pawns_using_temp_pieces.begin() + i);
-            // Update the graveyard memory for the temp piece
-            graveyard[10 + p_board->pieces[pawn_y][pawn_x]->get_color()]++;
-            capture_piece_can_replace_promoted_pawn = true;
-            break;
-          }
-        }
-
-        if (!capture_piece_can_replace_promoted_pawn) {
-          // If the captured piece cannot replace a promoted pawn, move the
-          // captured piece to the graveyard
-          PieceType captured_piece_type =
-            p_board->pieces[capture_y][capture_x]->get_type();
-          int8_t graveyard_index = 0;
-          if (captured_piece_type == QUEEN) {
-            graveyard_index = 0;
-          } else if (captured_piece_type == ROOK) {
-            graveyard_index = 1;
-          } else if (captured_piece_type == BISHOP) {
-            graveyard_index = 2;
-          } else if (captured_piece_type == KNIGHT) {
-            graveyard_index = 3;
-          } else if (captured_piece_type == PAWN) {
-            graveyard_index = 4;
-          }
-
-          // Move the captured piece to graveyard (graveyard_index is 0 to 4,
-          // plus 1 for get_graveyard_empty_coordinate function as it takes 1 to 5,
-          // and 6 for temp piece)
-          std::pair<int8_t, int8_t> graveyard_coordinate =
-            get_graveyard_empty_coordinate(graveyard_index + 1, p_board->pieces[capture_y][capture_x]->get_color());
-          motor_i2c(capture_x, capture_y, graveyard_coordinate.first, graveyard_coordinate.second, true);
+    // Captured piece to the graveyard (or in place of a promoted pawn of its kind, whose temp piece goes back), the
+    // moving piece, the castling rook: in the order with the least travel from where the gantry is
+    // (MotionScheduler.h). graveyard and promoted_pawns_using_temp_pieces are updated to what the moves leave
+    motion_add_move(motion, *p_board, graveyard, promoted_pawns_using_temp_pieces, selected_x, selected_y,
+                    destination_x, destination_y, capture_x, capture_y);
+    motion_queue_steps();
 
-          // If colour is black, add 5 to the index, and update the graveyard
-          graveyard_index += 5 * p_board->pieces[capture_y][capture_x]->get_color();
-          graveyard[graveyard_index]++;
-        }
-      }
-    }
-    // Move the piece - regardless of capture
-    // If the piece that's moving is a temp piece, edit its coordinates in the
-    // promoted_pawns_using_temp_pieces vector
-    for (int8_t i = 0; i < promoted_pawns_using_temp_pieces.size(); i++) {
-      if (promoted_pawns_using_temp_pieces[i].first == selected_x && promoted_pawns_using_temp_pieces[i].second == selected_y) {
-        promoted_pawns_using_temp_pieces[i].first = destination_x;
-        promoted_pawns_using_temp_pieces[i].second = destination_y;
-        break;
-      }
-    }
-    // Move the piece (fast move except knight)
-    motor_i2c(selected_x, selected_y, destination_x, destination_y, p_board->pieces[selected_y][selected_x]->get_type() == KNIGHT);
-
-    // If the piece is a king that moved 2 squares, move the rook (castling)
-    if (p_board->pieces[selected_y][selected_x]->get_type() == KING && abs(destination_x - selected_x) == 2) {
-      // Castling move
-      int8_t rook_x = 0;
-      int8_t rook_y = 0;
-      if (destination_x - selected_x == 2) {
-        // King side castling
-        rook_x = 7;
-        rook_y = selected_y;
-      } else {
-        // Queen side castling
-        rook_x = 0;
-        rook_y = selected_y;
-      }
-      // Move the rook (BEWARE, THIS ROOK MOVE NEEDS TO MOVE ALONG THE EDGE, NOT LIKE ANY REGULAR ROOK MOVE)
-      // HAVE TO GO AROUND THE KING
-      motor_i2c(rook_x, rook_y, (selected_x + destination_x) / 2, selected_y, true);
-    }
-
-    // TODO: motor should move back to origin and calibrate
-
-    // Since motor movements are blocking, we can update the board state right after the motor movement
+    // Capture, move and castling rook go out together, and motor_queue_run blocks until they are done,
+    // so we can update the board state right after the motor movement
+    motor_queue_run();
     game_state = GAME_END_MOVE;
   } else if (game_state == GAME_END_MOVE) {
     // Update chess board, see if a pawn can promote
@@ -2891,8 +2439,9 @@ void loop() {
       led_display[5][14+offset] = CRGB(255, 0, 0);
       led_display[5][15+offset] = CRGB(255, 0, 0);
     }
+    strip_changed[5] = true;
 
-    FastLED.show();
+    show_LEDs();
 
     // OLED display: show the current selection
     // TODO
@@ -2924,20 +2473,7 @@ void loop() {
     }
 
     // Valid promotion piece, promote the pawn in software
-    switch (promotion_type) {
-      case 0:
-        p_board->promote_pawn(destination_x, destination_y, QUEEN);
-        break;
-      case 3:
-        p_board->promote_pawn(destination_x, destination_y, ROOK);
-        break;
-      case 2:
-        p_board->promote_pawn(destination_x, destination_y, BISHOP);
-        break;
-      case 1:
-        p_board->promote_pawn(destination_x, destination_y, KNIGHT);
-        break;
-    }
+    p_board->promote_pawn(destination_x, destination_y, promotion_selection_type(promotion_type));
     // Move to motor moving
     game_state = GAME_PAWN_PROMOTION_MOTOR;
   } else if (game_state == GAME_PAWN_PROMOTION_MOTOR) {
@@ -2964,66 +2500,15 @@ void loop() {
     // TODO
     // display_promotion()...
 
-    // Check if there's a valid piece in the graveyard to be used for promotion
-    bool valid_graveyard_piece = false;
-    PieceType promotion_piece_type =
-      p_board->pieces[destination_y][destination_x]->get_type();
-    int8_t graveyard_index = 0;
-    if (promotion_piece_type == QUEEN) {
-      graveyard_index = 0;
-    } else if (promotion_piece_type == ROOK) {
-      graveyard_index = 1;
-    } else if (promotion_piece_type == BISHOP) {
-      graveyard_index = 2;
-    } else if (promotion_piece_type == KNIGHT) {
-      graveyard_index = 3;
-    }
-    // If colour is black, add 5 to the index
-    graveyard_index +=
-      5 * p_board->pieces[destination_y][destination_x]->get_color();
-    if (graveyard[graveyard_index] > 0) {
-      valid_graveyard_piece = true;
-    }
-
-    // Move pawn to graveyard regardless of promotion (5 == pawn in function,
-    // but index is 4 + 5*color)
-    std::pair<int8_t, int8_t> graveyard_coordinate = get_graveyard_empty_coordinate(
-      5, p_board->pieces[destination_y][destination_x]->get_color());
-    motor_i2c(destination_x, destination_y, graveyard_coordinate.first, graveyard_coordinate.second, true);
-    graveyard[4 + 5 * p_board->pieces[destination_y][destination_x]->get_color()]++;
-
-    // If there is a valid piece in the graveyard, use that piece for promotion
-    if (valid_graveyard_piece) {
-      // Move the graveyard piece to the destination (the graveyard index is now
-      // 0,1,2,3 or 5,6,7,8, convert back to 1,2,3,4 for the
-      // get_graveyard_empty_coordinate function)
-
-      // Update the graveyard memory before moving the piece, since the get_graveyard_empty_coordinate function only gets the next empty spot, but we want the PIECE spot
-      graveyard[graveyard_index]--;
-
-      // Obtain the graveyard coordinate for the piece, and move the piece
-      graveyard_coordinate = get_graveyard_empty_coordinate(
-        graveyard_index - p_board->pieces[destination_y][destination_x]->get_color() * 5 + 1, p_board->pieces[destination_y][destination_x]->get_color());
-      motor_i2c(graveyard_coordinate.first, graveyard_coordinate.second, destination_x, destination_y, true);
-    } else {
-      // There isn't a valid piece in the graveyard, use a temp piece
-
-      // Update the graveyard memory so the get_graveyard_empty_coordinate returns the coordinate of the first available temp piece
-      graveyard[10 + p_board->pieces[destination_y][destination_x]->get_color()]--;
-
-      // Move a temp piece to the destination (6 == temp piece)
-      graveyard_coordinate = get_graveyard_empty_coordinate(
-        6, p_board->pieces[destination_y][destination_x]->get_color());
-      motor_i2c(graveyard_coordinate.first, graveyard_coordinate.second, destination_x, destination_y, true);
-
-      // Update the promoted pawns using temp pieces vector (add this promoted pawn)
-      promoted_pawns_using_temp_pieces.push_back(
-        std::make_pair(destination_x, destination_y));
-    }
-
-    // TODO: motor should move back to origin and calibrate
+    // Pawn to the graveyard, then a piece of the promoted type from the graveyard, or a temp piece (kept track of in
+    // promoted_pawns_using_temp_pieces), starting from where the move left the gantry
+    motion_add_promotion(motion, *p_board, p_board->piece_at(destination_x, destination_y).get_type(),
+                         p_board->piece_at(destination_x, destination_y).get_color(), graveyard,
+                         promoted_pawns_using_temp_pieces, destination_x, destination_y);
+    motion_queue_steps();
 
     // Proceed to next state, since this state is blocking
+    motor_queue_run();
     game_state = GAME_END_TURN;
   } else if (game_state == GAME_END_TURN) {
     // Record the move that just happened (selected_x, selected_y, destination_x, destination_y) as the "previous move"
@@ -3039,15 +2524,17 @@ void loop() {
     // End a turn - switch player
     player_turn = !player_turn;
 
-    motor_i2c(0, 0, 0, 0, 2); // Motor calibrate (state = 2)
+    motor_queue_add(0, 0, 0, 0, 2); // Motor calibrate (state = 2)
+    motor_queue_run();
 
     // Turn off promotion LED light if that was on. (if you have a separate LED
     // for promotion indicator)
     for (int i = 0; i < 2*PROMOTION_STRIP_LEN; i++) {
       led_display[5][i] = CRGB(0, 0, 0);
     }
+    strip_changed[5] = true;
 
-    FastLED.show();
+    show_LEDs();
 
     game_state = GAME_BEGIN_TURN;
   } else if (game_state == GAME_OVER_WHITE_WIN) {
@@ -3069,18 +2556,19 @@ void loop() {
     Serial.println("White wins!");
 
     // Flash green under winner pieces, red under loser pieces.
-    for (int8_t i = 0; i < 8; i++) {
-      for (int8_t j = 0; j < 8; j++) {
-        // if not empty and white, green. if not empty and black, red
-        if (p_board->pieces[i][j]->get_type() != EMPTY && p_board->pieces[i][j]->get_color() == 0) {
-          set_LED_Pattern(j, i, GREEN, SOLID);
-        } else if (p_board->pieces[i][j]->get_type() != EMPTY && p_board->pieces[i][j]->get_color() == 1) {
-          set_LED_Pattern(j, i, RED, SOLID);
-        }
-      }
+    // Only the live pieces are visited (white pieces green, black pieces red)
+    uint64_t winner_pieces = p_board->color_bitboards[0];
+    while (winner_pieces) {
+      int8_t square = pop_lsb(winner_pieces);
+      set_LED_Pattern(square % 8, square / 8, GREEN, SOLID);
+    }
+    uint64_t loser_pieces = p_board->color_bitboards[1];
+    while (loser_pieces) {
+      int8_t square = pop_lsb(loser_pieces);
+      set_LED_Pattern(square % 8, square / 8, RED, SOLID);
     }
 
-    FastLED.show();
+    show_LEDs();
 
     game_state = GAME_RESET;
   } else if (game_state == GAME_OVER_BLACK_WIN) {
@@ -3099,18 +2587,19 @@ void loop() {
     Serial.println("Black wins!");
 
     // Flash green under winner pieces, red under loser pieces.
-    for (int8_t i = 0; i < 8; i++) {
-      for (int8_t j = 0; j < 8; j++) {
-        // if not empty and black, green. if not empty and white, red
-        if (p_board->pieces[i][j]->get_type() != EMPTY && p_board->pieces[i][j]->get_color() == 1) {
-          set_LED_Pattern(j, i, GREEN, SOLID);
-        } else if (p_board->pieces[i][j]->get_type() != EMPTY && p_board->pieces[i][j]->get_color() == 0) {
-          set_LED_Pattern(j, i, RED, SOLID);
-        }
-      }
+    // Only the live pieces are visited (black pieces green, white pieces red)
+    uint64_t winner_pieces = p_board->color_bitboards[1];
+    while (winner_pieces) {
+      int8_t square = pop_lsb(winner_pieces);
+      set_LED_Pattern(square % 8, square / 8, GREEN, SOLID);
+    }
+    uint64_t loser_pieces = p_board->color_bitboards[0];
+    while (loser_pieces) {
+      int8_t square = pop_lsb(loser_pieces);
+      set_LED_Pattern(square % 8, square / 8, RED, SOLID);
     }
 
-    FastLED.show();
+    show_LEDs();
 
     game_state = GAME_RESET;
   } else if (game_state == GAME_OVER_DRAW) {
@@ -3138,6 +2627,9 @@ void loop() {
     } else if (draw_insufficient_material) {
       Serial.println("Insufficient material");
       display_game_over(0, 4, display_one, display_two);
+    } else if (draw_known_endgame) {
+      Serial.println("Known drawn endgame");
+      display_game_over(0, 5, display_one, display_two);
     }
     free_displays();
 
@@ -3150,7 +2642,7 @@ void loop() {
           }
         }
       }
-      FastLED.show();
+      show_LEDs();
       clearLEDs();
       delay(1000); 
       for (int8_t j = 0; j < 8; j++) {
@@ -3160,19 +2652,33 @@ void loop() {
           }
         }
       }
-      FastLED.show();
+      show_LEDs();
       clearLEDs();
       delay(1000);
     }
 
     clearLEDs();
-    FastLED.show();
+    show_LEDs();
 
     game_state = GAME_RESET;
   } else if (game_state == GAME_RESET) {
     delay(10000);
+    if (USING_OLED) {
+      // I2C bytes the screens took so far, against sending their whole buffer on every update
+      for (uint8_t i = 0; i < 2; i++) {
+        Serial.print("OLED ");
+        Serial.print(i + 1);
+        Serial.print(": ");
+        Serial.print(oled_screens[i].bytes_sent);
+        Serial.print(" of ");
+        Serial.print(oled_screens[i].bytes_full);
+        Serial.println(" bytes");
+      }
+    }
     // Reset the game (move pieces back to initial position, clear memory (mainly focusing on vectors))
 
+    // Where the pieces are before reset_board puts the graveyard back, to route the moves around them
+    Occupancy reset_occupancy = occupancy_of(*p_board, graveyard);
     std::vector<std::pair<int8_t, int8_t>> reset_moves = reset_board(p_board);
 
     // The reset_moves vector contains the (from, to) coordinate pairs. Each int8_t is a coordinate.
@@ -3193,11 +2699,14 @@ void loop() {
       Serial.print(reset_moves[reset_idx].second / 14);
       Serial.println("]");
 
-      if (reset_idx % 5 == 0) { // Calibrate every 5 instead of every move
-        motor_i2c(0, 0, 0, 0, 2); // Motor calibrate (state = 2)
+      if (reset_idx % RESET_CALIBRATE_EVERY == 0) { // Calibrate every 5 instead of every move
+        motor_queue_add(0, 0, 0, 0, 2); // Motor calibrate (state = 2)
       }
-      motor_i2c((reset_moves[reset_idx].first % 14) - 3, reset_moves[reset_idx].first / 14, (reset_moves[reset_idx].second % 14) - 3, reset_moves[reset_idx].second / 14, true);
+      MotorSegment reset_segment = {(int8_t)((reset_moves[reset_idx].first % 14) - 3), (int8_t)(reset_moves[reset_idx].first / 14), (int8_t)((reset_moves[reset_idx].second % 14) - 3), (int8_t)(reset_moves[reset_idx].second / 14), MOTOR_MODE_TAXICAB};
+      motor_queue_add_routed(reset_occupancy, reset_segment);
     }  // Convert from idx to coords by row = index / 14, col = index % 14 (8 from board + 3 + 3 from graveyards = 14)
+    // The whole reset goes to the subordinate in a few transactions (a full queue is sent on its own while adding)
+    motor_queue_run();
 
 
     // Free unnecessary memory
@@ -3207,9 +2716,6 @@ void loop() {
     // First, move the pieces back to the initial position
     // TODO: motor
 
-    // Free memory
-    delete p_board;
-
     in_idle_screen = true; // So that it goes back to idle screen after reset
 
     // Clear vectors (find ones that aren't cleared by game_initialize)
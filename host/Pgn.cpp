@@ -0,0 +1,149 @@
+#include "Pgn.h"
+#include "Board.h"
+#include "Piece.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+Move pgn_parse_san(Board &board, const char* san, PieceType &promotion) {
+  LegalMoveList moves;
+  uint64_t checkers;
+  board.generate_legal_moves(board.side_to_move, moves, checkers);
+  promotion = EMPTY;
+
+  // Castling (the destination of the king is on column g or c)
+  if (strncmp(san, "O-O", 3) == 0 || strncmp(san, "0-0", 3) == 0) {
+    int8_t to_x = (strncmp(san, "O-O-O", 5) == 0 || strncmp(san, "0-0-0", 5) == 0) ? 2 : 6;
+    for (uint16_t i = 0; i < moves.list.size(); i++) {
+      Move move = moves.list[i];
+      if ((move_flags(move) & MOVE_CASTLE) && move_to(move) % 8 == to_x) {
+        return move;
+      }
+    }
+    return 0;
+  }
+
+  // Strip check marks and annotations from the end
+  char token[16];
+  strncpy(token, san, sizeof(token) - 1);
+  token[sizeof(token) - 1] = '\0';
+  int8_t length = strlen(token);
+  while (length > 0 && strchr("+#!?", token[length - 1])) {
+    token[--length] = '\0';
+  }
+
+  // Promotion piece (e8=Q, or e8Q)
+  const char* promotion_chars = "QRBN";
+  const PieceType promotion_types[4] = {QUEEN, ROOK, BISHOP, KNIGHT};
+  if (length > 0 && strchr(promotion_chars, token[length - 1])) {
+    promotion = promotion_types[strchr(promotion_chars, token[length - 1]) - promotion_chars];
+    token[--length] = '\0';
+    if (length > 0 && token[length - 1] == '=') {
+      token[--length] = '\0';
+    }
+  }
+
+  // Moving piece (a pawn if there is no piece letter)
+  PieceType type = PAWN;
+  const char* piece_chars = "KQBNR";
+  const PieceType piece_types[5] = {KING, QUEEN, BISHOP, KNIGHT, ROOK};
+  int8_t start = 0;
+  if (length > 0 && strchr(piece_chars, token[0])) {
+    type = piece_types[strchr(piece_chars, token[0]) - piece_chars];
+    start = 1;
+  }
+
+  // Destination is the last two characters, anything between the piece and it is the origin's column/row (or 'x')
+  if (length - start < 2) {
+    return 0;
+  }
+  int8_t to_x = token[length - 2] - 'a';
+  int8_t to_y = token[length - 1] - '1';
+  if (to_x < 0 || to_x > 7 || to_y < 0 || to_y > 7) {
+    return 0;
+  }
+  int8_t from_x = -1;
+  int8_t from_y = -1;
+  for (int8_t i = start; i < length - 2; i++) {
+    if (token[i] >= 'a' && token[i] <= 'h') {
+      from_x = token[i] - 'a';
+    } else if (token[i] >= '1' && token[i] <= '8') {
+      from_y = token[i] - '1';
+    } else if (token[i] != 'x') {
+      return 0;
+    }
+  }
+
+  Move found = 0;
+  for (uint16_t i = 0; i < moves.list.size(); i++) {
+    Move move = moves.list[i];
+    int8_t from = move_from(move);
+    if (move_to(move) != to_y * 8 + to_x || code_type(board.squares[from]) != type || (move_flags(move) & MOVE_CASTLE)) {
+      continue;
+    }
+    if ((from_x != -1 && from % 8 != from_x) || (from_y != -1 && from / 8 != from_y)) {
+      continue;
+    }
+    if (found) {
+      return 0;  // ambiguous
+    }
+    found = move;
+  }
+  if (found && (move_flags(found) & MOVE_PROMOTION) && promotion == EMPTY) {
+    return 0;
+  }
+  return found;
+}
+
+bool pgn_next_token(FILE* input, char* token, uint8_t size) {
+  int c;
+  int8_t variation_depth = 0;
+  while ((c = fgetc(input)) != EOF) {
+    if (c == '{') {
+      while ((c = fgetc(input)) != EOF && c != '}') {}
+    } else if (c == ';') {
+      while ((c = fgetc(input)) != EOF && c != '\n') {}
+    } else if (c == '[' && variation_depth == 0) {
+      // Tag pair, up to the end of the line
+      while ((c = fgetc(input)) != EOF && c != '\n') {}
+    } else if (c == '(') {
+      variation_depth++;
+    } else if (c == ')') {
+      variation_depth--;
+    } else if (variation_depth > 0 || isspace(c)) {
+      continue;
+    } else {
+      uint8_t length = 0;
+      do {
+        if (length < size - 1) {
+          token[length++] = c;
+        }
+      } while ((c = fgetc(input)) != EOF && !isspace(c) && c != '{' && c != '(' && c != ')' && c != ';');
+      if (c != EOF) {
+        ungetc(c, input);
+      }
+      token[length] = '\0';
+      return true;
+    }
+  }
+  return false;
+}
+
+bool pgn_is_result(const char* token) {
+  return strcmp(token, "1-0") == 0 || strcmp(token, "0-1") == 0 || strcmp(token, "1/2-1/2") == 0 || strcmp(token, "*") == 0;
+}
+
+char* pgn_move_text(char* token) {
+  char* san = token;
+  while (isdigit(*san)) {
+    san++;
+  }
+  if (san != token && *san == '.') {
+    while (*san == '.') {
+      san++;
+    }
+    return san;
+  }
+  return token;
+}
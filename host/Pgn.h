@@ -0,0 +1,26 @@
+// Pgn.h
+// Reading PGN files on the host (book_maker, motor_sim): main line tokens, and the legal move a SAN token stands for
+
+#ifndef PGN_H
+#define PGN_H
+#include "Board.h"
+#include "Piece.h"
+#include <stdint.h>
+#include <stdio.h>
+
+// Finds the legal move a SAN token (Nf3, exd5, O-O, e8=Q+, R1a3...) stands for, 0 if there isn't exactly one
+// promotion gets the promotion piece (EMPTY if none)
+Move pgn_parse_san(Board &board, const char* san, PieceType &promotion);
+
+// Reads the next whitespace separated token of the main line, skipping tags, comments, variations and NAGs
+// Returns false at the end of the file
+bool pgn_next_token(FILE* input, char* token, uint8_t size);
+
+// True for a game result (1-0, 0-1, 1/2-1/2, *), which ends a game
+bool pgn_is_result(const char* token);
+
+// Skips the move number (1. or 1...) a token may start with (possibly glued to the move, 1.e4)
+// An empty string is left for a token that is only a move number
+char* pgn_move_text(char* token);
+
+#endif
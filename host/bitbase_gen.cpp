@@ -0,0 +1,261 @@
+// bitbase_gen.cpp
+// Generates the KPK, KRK and KQK win/draw bitbases (chess_game/BitbaseData.h) by retrograde analysis.
+// Every position (white has the piece) is set up on the engine's own Board, and its legal moves are made with make_move
+// to find the positions they lead to. Then, starting from the checkmates, positions are marked as won until nothing
+// changes: white to move wins if one of its moves wins, black to move loses if it has moves and they all lose.
+// Everything left is a draw. KQK and KRK are solved first, since pawn promotions in KPK lead into them.
+// Finally the full tables are folded and packed the way Bitbase.cpp reads them (see Bitbase.h).
+//
+// Usage: bitbase_gen > chess_game/BitbaseData.h
+
+#include "Board.h"
+#include "Bitbase.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+// Full (unfolded) table of one endgame: side to move, white king, piece, black king
+#define FULL_POSITIONS (2UL * 64 * 64 * 64)
+
+// Child of a position that is in another table (or has no table)
+#define CHILD_DRAW -1
+#define CHILD_WIN -2
+
+static uint32_t full_index(bool side_to_move, int8_t white_king, int8_t piece, int8_t black_king) {
+  return ((side_to_move * 64UL + white_king) * 64 + piece) * 64 + black_king;
+}
+
+// Result of the already solved KQK / KRK tables, for the positions KPK promotes into
+static std::vector<bool> solved_kqk;
+static std::vector<bool> solved_krk;
+
+// Solves one endgame, returns won[full_index] (legal[full_index] tells which positions are legal)
+static std::vector<bool> solve(PieceType type, std::vector<bool> &legal) {
+  const char piece_char = type == PAWN ? 'P' : type == ROOK ? 'R' : 'Q';
+  std::vector<bool> won(FULL_POSITIONS, false);
+  legal.assign(FULL_POSITIONS, false);
+  // Children of every position, children[first[i]] up to children[first[i + 1]]
+  std::vector<uint32_t> first(FULL_POSITIONS + 1, 0);
+  std::vector<int32_t> children;
+  std::vector<bool> has_moves(FULL_POSITIONS, false);
+
+  Board board;
+  LegalMoveList moves;
+  char fen[FEN_MAX_LENGTH];
+  for (uint32_t i = 0; i < FULL_POSITIONS; i++) {
+    first[i] = children.size();
+    bool side_to_move = i >> 18;
+    int8_t white_king = (i >> 12) & 63;
+    int8_t piece = (i >> 6) & 63;
+    int8_t black_king = i & 63;
+    if (white_king == piece || white_king == black_king || piece == black_king ||
+        (ATTACKS.king[white_king] & square_bit(black_king)) ||
+        (type == PAWN && (piece < 8 || piece >= 56))) {
+      continue;
+    }
+
+    // Set the position up through FEN (castling and en passant are never possible here)
+    uint8_t length = 0;
+    for (int8_t y = 7; y >= 0; y--) {
+      int8_t empty = 0;
+      for (int8_t x = 0; x < 8; x++) {
+        int8_t square = y * 8 + x;
+        char c = square == white_king ? 'K' : square == black_king ? 'k' : square == piece ? piece_char : 0;
+        if (!c) {
+          empty++;
+          continue;
+        }
+        if (empty) {
+          fen[length++] = '0' + empty;
+          empty = 0;
+        }
+        fen[length++] = c;
+      }
+      if (empty) {
+        fen[length++] = '0' + empty;
+      }
+      fen[length++] = y > 0 ? '/' : ' ';
+    }
+    snprintf(fen + length, sizeof(fen) - length, "%c - - 0 1", side_to_move ? 'b' : 'w');
+    board.from_fen(fen);
+    // The side that just moved can't be in check
+    if (board.sources_of_check(!side_to_move)) {
+      continue;
+    }
+    legal[i] = true;
+
+    uint64_t checkers;
+    board.generate_legal_moves(side_to_move, moves, checkers);
+    has_moves[i] = moves.list.size() > 0;
+    if (!has_moves[i]) {
+      // Checkmate is won, stalemate is a draw
+      won[i] = side_to_move == 1 && checkers;
+      continue;
+    }
+    for (uint16_t j = 0; j < moves.list.size(); j++) {
+      Move move = moves.list[j];
+      // A promotion is tried as a queen and as a rook (a bishop or knight can't win)
+      PieceType promotions[2] = {QUEEN, ROOK};
+      int8_t promotion_count = (move_flags(move) & MOVE_PROMOTION) ? 2 : 1;
+      for (int8_t p = 0; p < promotion_count; p++) {
+        board.make_move(move, (move_flags(move) & MOVE_PROMOTION) ? promotions[p] : EMPTY);
+        uint64_t white_pieces = board.color_bitboards[0] & ~board.piece_bitboards[0][KING];
+        if (!white_pieces) {
+          children.push_back(CHILD_DRAW);  // the piece was taken
+        } else {
+          int8_t child_piece = lsb(white_pieces);
+          int8_t child_white_king = lsb(board.piece_bitboards[0][KING]);
+          int8_t child_black_king = lsb(board.piece_bitboards[1][KING]);
+          uint32_t child = full_index(board.side_to_move, child_white_king, child_piece, child_black_king);
+          PieceType child_type = code_type(board.squares[child_piece]);
+          if (child_type == type) {
+            children.push_back(child);
+          } else {
+            const std::vector<bool> &solved = child_type == QUEEN ? solved_kqk : solved_krk;
+            children.push_back(solved[child] ? CHILD_WIN : CHILD_DRAW);
+          }
+        }
+        board.unmake_move();
+      }
+    }
+  }
+  first[FULL_POSITIONS] = children.size();
+
+  // Mark the wins until nothing changes
+  bool changed = true;
+  int iterations = 0;
+  while (changed) {
+    changed = false;
+    iterations++;
+    for (uint32_t i = 0; i < FULL_POSITIONS; i++) {
+      if (!legal[i] || won[i] || !has_moves[i]) {
+        continue;
+      }
+      bool white_to_move = !(i >> 18);
+      // White needs one winning move, black loses only if every move loses
+      bool result = !white_to_move;
+      for (uint32_t j = first[i]; j < first[i + 1]; j++) {
+        bool child_won = children[j] == CHILD_WIN || (children[j] >= 0 && won[children[j]]);
+        if (white_to_move && child_won) {
+          result = true;
+          break;
+        }
+        if (!white_to_move && !child_won) {
+          result = false;
+          break;
+        }
+      }
+      if (result) {
+        won[i] = true;
+        changed = true;
+      }
+    }
+  }
+
+  uint32_t legal_count = 0;
+  uint32_t won_count = 0;
+  for (uint32_t i = 0; i < FULL_POSITIONS; i++) {
+    legal_count += legal[i];
+    won_count += won[i];
+  }
+  fprintf(stderr, "K%cK: %lu legal positions, %lu won, %d iterations\n", piece_char, (unsigned long)legal_count,
+          (unsigned long)won_count, iterations);
+  return won;
+}
+
+static void print_table(const char* name, const std::vector<uint8_t> &bytes) {
+  printf("const uint8_t %s[%lu] PROGMEM = {", name, (unsigned long)bytes.size());
+  for (size_t i = 0; i < bytes.size(); i++) {
+    printf("%s0x%02X,", i % 16 == 0 ? "\n  " : " ", bytes[i]);
+  }
+  printf("\n};\n\n");
+}
+
+// Packs KRK / KQK: black to move, white king in the triangle. Fails if a legal white to move position isn't won
+static bool pack_kxk(const char* name, const std::vector<bool> &won, const std::vector<bool> &legal) {
+  for (uint32_t i = 0; i < FULL_POSITIONS / 2; i++) {
+    if (legal[i] && !won[i]) {
+      fprintf(stderr, "%s: a white to move position is not won, it can't be left out of the table\n", name);
+      return false;
+    }
+  }
+  std::vector<uint8_t> bytes(KXK_POSITIONS / 8, 0);
+  for (int8_t white_king = 0; white_king < 64; white_king++) {
+    for (int8_t piece = 0; piece < 64; piece++) {
+      for (int8_t black_king = 0; black_king < 64; black_king++) {
+        int8_t folded_white_king = white_king;
+        int8_t folded_piece = piece;
+        int8_t folded_black_king = black_king;
+        kxk_normalize(folded_white_king, folded_piece, folded_black_king);
+        // Only the positions that are their own folded form are stored
+        if (folded_white_king != white_king || folded_piece != piece || folded_black_king != black_king) {
+          continue;
+        }
+        if (won[full_index(1, white_king, piece, black_king)]) {
+          uint32_t index = kxk_index(white_king, piece, black_king);
+          bytes[index >> 3] |= 1 << (index & 7);
+        }
+      }
+    }
+  }
+  print_table(name, bytes);
+  return true;
+}
+
+int main() {
+  std::vector<bool> legal_kqk;
+  std::vector<bool> legal_krk;
+  std::vector<bool> legal_kpk;
+  solved_kqk = solve(QUEEN, legal_kqk);
+  solved_krk = solve(ROOK, legal_krk);
+  std::vector<bool> solved_kpk = solve(PAWN, legal_kpk);
+
+  // Check the folding: every legal position has to give the same result as its folded form
+  uint32_t mismatches = 0;
+  for (uint32_t i = 0; i < FULL_POSITIONS; i++) {
+    bool side_to_move = i >> 18;
+    int8_t white_king = (i >> 12) & 63;
+    int8_t piece = (i >> 6) & 63;
+    int8_t black_king = i & 63;
+    if (legal_kqk[i] && side_to_move) {
+      int8_t k = white_king, p = piece, b = black_king;
+      kxk_normalize(k, p, b);
+      mismatches += solved_kqk[i] != solved_kqk[full_index(1, k, p, b)];
+    }
+    if (legal_kpk[i] && piece % 8 > 3) {
+      mismatches += solved_kpk[i] != solved_kpk[full_index(side_to_move, white_king ^ 7, piece ^ 7, black_king ^ 7)];
+    }
+  }
+  if (mismatches) {
+    fprintf(stderr, "%lu positions don't match their folded form\n", (unsigned long)mismatches);
+    return 1;
+  }
+
+  printf("// BitbaseData.h file\n");
+  printf("// Generated by host/bitbase_gen, do not edit\n");
+  printf("// Only included by Bitbase.cpp, see Bitbase.h for the layout\n\n");
+  printf("#ifndef BITBASE_DATA_H\n#define BITBASE_DATA_H\n#include <stdint.h>\n#include <Arduino.h>\n\n");
+
+  std::vector<uint8_t> kpk(KPK_POSITIONS / 8, 0);
+  for (uint8_t side_to_move = 0; side_to_move < 2; side_to_move++) {
+    for (int8_t pawn = 8; pawn < 56; pawn++) {
+      if (pawn % 8 > 3) {
+        continue;
+      }
+      for (int8_t white_king = 0; white_king < 64; white_king++) {
+        for (int8_t black_king = 0; black_king < 64; black_king++) {
+          if (solved_kpk[full_index(side_to_move, white_king, pawn, black_king)]) {
+            uint32_t index = kpk_index(side_to_move, white_king, pawn, black_king);
+            kpk[index >> 3] |= 1 << (index & 7);
+          }
+        }
+      }
+    }
+  }
+  print_table("KPK_BITBASE", kpk);
+  if (!pack_kxk("KRK_BITBASE", solved_krk, legal_krk) || !pack_kxk("KQK_BITBASE", solved_kqk, legal_kqk)) {
+    return 1;
+  }
+  printf("#endif\n");
+  return 0;
+}
@@ -0,0 +1,102 @@
+// book_maker.cpp
+// Builds the opening book (chess_game/OpeningBookData.h) from a PGN file.
+// Every game is played through with the engine's own Board, and the first plies of each (book depth) are recorded as
+// (zobrist hash of the position, move) pairs. A move's weight is the number of games that played it in that position.
+// The entries are written sorted by hash, so the sketch can binary search them in flash (see OpeningBook.h).
+// Tags, comments, variations, NAGs and annotations in the PGN are skipped, only the main line is read.
+// A move that can't be read or isn't legal ends that game (and is reported on stderr).
+//
+// Usage: book_maker <pgn file> [book depth in plies, default 16] > chess_game/OpeningBookData.h
+
+#include "Board.h"
+#include "Pgn.h"
+#include "Piece.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <utility>
+
+#define DEFAULT_BOOK_DEPTH 16
+#define MAX_BOOK_ENTRIES 65535
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: book_maker <pgn file> [book depth]\n");
+    return 2;
+  }
+  FILE* input = fopen(argv[1], "r");
+  if (!input) {
+    fprintf(stderr, "can't open %s\n", argv[1]);
+    return 2;
+  }
+  int book_depth = argc > 2 ? atoi(argv[2]) : DEFAULT_BOOK_DEPTH;
+
+  // (hash, move) -> number of games, kept sorted by hash then move
+  std::map<std::pair<uint64_t, Move>, uint32_t> book;
+  Board board;
+  char token[32];
+  uint32_t games = 0;
+  uint32_t errors = 0;
+  int ply = 0;
+  bool in_game = false;
+  bool skipping = false;  // rest of a game after a bad move
+
+  while (pgn_next_token(input, token, sizeof(token))) {
+    if (pgn_is_result(token)) {
+      in_game = false;
+      continue;
+    }
+    if (!in_game) {
+      board.reset();
+      ply = 0;
+      skipping = false;
+      in_game = true;
+      games++;
+    }
+    char* san = pgn_move_text(token);
+    if (*san == '\0' || *san == '$' || skipping || ply >= book_depth) {
+      continue;
+    }
+
+    PieceType promotion;
+    Move move = pgn_parse_san(board, san, promotion);
+    if (!move) {
+      fprintf(stderr, "game %lu: can't play \"%s\" at ply %d, skipping the rest of the game\n", (unsigned long)games, san, ply);
+      errors++;
+      skipping = true;
+      continue;
+    }
+    book[std::make_pair(board.zobrist_hash, move)]++;
+    board.play_move(move, promotion);
+    ply++;
+  }
+  fclose(input);
+
+  if (book.size() > MAX_BOOK_ENTRIES) {
+    fprintf(stderr, "too many entries (%lu), use a smaller book depth\n", (unsigned long)book.size());
+    return 1;
+  }
+
+  printf("// OpeningBookData.h file\n");
+  printf("// Generated by host/book_maker from %s (%lu games, %d plies), do not edit\n", argv[1], (unsigned long)games, book_depth);
+  printf("// Only included by OpeningBook.cpp, see OpeningBook.h for the format\n\n");
+  printf("#ifndef OPENING_BOOK_DATA_H\n#define OPENING_BOOK_DATA_H\n#include <stdint.h>\n#include <Arduino.h>\n\n");
+  printf("#define OPENING_BOOK_SIZE %lu\n\n", (unsigned long)book.size());
+  printf("const uint64_t OPENING_BOOK_KEYS[OPENING_BOOK_SIZE] PROGMEM = {\n");
+  for (auto &entry : book) {
+    printf("  0x%016llXULL,\n", (unsigned long long)entry.first.first);
+  }
+  printf("};\n\n");
+  printf("const uint32_t OPENING_BOOK_MOVES[OPENING_BOOK_SIZE] PROGMEM = {\n");
+  for (auto &entry : book) {
+    uint32_t weight = entry.second > 0xFFFF ? 0xFFFF : entry.second;
+    printf("  0x%08lX,\n", (unsigned long)((weight << 16) | entry.first.second));
+  }
+  printf("};\n\n#endif\n");
+
+  fprintf(stderr, "%lu games, %lu entries (%lu bytes), %lu errors\n", (unsigned long)games, (unsigned long)book.size(),
+          (unsigned long)book.size() * 12, (unsigned long)errors);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,75 @@
+// fen_batch.cpp
+// Streams a file of FEN positions (one per line) through the engine, for bulk regression runs.
+// For each position it prints the number of legal moves, the game result the chess_game sketch would reach
+// from that position, and the position written back with to_fen (so import/export can be checked too):
+//   <legal moves> <result> <fen from to_fen>
+// Results are checked in the same order as the GAME_BEGIN_TURN state of chess_game.ino:
+//   fifty_move, insufficient_material, checkmate, stalemate, or ongoing
+// Lines that are empty or start with '#' are skipped, lines that are not valid FEN print "invalid".
+// A summary with positions/sec goes to stderr.
+//
+// Usage: fen_batch [file]   (reads stdin without a file)
+
+#include "Board.h"
+#include "Piece.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+int main(int argc, char** argv) {
+  FILE* input = stdin;
+  if (argc > 1) {
+    input = fopen(argv[1], "r");
+    if (!input) {
+      fprintf(stderr, "can't open %s\n", argv[1]);
+      return 2;
+    }
+  }
+
+  Board board;
+  // Same move list the sketch fills every turn
+  LegalMoveList moves;
+  char line[256];
+  char fen[FEN_MAX_LENGTH];
+  uint32_t positions = 0;
+  uint32_t invalid = 0;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  while (fgets(line, sizeof(line), input)) {
+    // Strip the line ending
+    line[strcspn(line, "\r\n")] = '\0';
+    if (line[0] == '\0' || line[0] == '#') {
+      continue;
+    }
+    positions++;
+    if (!board.from_fen(line)) {
+      invalid++;
+      printf("invalid %s\n", line);
+      continue;
+    }
+
+    uint64_t checkers;
+    int16_t number_of_moves = board.generate_legal_moves(board.side_to_move, moves, checkers);
+    const char* result;
+    if (board.draw_move_counter >= 50) {
+      result = "fifty_move";
+    } else if (board.is_insufficient_material()) {
+      result = "insufficient_material";
+    } else if (number_of_moves == 0) {
+      result = checkers ? "checkmate" : "stalemate";
+    } else {
+      result = "ongoing";
+    }
+    board.to_fen(fen);
+    printf("%d %s %s\n", number_of_moves, result, fen);
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  if (input != stdin) {
+    fclose(input);
+  }
+  fprintf(stderr, "%lu positions (%lu invalid) in %.3f s, %.0f positions/s\n",
+          (unsigned long)positions, (unsigned long)invalid, seconds, positions / seconds);
+  return invalid ? 1 : 0;
+}
@@ -0,0 +1,902 @@
+// motor_sim.cpp
+// Simulator of the motor subordinate (arduino_subordinate.ino), for timing move sequences without the hardware.
+// Each segment's time is worked out the way the subordinate runs it: the picker servo delays, then the stepper pulses
+// of every straight line (taxicab paths along the square edges, homing at the slow step rate).
+// The sequences go through MotorQueue like the ESP32 sends them, and the end-to-end time is compared to the old
+// protocol (one I2C transaction per segment, then a status poll every 100 ms until the subordinate says it's done).
+// Queued sequences are timed three ways: stepping at the constant STEP_DELAY rate, with the trapezoidal profile the
+// subordinate's step interrupt runs (arduino_subordinate/StepProfile.h, summed step by step), and with the profile
+// over interpolated XY lines (a move that isn't along an axis or a diagonal used to be a diagonal line, then a
+// straight one, each ramping up and down on its own).
+// The subordinate's debug prints over its 9600 baud serial port are not counted.
+//
+// Usage: motor_sim [file]         (without a file, line durations per profile, then a few typical sequences:
+//                                  quiet move, capture, castling, promotion, reset)
+//        motor_sim --pgn [file]   (every game of a PGN file, or random games, moved the way GAME_MOVE_MOTOR moves
+//                                  it: the old fixed order against MotionScheduler's, a calibration per turn,
+//                                  with each piece carried the old way and routed by PathRouter)
+//        motor_sim --reset [file] (the reset after each game of a PGN file, or of random games: distance and time of
+//                                  the old scan order against plan_reset, and routed)
+//        motor_sim --route [file] [--allow-no-route]
+//                                 (every piece carried in the games and their resets, routed around the others
+//                                  against the old lines: length, and how close it comes to another piece; exits
+//                                  with 1 if a piece is misplaced or a route comes too close to another piece, or a
+//                                  carry with no route does, unless --allow-no-route)
+// A file has one segment per line: x0 y0 x1 y1 mode (x from -3 to 10, y from 0 to 7, mode 0 direct, 1 taxicab,
+// 2 calibrate), and a line "run" sends what was queued so far (a sequence spread over several states)
+
+#include "MotorQueue.h"
+#include "StepProfile.h"
+#include "Board.h"
+#include "Piece.h"
+#include "Pgn.h"
+#include "ResetPlanner.h"
+#include "MotionScheduler.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+
+// Subordinate constants (arduino_subordinate.ino)
+static const double STEPS_PER_MM = 80;
+static const double MM_PER_SQUARE = 66.7;
+static const double GRAVEYARD_GAP = 10;
+static const double STEP_DELAY_US = 40;
+static const double SLOW_STEP_DELAY_US = 100;
+static const double MAX_STEP_RATE = 25000;
+static const double STEP_ACCELERATION = 60000;
+static const double MOVE_DELAY_MS = 400;
+static const double CALIBRATE_COORD[2] = {-3 * MM_PER_SQUARE - 17, -22};
+
+// I2C at 100 kHz: 9 clocks per byte, plus the address byte
+static const double I2C_BYTE_MS = 9 / 100.0;
+// Old protocol: the ESP32 waited 100 ms between status polls (1 byte requested each time)
+static const double POLL_PERIOD_MS = 100;
+
+// Gantry position in mm, carried from one segment to the next like the subordinate's motor_coord, and the waypoints
+// of the next move
+struct Gantry {
+  int16_t x = -(int16_t)(floor(MM_PER_SQUARE * 3) + GRAVEYARD_GAP);
+  int16_t y = 0;
+  std::vector<std::pair<int16_t, int16_t>> waypoints;
+};
+
+// Step profiles: constant at the STEP_DELAY rate (how the sketch stepped before), trapezoidal, and homing
+struct Profiles {
+  StepProfile constant;
+  StepProfile trapezoid;
+  StepProfile slow;
+
+  Profiles() {
+    double start_speed = 1e6 / (2 * STEP_DELAY_US);
+    constant.init(start_speed, start_speed, STEP_ACCELERATION);
+    trapezoid.init(start_speed, MAX_STEP_RATE, STEP_ACCELERATION);
+    slow.init(1e6 / (2 * SLOW_STEP_DELAY_US), 1e6 / (2 * SLOW_STEP_DELAY_US), STEP_ACCELERATION);
+  }
+};
+static const Profiles profiles;
+
+// How the subordinate steps: the profile, and whether a move is one interpolated line or diagonal then straight
+struct Stepping {
+  const char* name;
+  const StepProfile* profile;
+  bool interpolated;
+};
+#define STEPPINGS 3
+static const Stepping steppings[STEPPINGS] = {
+  {"constant", &profiles.constant, false},
+  {"trapezoid", &profiles.trapezoid, false},
+  {"xy line", &profiles.trapezoid, true},
+};
+
+// motor_move_line: every step of the axis with more steps is two half periods of the step interrupt
+static double line_ms(const StepProfile &profile, uint16_t x_mm, uint16_t y_mm) {
+  uint32_t count = (uint32_t)(x_mm > y_mm ? x_mm : y_mm) * STEPS_PER_MM;
+  uint64_t ticks = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    ticks += 2 * profile.half_period(i, count);
+  }
+  return ticks * 1000.0 / STEP_TIMER_HZ;
+}
+
+// motor_move: x then y for taxicab, otherwise one line (or diagonal for the shorter distance then straight)
+static double move_ms(Gantry &gantry, int16_t x, int16_t y, const StepProfile &profile, bool interpolated, bool taxicab) {
+  uint16_t x_mag = abs(x - gantry.x);
+  uint16_t y_mag = abs(y - gantry.y);
+  gantry.x = x;
+  gantry.y = y;
+  if (taxicab) {
+    return line_ms(profile, x_mag, 0) + line_ms(profile, 0, y_mag);
+  }
+  if (interpolated) {
+    return line_ms(profile, x_mag, y_mag);
+  }
+  uint16_t shorter = x_mag < y_mag ? x_mag : y_mag;
+  uint16_t longer = x_mag < y_mag ? y_mag : x_mag;
+  return line_ms(profile, shorter, shorter) + line_ms(profile, longer - shorter, 0);
+}
+
+// Square to mm, with the graveyard gap (motor_move_piece)
+static int16_t square_x_mm(int16_t x) {
+  int16_t mm = x * MM_PER_SQUARE;
+  return x < 0 ? mm - GRAVEYARD_GAP : x > 7 ? mm + GRAVEYARD_GAP : mm;
+}
+
+static int16_t clamp(int16_t value, int16_t low, int16_t high) {
+  return value < low ? low : value > high ? high : value;
+}
+
+// A straight line of a carried piece, or x then y for the middle of a taxicab move
+struct Leg {
+  int16_t x;
+  int16_t y;
+  bool taxicab;
+};
+
+// Where the subordinate carries the piece of a segment after picking it up (motor_move_piece): through the waypoints,
+// or around the taxicab detour, then to the end square
+static void carry_legs(const Gantry &gantry, const MotorSegment &segment, std::vector<Leg> &legs) {
+  int16_t x_0 = square_x_mm(segment.x0);
+  int16_t y_0 = segment.y0 * MM_PER_SQUARE;
+  int16_t x_1 = square_x_mm(segment.x1);
+  int16_t y_1 = segment.y1 * MM_PER_SQUARE;
+  legs.clear();
+  for (const std::pair<int16_t, int16_t> &waypoint : gantry.waypoints) {
+    legs.push_back({waypoint.first, waypoint.second, false});
+  }
+  if (segment.mode == MOTOR_MODE_TAXICAB && gantry.waypoints.empty()) {
+    // Half a square out of the start square, along the edges, half a square into the end square
+    int16_t half = MM_PER_SQUARE / 2;
+    int16_t x_a = clamp(x_0 <= x_1 ? x_0 + half : x_0 - half, -2.5 * MM_PER_SQUARE, 9.5 * MM_PER_SQUARE);
+    int16_t y_a = clamp(y_0 <= y_1 ? y_0 + half : y_0 - half, half, 6.5 * MM_PER_SQUARE);
+    int16_t x_b = clamp(x_0 < x_1 ? x_1 - half : x_1 + half, -2.5 * MM_PER_SQUARE, 9.5 * MM_PER_SQUARE);
+    int16_t y_b = clamp(y_0 < y_1 ? y_1 - half : y_1 + half, half, 6.5 * MM_PER_SQUARE);
+    legs.push_back({x_a, y_a, false});
+    legs.push_back({x_b, y_b, true});
+  }
+  legs.push_back({x_1, y_1, false});
+}
+
+// waypoint_add: the square, or half a square further on an axis
+static void add_waypoint(Gantry &gantry, const MotorSegment &segment) {
+  int16_t x = square_x_mm(segment.x0);
+  if (segment.x1) {
+    x = (x + square_x_mm(segment.x0 + 1)) / 2;
+  }
+  gantry.waypoints.push_back(std::make_pair(x, (int16_t)((segment.y0 + (segment.y1 ? 0.5 : 0)) * MM_PER_SQUARE)));
+}
+
+static double segment_ms(Gantry &gantry, const MotorSegment &segment, const Stepping &stepping) {
+  const StepProfile &profile = *stepping.profile;
+  bool interpolated = stepping.interpolated;
+  if (segment.mode == MOTOR_MODE_WAYPOINT) {
+    // Kept for the next segment, nothing moves
+    add_waypoint(gantry, segment);
+    return 0;
+  }
+  double ms = MOVE_DELAY_MS;
+  if (segment.mode == MOTOR_MODE_CALIBRATE) {
+    // Back to the graveyard corner, home slowly against both limit switches, then back again
+    ms += move_ms(gantry, -3 * MM_PER_SQUARE, 0, profile, interpolated, false);
+    ms += move_ms(gantry, CALIBRATE_COORD[0], gantry.y, profiles.slow, false, false);
+    ms += move_ms(gantry, gantry.x, CALIBRATE_COORD[1], profiles.slow, false, false);
+    ms += move_ms(gantry, -3 * MM_PER_SQUARE, 0, profile, interpolated, false);
+    return ms;
+  }
+  std::vector<Leg> legs;
+  carry_legs(gantry, segment, legs);
+  gantry.waypoints.clear();
+  ms += move_ms(gantry, square_x_mm(segment.x0), segment.y0 * MM_PER_SQUARE, profile, interpolated, false);
+  ms += MOVE_DELAY_MS;
+  for (const Leg &leg : legs) {
+    ms += move_ms(gantry, leg.x, leg.y, profile, interpolated, leg.taxicab);
+  }
+  ms += MOVE_DELAY_MS;
+  return ms;
+}
+
+struct Timing {
+  double old_ms = 0;
+  double queued_ms[STEPPINGS] = {};
+  uint32_t segments = 0;
+  uint32_t transactions = 0;
+};
+
+// Gantries of the runs, each ends up in the same place but gets there in its own time
+struct Gantries {
+  Gantry old_gantry;
+  Gantry queued[STEPPINGS];
+};
+
+// New way: the transactions go out back to back, the subordinate starts on the first segment as soon as it has it,
+// and the done line's interrupt ends the wait right after the last one
+// The segments go through pack / motor_unpack, as the subordinate receives them
+static double queued_ms(const MotorQueue &queue, Gantry &gantry, const Stepping &stepping, uint32_t &transactions) {
+  uint8_t buffer[1 + MOTOR_QUEUE_MAX_BATCH * MOTOR_QUEUE_SEGMENT_BYTES];
+  MotorSegment received[MOTOR_QUEUE_MAX_BATCH];
+  double arrival_ms = 0;
+  double busy_until_ms = 0;
+  for (uint8_t first = 0; first < queue.count; first += MOTOR_QUEUE_MAX_BATCH) {
+    uint8_t length = queue.pack(first, buffer);
+    arrival_ms += (1 + length) * I2C_BYTE_MS;
+    transactions++;
+    uint8_t count = motor_unpack(buffer, length, received);
+    for (uint8_t i = 0; i < count; i++) {
+      double start_ms = busy_until_ms > arrival_ms ? busy_until_ms : arrival_ms;
+      busy_until_ms = start_ms + segment_ms(gantry, received[i], stepping);
+    }
+  }
+  return busy_until_ms;
+}
+
+// Sends one queue the old way, then queued with each stepping
+static void run_queue(const MotorQueue &queue, Gantries &gantries, Timing &timing) {
+  // Old: per segment a 3 byte transaction, the segment, then polls until one lands after it is done
+  for (uint8_t i = 0; i < queue.count; i++) {
+    double busy_ms = segment_ms(gantries.old_gantry, queue.segments[i], steppings[0]);
+    double polled_ms = ceil(busy_ms / POLL_PERIOD_MS) * POLL_PERIOD_MS + 2 * I2C_BYTE_MS;
+    timing.old_ms += (1 + 3) * I2C_BYTE_MS + polled_ms;
+  }
+
+  for (uint8_t i = 0; i < STEPPINGS; i++) {
+    uint32_t transactions = 0;
+    timing.queued_ms[i] += queued_ms(queue, gantries.queued[i], steppings[i], transactions);
+    if (i == 0) {
+      timing.transactions += transactions;
+    }
+  }
+  timing.segments += queue.count;
+}
+
+// A sequence is a list of queues (one per motor_queue_run), segments as x0 y0 x1 y1 mode
+typedef std::vector<std::vector<MotorSegment>> Sequence;
+
+static Timing print_timing(const char* name, const Sequence &sequence) {
+  Gantries gantries;
+  Timing timing;
+  for (const std::vector<MotorSegment> &segments : sequence) {
+    MotorQueue queue;
+    for (const MotorSegment &segment : segments) {
+      if (!queue.add(segment.x0, segment.y0, segment.x1, segment.y1, segment.mode)) {
+        // Full: the ESP32 runs it and starts a new one (motor_queue_add)
+        run_queue(queue, gantries, timing);
+        queue.clear();
+        queue.add(segment.x0, segment.y0, segment.x1, segment.y1, segment.mode);
+      }
+    }
+    run_queue(queue, gantries, timing);
+  }
+  printf("%-10s %4lu segments %4lu transactions   old %9.1f ms", name, (unsigned long)timing.segments,
+         (unsigned long)timing.transactions, timing.old_ms);
+  for (uint8_t i = 0; i < STEPPINGS; i++) {
+    printf("   %s %9.1f ms", steppings[i].name, timing.queued_ms[i]);
+  }
+  printf("\n");
+  return timing;
+}
+
+// Straight lines per profile, then moves off the axes and diagonals, as two lines and as one interpolated line
+static void print_lines() {
+  printf("trapezoid: %.0f to %.0f steps/s at %.0f steps/s^2, cruise after %lu steps\n", 1e6 / (2 * STEP_DELAY_US),
+         MAX_STEP_RATE, STEP_ACCELERATION, (unsigned long)profiles.trapezoid.ramp_steps);
+  const double squares[] = {0.5, 1, 2, 3, 5, 7, 10};
+  for (double square : squares) {
+    uint16_t distance_mm = square * MM_PER_SQUARE;
+    double constant_ms = line_ms(profiles.constant, distance_mm, 0);
+    double trapezoid_ms = line_ms(profiles.trapezoid, distance_mm, 0);
+    printf("%4.1f squares %4u mm   constant %7.1f ms   trapezoid %7.1f ms   saved %6.1f ms\n", square, distance_mm,
+           constant_ms, trapezoid_ms, constant_ms - trapezoid_ms);
+  }
+  const int8_t moves[][2] = {{1, 2}, {3, 1}, {4, 2}, {7, 3}, {10, 4}, {10, 7}};
+  for (const int8_t* move : moves) {
+    double move_time_ms[2];
+    for (uint8_t interpolated = 0; interpolated < 2; interpolated++) {
+      Gantry gantry;
+      gantry.x = 0;
+      move_time_ms[interpolated] = move_ms(gantry, move[0] * MM_PER_SQUARE, move[1] * MM_PER_SQUARE,
+                                           profiles.trapezoid, interpolated, false);
+    }
+    printf("%2d x %d squares    diagonal + straight %7.1f ms   xy line %7.1f ms   saved %6.1f ms\n", move[0], move[1],
+           move_time_ms[0], move_time_ms[1], move_time_ms[0] - move_time_ms[1]);
+  }
+  printf("\n");
+}
+
+// A game on the board: the pieces, chess_game.ino's graveyard[] (queen to pawn, white then black, then the temp
+// pieces left of each color), the promoted pawns standing in as temp pieces, and the gantry's scheduler
+struct Game {
+  Board board;
+  int8_t graveyard[12] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8};
+  std::vector<std::pair<int8_t, int8_t>> temp_pieces;
+  MotionScheduler motion;
+  size_t first_queue = 0;  // of the game in Sequences::scheduled and routed
+};
+
+// Segments of games three ways: in the order GAME_MOVE_MOTOR used to queue them with a calibration after every turn,
+// planned by MotionScheduler but carried along the old lines, and planned and routed (PathRouter.h) like the board
+// does now. scheduled and routed have the same queues, but for the waypoints
+struct Sequences {
+  Sequence fixed;
+  Sequence scheduled;
+  Sequence routed;
+};
+
+// The steps added to the game's scheduler, in the order they are added and in the planned order, which the
+// scheduler's gantry follows
+static void take_steps(Game &game, Sequences &sequences) {
+  MotionScheduler &motion = game.motion;
+  uint8_t order[MOTION_MAX_STEPS];
+  motion.plan(order);
+  sequences.fixed.emplace_back();
+  sequences.scheduled.emplace_back();
+  sequences.routed.emplace_back();
+  for (uint8_t i = 0; i < motion.count; i++) {
+    const MotorSegment &segment = motion.steps[order[i]].segment;
+    sequences.fixed.back().push_back(motion.steps[i].segment);
+    sequences.scheduled.back().push_back(segment);
+    MotorSegment records[ROUTE_MAX_WAYPOINTS + 1];
+    uint8_t count = route_segment(motion.occupancy, segment, records);
+    sequences.routed.back().insert(sequences.routed.back().end(), records, records + count);
+    motion.moved(segment);
+  }
+  motion.clear();
+}
+
+// Plays a move like GAME_MOVE_MOTOR (capture, move, castling rook) and GAME_PAWN_PROMOTION_MOTOR (the promotion swap)
+// with the same bookkeeping (MotionScheduler.h), calibrating after every turn (GAME_END_TURN)
+static void play_move(Game &game, Move move, PieceType promotion, Sequences &sequences) {
+  const MotorSegment calibrate = {0, 0, 0, 0, MOTOR_MODE_CALIBRATE};
+  Board &board = game.board;
+  int8_t from_x = move_from(move) % 8, from_y = move_from(move) / 8;
+  int8_t to_x = move_to(move) % 8, to_y = move_to(move) / 8;
+  bool color = board.piece_at(from_x, from_y).get_color();
+  int8_t capture = move_capture_square(move);
+  motion_add_move(game.motion, board, game.graveyard, game.temp_pieces, from_x, from_y, to_x, to_y,
+                  capture == -1 ? -1 : capture % 8, capture == -1 ? -1 : capture / 8);
+  take_steps(game, sequences);
+
+  board.play_move(move, promotion);
+
+  if (move_flags(move) & MOVE_PROMOTION) {
+    motion_add_promotion(game.motion, board, promotion, color, game.graveyard, game.temp_pieces, to_x, to_y);
+    take_steps(game, sequences);
+  }
+  sequences.fixed.push_back({calibrate});
+  sequences.scheduled.push_back({calibrate});
+  sequences.routed.push_back({calibrate});
+  game.motion.moved(calibrate);
+}
+
+// Plays every game of a PGN file (see play_move), games gets how each one ended
+static bool pgn_games(const char* path, Sequences &sequences, std::vector<Game> &games, uint32_t &moves) {
+  FILE* input = fopen(path, "r");
+  if (!input) {
+    fprintf(stderr, "can't open %s\n", path);
+    return false;
+  }
+  char token[32];
+  bool in_game = false;
+  bool skipping = false;
+  while (pgn_next_token(input, token, sizeof(token))) {
+    if (pgn_is_result(token)) {
+      in_game = false;
+      continue;
+    }
+    if (!in_game) {
+      games.emplace_back();
+      games.back().first_queue = sequences.scheduled.size();
+      skipping = false;
+      in_game = true;
+    }
+    char* san = pgn_move_text(token);
+    if (*san == '\0' || *san == '$' || skipping) {
+      continue;
+    }
+    PieceType promotion;
+    Move move = pgn_parse_san(games.back().board, san, promotion);
+    if (!move) {
+      fprintf(stderr, "game %lu: can't play \"%s\", skipping the rest of the game\n", (unsigned long)games.size(), san);
+      skipping = true;
+      continue;
+    }
+    play_move(games.back(), move, promotion, sequences);
+    moves++;
+  }
+  fclose(input);
+  return true;
+}
+
+// Random games (fixed seed), up to max_plies or the end of the game, for positions with plenty of captures
+static void random_games(uint16_t count, uint16_t max_plies, Sequences &sequences, std::vector<Game> &games,
+                         uint32_t &played) {
+  uint32_t seed = 12345;
+  for (uint16_t g = 0; g < count; g++) {
+    games.emplace_back();
+    Game &game = games.back();
+    game.first_queue = sequences.scheduled.size();
+    seed = seed * 1103515245 + 12345;
+    uint16_t plies = max_plies / 4 + (seed >> 8) % (max_plies - max_plies / 4);
+    for (uint16_t ply = 0; ply < plies; ply++) {
+      LegalMoveList moves;
+      uint64_t checkers;
+      game.board.generate_legal_moves(game.board.side_to_move, moves, checkers);
+      if (moves.list.size() == 0) {
+        break;
+      }
+      seed = seed * 1103515245 + 12345;
+      Move move = moves.list[(seed >> 8) % moves.list.size()];
+      const PieceType promotions[4] = {QUEEN, QUEEN, ROOK, KNIGHT};
+      play_move(game, move, (move_flags(move) & MOVE_PROMOTION) ? promotions[(seed >> 4) % 4] : EMPTY,
+                sequences);
+      played++;
+    }
+  }
+}
+
+// The order reset_board used before plan_reset: temp pieces off in a row scan, then every other piece on the board to
+// the first free starting square of its kind in a column scan, run as chains from each square (a cycle parks its
+// first piece on (8, 0) or (-1, 7)), then the graveyard pieces kind by kind
+static std::vector<std::pair<int8_t, int8_t>> scan_reset(Game game) {
+  Board &board = game.board;
+  int8_t* graveyard = game.graveyard;
+  std::vector<std::pair<int8_t, int8_t>> moves;
+  int8_t destination[14 * 8] = {0};
+  bool taken[14 * 8] = {false};
+  const int8_t first_home[7] = {0, 4, 3, 2, 1, 0, 0};   // by PieceType, the "leftmore" square
+  const int8_t second_home[7] = {0, 4, 3, 5, 6, 7, 0};
+
+  for (int8_t y = 0; y < 8; y++) {
+    for (int8_t x = 0; x < 8; x++) {
+      Piece piece = board.piece_at(x, y);
+      if (piece.type == EMPTY || piece.type == PAWN) {
+        continue;
+      }
+      for (uint8_t i = 0; i < game.temp_pieces.size(); i++) {
+        if (game.temp_pieces[i] == std::make_pair(x, y)) {
+          std::pair<int8_t, int8_t> slot = graveyard_square(6, piece.color, graveyard[10 + piece.color]++);
+          moves.push_back(std::make_pair(RESET_SQUARE(x, y), RESET_SQUARE(slot.first, slot.second)));
+          board.set_square(x, y, EMPTY, 0);
+          break;
+        }
+      }
+    }
+  }
+
+  for (int8_t y = 0; y < 8; y++) {
+    for (int8_t x = 0; x < 8; x++) {
+      Piece piece = board.piece_at(x, y);
+      if (piece.type == EMPTY) {
+        continue;
+      }
+      int8_t row = piece.type == PAWN ? (piece.color ? 6 : 1) : (piece.color ? 7 : 0);
+      if (y == row && (piece.type == PAWN || x == first_home[piece.type] || x == second_home[piece.type])) {
+        destination[RESET_SQUARE(x, y)] = -1;
+        taken[RESET_SQUARE(x, y)] = true;
+      }
+    }
+  }
+
+  for (int8_t x = 0; x < 8; x++) {
+    for (int8_t y = 0; y < 8; y++) {
+      int8_t square = RESET_SQUARE(x, y);
+      Piece piece = board.piece_at(x, y);
+      if (piece.type == EMPTY) {
+        destination[square] = -1;
+        continue;
+      } else if (destination[square] == -1) {
+        continue;
+      }
+      if (piece.type == PAWN) {
+        int8_t row = piece.color ? 6 : 1;
+        for (int8_t k = 0; k < 8; k++) {
+          if (!taken[RESET_SQUARE(k, row)]) {
+            destination[square] = RESET_SQUARE(k, row);
+            break;
+          }
+        }
+      } else {
+        int8_t row = piece.color ? 7 : 0;
+        destination[square] = !taken[RESET_SQUARE(first_home[piece.type], row)] ? RESET_SQUARE(first_home[piece.type], row)
+                                                                               : RESET_SQUARE(second_home[piece.type], row);
+      }
+      taken[destination[square]] = true;
+      if (destination[square] == square) {
+        destination[square] = -1;
+      }
+    }
+  }
+
+  std::vector<int8_t> chain;
+  for (int8_t y = 0; y < 8; y++) {
+    for (int8_t x = 0; x < 8; x++) {
+      int8_t square = RESET_SQUARE(x, y);
+      if (destination[square] < 0) {
+        continue;
+      }
+      chain.clear();
+      bool loop = false;
+      int8_t current = square;
+      while (true) {
+        chain.push_back(current);
+        current = destination[current];
+        if (destination[current] == -1) {
+          break;
+        }
+        if (current == square) {
+          loop = true;
+          break;
+        }
+      }
+      int8_t park = x < y ? RESET_SQUARE(-1, 7) : RESET_SQUARE(8, 0);
+      if (loop) {
+        moves.push_back(std::make_pair(chain[0], park));
+        chain.erase(chain.begin());
+      }
+      while (!chain.empty()) {
+        moves.push_back(std::make_pair(chain.back(), destination[chain.back()]));
+        destination[chain.back()] = -1;
+        chain.pop_back();
+      }
+      if (loop) {
+        moves.push_back(std::make_pair(park, destination[square]));
+        destination[square] = -1;
+      }
+    }
+  }
+
+  // White takes the second starting square first and pawns from h, black the first one and pawns from a
+  const PieceType kinds[5] = {QUEEN, ROOK, BISHOP, KNIGHT, PAWN};
+  for (int8_t i = 0; i < 10; i++) {
+    while (graveyard[i] > 0) {
+      graveyard[i]--;
+      bool color = i > 4;
+      PieceType type = kinds[i % 5];
+      std::pair<int8_t, int8_t> slot = graveyard_square(i % 5 + 1, color, graveyard[i]);
+      int8_t to = -1;
+      if (type == PAWN) {
+        for (int8_t k = 0; k < 8 && to < 0; k++) {
+          int8_t pawn_square = RESET_SQUARE(color ? k : 7 - k, color ? 6 : 1);
+          if (!taken[pawn_square]) {
+            to = pawn_square;
+          }
+        }
+      } else {
+        int8_t row = color ? 7 : 0;
+        int8_t preferred = RESET_SQUARE(color ? first_home[type] : second_home[type], row);
+        int8_t other = RESET_SQUARE(color ? second_home[type] : first_home[type], row);
+        to = type == QUEEN || !taken[preferred] ? preferred : other;
+      }
+      if (to >= 0) {
+        taken[to] = true;
+        moves.push_back(std::make_pair(RESET_SQUARE(slot.first, slot.second), to));
+      }
+    }
+  }
+  return moves;
+}
+// Segments of a reset like GAME_RESET queues them: a calibration before every RESET_CALIBRATE_EVERY moves, the moves
+// along the square edges, or routed around the pieces in occupancy if there is one
+static std::vector<MotorSegment> reset_segments(const std::vector<std::pair<int8_t, int8_t>> &moves,
+                                                Occupancy* occupancy) {
+  std::vector<MotorSegment> segments;
+  for (uint16_t i = 0; i < moves.size(); i++) {
+    if (i % RESET_CALIBRATE_EVERY == 0) {
+      segments.push_back({0, 0, 0, 0, MOTOR_MODE_CALIBRATE});
+    }
+    MotorSegment segment = {(int8_t)(moves[i].first % 14 - 3), (int8_t)(moves[i].first / 14),
+                            (int8_t)(moves[i].second % 14 - 3), (int8_t)(moves[i].second / 14), MOTOR_MODE_TAXICAB};
+    if (occupancy) {
+      MotorSegment records[ROUTE_MAX_WAYPOINTS + 1];
+      uint8_t count = route_segment(*occupancy, segment, records);
+      segments.insert(segments.end(), records, records + count);
+    } else {
+      segments.push_back(segment);
+    }
+  }
+  return segments;
+}
+
+// Time of a reset, queued like motor_queue_add, on the current subordinate (trapezoidal profile, interpolated lines)
+static double reset_ms(const std::vector<MotorSegment> &segments) {
+  Gantry gantry;
+  MotorQueue queue;
+  double ms = 0;
+  uint32_t transactions = 0;
+  for (const MotorSegment &segment : segments) {
+    if (!queue.add(segment.x0, segment.y0, segment.x1, segment.y1, segment.mode)) {
+      ms += queued_ms(queue, gantry, steppings[STEPPINGS - 1], transactions);
+      queue.clear();
+      queue.add(segment.x0, segment.y0, segment.x1, segment.y1, segment.mode);
+    }
+  }
+  return ms + queued_ms(queue, gantry, steppings[STEPPINGS - 1], transactions);
+}
+
+// Resets after each game, in the old scan order and as planned by plan_reset, then planned and routed
+static void print_resets(const char* name, const std::vector<Game> &games) {
+  const char* planners[2] = {"scan", "planned"};
+  double moves[2] = {0, 0}, total_mm[2] = {0, 0}, carry_mm[2] = {0, 0}, seconds[2] = {0, 0};
+  double routed_seconds = 0;
+  for (const Game &game : games) {
+    for (uint8_t p = 0; p < 2; p++) {
+      Game copy = game;
+      std::vector<std::pair<int8_t, int8_t>> reset =
+        p == 0 ? scan_reset(copy) : plan_reset(copy.board, copy.graveyard, copy.temp_pieces);
+      float carry;
+      total_mm[p] += reset_moves_mm(reset, carry);
+      carry_mm[p] += carry;
+      moves[p] += reset.size();
+      seconds[p] += reset_ms(reset_segments(reset, nullptr)) / 1000;
+      if (p == 1) {
+        Occupancy occupancy = occupancy_of(game.board, game.graveyard);
+        routed_seconds += reset_ms(reset_segments(reset, &occupancy)) / 1000;
+      }
+    }
+  }
+  printf("%s: %lu resets\n", name, (unsigned long)games.size());
+  for (uint8_t p = 0; p < 2; p++) {
+    printf("%-8s %6.1f moves   %7.0f mm (empty %6.0f, carrying %6.0f)   %6.1f s   per reset\n", planners[p],
+           moves[p] / games.size(), total_mm[p] / games.size(), (total_mm[p] - carry_mm[p]) / games.size(),
+           carry_mm[p] / games.size(), seconds[p] / games.size());
+  }
+  printf("%-8s %6.1f moves   planned, carried around the pieces                  %6.1f s   per reset\n", "routed",
+         moves[1] / games.size(), routed_seconds / games.size());
+}
+
+// Carried pieces of the games and their resets, along the old lines (straight, or the taxicab detour) and routed
+struct RouteCheck {
+  uint32_t moves = 0;
+  uint32_t straight = 0;   // routed as a straight line
+  uint32_t around = 0;     // through waypoints
+  uint32_t no_route = 0;   // no route with few enough waypoints, carried along the old line
+  uint32_t misplaced = 0;  // nothing to pick up, or the destination taken
+  double length_mm[2] = {0, 0};
+  // Old lines, and the routes found (the carries with no route are counted on their own)
+  double closest_mm[2] = {INFINITY, INFINITY};
+  uint32_t collisions[2] = {0, 0};
+  double no_route_closest_mm = INFINITY;
+  uint32_t no_route_collisions = 0;
+};
+
+// Length of the path a piece is carried along, closest_mm gets how near it comes to the center of any other piece
+// (checked every mm of the way, as the subordinate moves: whole mm, x then y for the taxicab leg)
+static double check_path(const Occupancy &others, const Gantry &gantry, const MotorSegment &segment,
+                         double &closest_mm) {
+  std::vector<Leg> legs;
+  carry_legs(gantry, segment, legs);
+  std::vector<std::pair<double, double>> points = {{(double)square_x_mm(segment.x0), segment.y0 * MM_PER_SQUARE}};
+  for (const Leg &leg : legs) {
+    if (leg.taxicab) {
+      points.push_back({(double)leg.x, points.back().second});
+    }
+    points.push_back({(double)leg.x, (double)leg.y});
+  }
+  double length_mm = 0;
+  closest_mm = INFINITY;
+  for (size_t i = 1; i < points.size(); i++) {
+    double dx = points[i].first - points[i - 1].first;
+    double dy = points[i].second - points[i - 1].second;
+    double line_mm = hypot(dx, dy);
+    length_mm += line_mm;
+    uint32_t samples = ceil(line_mm);
+    for (uint32_t k = 0; k <= samples; k++) {
+      double t = samples ? (double)k / samples : 0;
+      double x = points[i - 1].first + t * dx;
+      double y = points[i - 1].second + t * dy;
+      for (int8_t square_y = 0; square_y < 8; square_y++) {
+        for (int8_t square_x = -3; square_x <= 10; square_x++) {
+          if (others.at(square_x, square_y)) {
+            double distance = hypot(x - square_x_mm(square_x), y - square_y * MM_PER_SQUARE);
+            closest_mm = distance < closest_mm ? distance : closest_mm;
+          }
+        }
+      }
+    }
+  }
+  return length_mm;
+}
+
+// Checks one carried piece: old is the segment as the scheduler gave it, routed its waypoints then the move to send
+// A path counts as a collision if it comes closer than the clearance, less 2 mm for the whole mm the subordinate uses
+static void check_carry(RouteCheck &check, Occupancy &occupancy, const MotorSegment &old,
+                        const std::vector<MotorSegment> &routed) {
+  check.moves++;
+  if (!occupancy.at(old.x0, old.y0) || occupancy.at(old.x1, old.y1)) {
+    check.misplaced++;
+  }
+  Occupancy others = occupancy;
+  others.set(old.x0, old.y0, false);
+  Gantry old_gantry, routed_gantry;
+  for (size_t i = 0; i + 1 < routed.size(); i++) {
+    add_waypoint(routed_gantry, routed[i]);
+  }
+  const MotorSegment &move = routed.back();
+  int8_t waypoints[2 * ROUTE_MAX_WAYPOINTS];
+  bool no_route = route_piece(occupancy, old.x0, old.y0, old.x1, old.y1, waypoints) < 0;
+  if (no_route) {
+    check.no_route++;
+  } else if (routed.size() > 1) {
+    check.around++;
+  } else {
+    check.straight++;
+  }
+  for (uint8_t r = 0; r < 2; r++) {
+    double closest_mm;
+    check.length_mm[r] += r == 0 ? check_path(others, old_gantry, old, closest_mm)
+                                 : check_path(others, routed_gantry, move, closest_mm);
+    bool collision = closest_mm < ROUTE_CLEARANCE_MM - 2;
+    if (r == 1 && no_route) {
+      check.no_route_closest_mm = closest_mm < check.no_route_closest_mm ? closest_mm : check.no_route_closest_mm;
+      check.no_route_collisions += collision;
+      continue;
+    }
+    check.closest_mm[r] = closest_mm < check.closest_mm[r] ? closest_mm : check.closest_mm[r];
+    check.collisions[r] += collision;
+  }
+  occupancy.set(old.x0, old.y0, false);
+  occupancy.set(old.x1, old.y1, true);
+}
+
+// Every carried piece of the games (their scheduled and routed sequences) and of the planned resets after them
+// Returns false if a piece was misplaced, a route came too close to another piece, or (unless allow_no_route) a
+// carry with no route did
+static bool print_routes(const char* name, const Sequences &sequences, const std::vector<Game> &games,
+                         bool allow_no_route) {
+  RouteCheck check;
+  const int8_t start_graveyard[12] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8};
+  for (size_t g = 0; g < games.size(); g++) {
+    Occupancy occupancy = occupancy_of(Board(), start_graveyard);
+    size_t end = g + 1 < games.size() ? games[g + 1].first_queue : sequences.scheduled.size();
+    for (size_t q = games[g].first_queue; q < end; q++) {
+      const std::vector<MotorSegment> &routed = sequences.routed[q];
+      size_t r = 0;
+      for (const MotorSegment &segment : sequences.scheduled[q]) {
+        std::vector<MotorSegment> records;
+        do {
+          records.push_back(routed[r]);
+        } while (routed[r++].mode == MOTOR_MODE_WAYPOINT);
+        if (segment.mode != MOTOR_MODE_CALIBRATE) {
+          check_carry(check, occupancy, segment, records);
+        }
+      }
+    }
+
+    Game copy = games[g];
+    Occupancy reset_occupancy = occupancy_of(copy.board, copy.graveyard);
+    Occupancy router = reset_occupancy;
+    for (const std::pair<int8_t, int8_t> &move : plan_reset(copy.board, copy.graveyard, copy.temp_pieces)) {
+      MotorSegment segment = {(int8_t)(move.first % 14 - 3), (int8_t)(move.first / 14), (int8_t)(move.second % 14 - 3),
+                              (int8_t)(move.second / 14), MOTOR_MODE_TAXICAB};
+      MotorSegment records[ROUTE_MAX_WAYPOINTS + 1];
+      uint8_t count = route_segment(router, segment, records);
+      check_carry(check, reset_occupancy, segment, std::vector<MotorSegment>(records, records + count));
+    }
+  }
+  printf("%s: %lu games and their resets, %lu carried pieces (%lu misplaced)\n", name, (unsigned long)games.size(),
+         (unsigned long)check.moves, (unsigned long)check.misplaced);
+  printf("routed   %lu straight, %lu through waypoints, %lu with no route (carried along the old line)\n",
+         (unsigned long)check.straight, (unsigned long)check.around, (unsigned long)check.no_route);
+  const char* paths[2] = {"old", "routed"};
+  for (uint8_t r = 0; r < 2; r++) {
+    printf("%-8s %6.1f mm per piece   closest %5.1f mm to another piece   %lu closer than %.1f mm%s\n", paths[r],
+           check.length_mm[r] / check.moves, check.closest_mm[r], (unsigned long)check.collisions[r],
+           ROUTE_CLEARANCE_MM - 2, r == 1 ? " (routes found)" : "");
+  }
+  if (check.no_route) {
+    printf("no route                   closest %5.1f mm to another piece   %lu closer than %.1f mm\n",
+           check.no_route_closest_mm, (unsigned long)check.no_route_collisions, ROUTE_CLEARANCE_MM - 2);
+  }
+  bool passed = true;
+  if (check.misplaced) {
+    fprintf(stderr, "%lu carried pieces misplaced\n", (unsigned long)check.misplaced);
+    passed = false;
+  }
+  if (check.collisions[1]) {
+    fprintf(stderr, "%lu routes too close to another piece\n", (unsigned long)check.collisions[1]);
+    passed = false;
+  }
+  if (check.no_route_collisions && !allow_no_route) {
+    fprintf(stderr, "%lu carries with no route too close to another piece (--allow-no-route to accept them)\n",
+            (unsigned long)check.no_route_collisions);
+    passed = false;
+  }
+  return passed;
+}
+
+int main(int argc, char** argv) {
+  const MotorSegment calibrate = {0, 0, 0, 0, MOTOR_MODE_CALIBRATE};
+  if (argc > 1 && (strcmp(argv[1], "--reset") == 0 || strcmp(argv[1], "--pgn") == 0 ||
+                   strcmp(argv[1], "--route") == 0)) {
+    Sequences sequences;
+    std::vector<Game> games;
+    uint32_t moves = 0;
+    const char* file = nullptr;
+    bool allow_no_route = false;
+    for (int i = 2; i < argc; i++) {
+      if (strcmp(argv[i], "--allow-no-route") == 0) {
+        allow_no_route = true;
+      } else {
+        file = argv[i];
+      }
+    }
+    const char* name = file ? file : "random games";
+    if (file) {
+      if (!pgn_games(file, sequences, games, moves)) {
+        return 2;
+      }
+    } else {
+      random_games(200, 160, sequences, games, moves);
+    }
+    if (strcmp(argv[1], "--reset") == 0) {
+      print_resets(name, games);
+      return 0;
+    }
+    if (strcmp(argv[1], "--route") == 0) {
+      return print_routes(name, sequences, games, allow_no_route) ? 0 : 1;
+    }
+    printf("%s: %lu games, %lu moves\n", name, (unsigned long)games.size(), (unsigned long)moves);
+    Timing fixed_timing = print_timing("fixed", sequences.fixed);
+    const char* names[2] = {"scheduled", "routed"};
+    Timing timings[2] = {print_timing(names[0], sequences.scheduled), print_timing(names[1], sequences.routed)};
+    for (uint8_t t = 0; t < 2; t++) {
+      printf("%-10s saved per game", names[t]);
+      for (uint8_t i = 0; i < STEPPINGS; i++) {
+        printf("   %s %.2f s", steppings[i].name,
+               (fixed_timing.queued_ms[i] - timings[t].queued_ms[i]) / 1000 / games.size());
+      }
+      printf("\n");
+    }
+    return 0;
+  }
+  if (argc > 1) {
+    FILE* input = fopen(argv[1], "r");
+    if (!input) {
+      fprintf(stderr, "can't open %s\n", argv[1]);
+      return 2;
+    }
+    Sequence sequence(1);
+    char line[128];
+    while (fgets(line, sizeof(line), input)) {
+      int x0, y0, x1, y1, mode;
+      if (strncmp(line, "run", 3) == 0) {
+        sequence.emplace_back();
+      } else if (sscanf(line, "%d %d %d %d %d", &x0, &y0, &x1, &y1, &mode) == 5) {
+        sequence.back().push_back({(int8_t)x0, (int8_t)y0, (int8_t)x1, (int8_t)y1, (uint8_t)mode});
+      }
+    }
+    fclose(input);
+    print_timing(argv[1], sequence);
+    return 0;
+  }
+
+  print_lines();
+
+  // Each turn ends with a calibration, run on its own (GAME_END_TURN)
+  print_timing("quiet", {{{4, 1, 4, 3, MOTOR_MODE_DIRECT}}, {calibrate}});
+  print_timing("capture", {{{3, 4, -2, 0, MOTOR_MODE_TAXICAB}, {4, 3, 3, 4, MOTOR_MODE_DIRECT}}, {calibrate}});
+  print_timing("castling", {{{4, 0, 6, 0, MOTOR_MODE_DIRECT}, {7, 0, 5, 0, MOTOR_MODE_TAXICAB}}, {calibrate}});
+  print_timing("promotion", {{{1, 6, 0, 7, MOTOR_MODE_DIRECT}},
+                             {{0, 7, -3, 4, MOTOR_MODE_TAXICAB}, {-1, 0, 0, 7, MOTOR_MODE_TAXICAB}}, {calibrate}});
+
+  // Reset after a game: 14 captured pieces back from the graveyards, 12 pieces back from elsewhere on the board,
+  // calibrating every 5 moves like GAME_RESET
+  std::vector<MotorSegment> reset;
+  for (int8_t i = 0; i < 26; i++) {
+    if (i % 5 == 0) {
+      reset.push_back(calibrate);
+    }
+    if (i < 14) {
+      bool black = i % 2;
+      reset.push_back({(int8_t)(black ? 8 + i / 2 % 3 : -1 - i / 2 % 3), (int8_t)(i / 2), (int8_t)(i / 2),
+                       (int8_t)(black ? 6 : 1), MOTOR_MODE_TAXICAB});
+    } else {
+      int8_t j = i - 14;
+      reset.push_back({(int8_t)(j % 8), (int8_t)(2 + j % 4), (int8_t)(j % 8), (int8_t)(j % 2 ? 7 : 0), MOTOR_MODE_TAXICAB});
+    }
+  }
+  reset.push_back(calibrate);
+  print_timing("reset", {reset});
+  return 0;
+}
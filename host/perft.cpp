@@ -0,0 +1,117 @@
+// perft.cpp
+// Counts every leaf node of the legal move tree to a fixed depth, and checks the counts against the known values
+// for the standard perft positions (https://www.chessprogramming.org/Perft_Results).
+// A wrong count means a bug in move generation, make_move or unmake_move (castling, en passant and promotion
+// each have a position that stresses them). The nodes/sec number is the throughput to compare engine changes against.
+//
+// Usage: perft [depth] [position name]
+//   depth defaults to 4, and is capped to the deepest known count of each position
+//   without a position name every position is run
+
+#include "Board.h"
+#include "Piece.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#define MAX_PERFT_DEPTH 6
+
+struct PerftPosition {
+  const char* name;
+  const char* fen;
+  // Known node counts for depth 1, 2, ... (0 past the last known depth)
+  uint64_t nodes[MAX_PERFT_DEPTH];
+};
+
+static const PerftPosition POSITIONS[] = {
+  {"start", "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    {20, 400, 8902, 197281, 4865609, 119060324}},
+  {"kiwipete", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    {48, 2039, 97862, 4085603, 193690690, 0}},
+  {"en_passant", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    {14, 191, 2812, 43238, 674624, 11030083}},
+  {"promotion", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    {6, 264, 9467, 422333, 15833292, 706045033}},
+  {"promotion_check", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+    {44, 1486, 62379, 2103487, 89941194, 0}},
+};
+
+static const PieceType PROMOTION_TYPES[4] = {QUEEN, ROOK, BISHOP, KNIGHT};
+
+static uint64_t perft(Board &board, bool color, int8_t depth) {
+  if (depth == 0) {
+    return 1;
+  }
+  LegalMoveList moves;
+  uint64_t checkers;
+  board.generate_legal_moves(color, moves, checkers);
+  uint64_t nodes = 0;
+  for (uint16_t i = 0; i < moves.list.size(); i++) {
+    Move move = moves.list[i];
+    // A pawn reaching the last row is four different moves, one for each promotion
+    if (move_flags(move) & MOVE_PROMOTION) {
+      for (int8_t p = 0; p < 4; p++) {
+        board.make_move(move, PROMOTION_TYPES[p]);
+        nodes += perft(board, !color, depth - 1);
+        board.unmake_move();
+      }
+    } else {
+      board.make_move(move);
+      nodes += perft(board, !color, depth - 1);
+      board.unmake_move();
+    }
+  }
+  return nodes;
+}
+
+int main(int argc, char** argv) {
+  int depth = argc > 1 ? atoi(argv[1]) : 4;
+  const char* only = argc > 2 ? argv[2] : NULL;
+  if (depth < 1 || depth > MAX_PERFT_DEPTH) {
+    fprintf(stderr, "usage: %s [depth 1-%d] [position]\n", argv[0], MAX_PERFT_DEPTH);
+    return 2;
+  }
+
+  Board board;
+  int failures = 0;
+  int ran = 0;
+  uint64_t total_nodes = 0;
+  double total_seconds = 0;
+  for (size_t i = 0; i < sizeof(POSITIONS) / sizeof(POSITIONS[0]); i++) {
+    const PerftPosition &position = POSITIONS[i];
+    if (only && strcmp(only, position.name) != 0) {
+      continue;
+    }
+    ran++;
+    // Don't go past the deepest known count
+    int8_t position_depth = depth;
+    while (position.nodes[position_depth - 1] == 0) {
+      position_depth--;
+    }
+    board.from_fen(position.fen);
+    bool color = board.side_to_move;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    uint64_t nodes = perft(board, color, position_depth);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    bool ok = nodes == position.nodes[position_depth - 1];
+    failures += !ok;
+    total_nodes += nodes;
+    total_seconds += seconds;
+    printf("%-16s depth %d  nodes %12llu  %8.3f s  %10.0f nodes/s  %s",
+           position.name, position_depth, (unsigned long long)nodes, seconds, nodes / seconds, ok ? "ok" : "FAIL");
+    if (!ok) {
+      printf(" (expected %llu)", (unsigned long long)position.nodes[position_depth - 1]);
+    }
+    printf("\n");
+  }
+  if (ran == 0) {
+    fprintf(stderr, "unknown position: %s\n", only);
+    return 2;
+  }
+  printf("total            nodes %12llu  %8.3f s  %10.0f nodes/s\n", (unsigned long long)total_nodes, total_seconds, total_nodes / total_seconds);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,355 @@
+// pi_link_bench.cpp
+// Loopback benchmark of the framed board <-> Pi link (chess_game/PiLink.h), with no hardware.
+// Two PiLink endpoints run in two threads, joined by an in-memory pipe in each direction that delivers bytes at a
+// simulated UART speed and corrupts a bit of some writes (so CRC errors and retries get exercised):
+//   board side: plays random legal moves, sends each one batched with the position (move + FEN) and waits for the reply
+//   Pi side:    stand-in for the Pi, takes its configuration, resyncs to every FEN and answers with its first legal move
+//               (promoting to each piece in turn), and checks that every promotion shows up as that piece in the FEN
+// Also checks that a first frame resent after its acks were lost is only delivered once.
+// Prints the round trip latency (move sent to engine reply received), transfer counters, and what the bit-banged
+// valid/ready link would have taken for the same moves (two 16 bit words, 20 ms per bit).
+//
+// Usage: pi_link_bench [moves, default 500] [baud, default 921600] [corrupted writes, default 0.01]
+
+#include "PiLink.h"
+#include "Board.h"
+#include "Piece.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <thread>
+
+typedef std::chrono::steady_clock Clock;
+
+// Time the old link took per 16 bit word: one clock period (2 * 10 ms) per bit, plus the start cycle
+#define BIT_BANG_MS_PER_WORD (17 * 20)
+
+// One direction of the loopback: bytes written now become readable once the simulated UART has shifted them out
+class Pipe {
+  public:
+    Pipe(uint32_t baud, double error_rate, uint32_t seed) : byte_time(std::chrono::nanoseconds(10000000000LL / baud)),
+                                                            error_rate(error_rate), random(seed), free_at(Clock::now()) {}
+
+    void write(const uint8_t* data, uint16_t length) {
+      std::lock_guard<std::mutex> lock(mutex);
+      Clock::time_point now = Clock::now();
+      if (free_at < now) {
+        free_at = now;
+      }
+      int16_t corrupted = std::uniform_real_distribution<double>(0, 1)(random) < error_rate ?
+                          std::uniform_int_distribution<int>(0, length - 1)(random) : -1;
+      for (uint16_t i = 0; i < length; i++) {
+        free_at += byte_time;
+        uint8_t byte = data[i];
+        if (i == corrupted) {
+          byte ^= 1 << std::uniform_int_distribution<int>(0, 7)(random);
+        }
+        bytes.push_back(std::make_pair(byte, free_at));
+      }
+    }
+
+    int available() {
+      std::lock_guard<std::mutex> lock(mutex);
+      Clock::time_point now = Clock::now();
+      int count = 0;
+      for (size_t i = 0; i < bytes.size() && bytes[i].second <= now; i++) {
+        count++;
+      }
+      return count;
+    }
+
+    int read() {
+      std::lock_guard<std::mutex> lock(mutex);
+      uint8_t byte = bytes.front().first;
+      bytes.pop_front();
+      return byte;
+    }
+
+  private:
+    std::chrono::nanoseconds byte_time;
+    double error_rate;
+    std::mt19937 random;
+    Clock::time_point free_at;
+    std::deque<std::pair<uint8_t, Clock::time_point>> bytes;
+    std::mutex mutex;
+};
+
+// An endpoint's view of the two pipes
+class PipeChannel : public PiChannel {
+  public:
+    PipeChannel(Pipe &in, Pipe &out) : in(in), out(out) {}
+    int available() override {
+      int count = in.available();
+      // Nothing arrived: let the other side run (the endpoints poll, and the host may have a single core)
+      if (count == 0) {
+        std::this_thread::yield();
+      }
+      return count;
+    }
+    int read() override {
+      return in.read();
+    }
+    void write(const uint8_t* data, uint16_t length) override {
+      out.write(data, length);
+    }
+
+  private:
+    Pipe &in;
+    Pipe &out;
+};
+
+static std::atomic<bool> running(true);
+static std::atomic<uint32_t> promotions(0);
+static std::atomic<uint32_t> wrong_promotions(0);
+
+// The Pi's own reading of the promotion codes (PiLink.h: 1 queen, 2 rook, 3 bishop, 4 knight, as UCI letters), so a
+// board side that maps its promotion selection to the wrong code shows up as a wrong piece in the next FEN
+static const char PI_PROMOTION_LETTERS[] = " qrbn";
+
+static PieceType letter_type(char letter) {
+  switch (letter) {
+    case 'q':
+      return QUEEN;
+    case 'r':
+      return ROOK;
+    case 'b':
+      return BISHOP;
+    case 'n':
+      return KNIGHT;
+  }
+  return EMPTY;
+}
+
+// Whether the piece on square is a piece of the promotion letter
+static void check_promotion(const Board &board, uint8_t square, char letter) {
+  promotions++;
+  if (board.piece_at(square % 8, square / 8).get_type() != letter_type(letter)) {
+    fprintf(stderr, "promotion to '%c' on square %d played as another piece\n", letter, square);
+    wrong_promotions++;
+  }
+}
+
+// Stand-in for the Pi: plays the sides configured as computers, always with its first legal move
+static void pi_side(PiChannel* channel) {
+  PiLink link;
+  link.begin(channel);
+  Board board;
+  LegalMoveList moves;
+  bool is_human[2] = {true, true};
+  link.add_message(PI_MSG_HELLO, nullptr, 0);
+  link.send_batch();
+
+  // Promotions to check in the next FEN: the board's last move, this side's last reply
+  int16_t move_square = -1;
+  char move_letter = ' ';
+  int16_t move_to_square = -1;
+  int16_t reply_square = -1;
+  char reply_letter = ' ';
+  uint8_t reply_count = 0;
+
+  PiMessage message;
+  while (running) {
+    if (!link.poll(message)) {
+      continue;
+    }
+    if (message.type == PI_MSG_CONFIG) {
+      is_human[message.body[0] & 1] = message.body[1];
+      // A new game
+      move_square = -1;
+      reply_square = -1;
+    } else if (message.type == PI_MSG_MOVE) {
+      move_to_square = message.body[1];
+      move_square = message.body[2] ? message.body[1] : -1;
+      move_letter = message.body[2] <= 4 ? PI_PROMOTION_LETTERS[message.body[2]] : '?';
+    } else if (message.type == PI_MSG_FEN) {
+      char fen[PI_LINK_MAX_MESSAGE];
+      memcpy(fen, message.body + 1, message.length - 1);
+      fen[message.length - 1] = '\0';
+      if (!board.from_fen(fen)) {
+        fprintf(stderr, "pi: bad FEN \"%s\"\n", fen);
+        continue;
+      }
+      if (move_square >= 0) {
+        check_promotion(board, move_square, move_letter);
+      }
+      // Unless the board's move took it
+      if (reply_square >= 0 && reply_square != move_to_square) {
+        check_promotion(board, reply_square, reply_letter);
+      }
+      move_square = -1;
+      move_to_square = -1;
+      reply_square = -1;
+      uint64_t checkers;
+      board.generate_legal_moves(board.side_to_move, moves, checkers);
+      if (is_human[board.side_to_move] || moves.list.size() == 0) {
+        continue;
+      }
+      Move move = moves.list[0];
+      // Promotes to each piece in turn
+      uint8_t promotion = (move_flags(move) & MOVE_PROMOTION) ? reply_count++ % 4 + 1 : 0;
+      if (promotion) {
+        reply_square = move_to(move);
+        reply_letter = PI_PROMOTION_LETTERS[promotion];
+      }
+      uint8_t reply[4] = {(uint8_t)move_from(move), (uint8_t)move_to(move), promotion, message.body[0]};
+      link.add_message(PI_MSG_ENGINE_REPLY, reply, sizeof(reply));
+      if (!link.send_batch()) {
+        fprintf(stderr, "pi: reply not acked\n");
+      }
+    }
+  }
+}
+
+// A first frame whose acks are all lost comes in up to PI_LINK_MAX_RETRIES + 1 times and has to be delivered once, while
+// the first frame of a sender that was restarted is new. Returns the number of deliveries that went wrong
+static uint32_t check_first_frames() {
+  Pipe to_receiver(921600, 0, 4);
+  Pipe acks(921600, 0, 5);
+  Pipe silent(921600, 0, 6);
+  PipeChannel sender_channel(silent, to_receiver);
+  PipeChannel receiver_channel(to_receiver, acks);
+  PiLink sender;
+  PiLink receiver;
+  sender.begin(&sender_channel);
+  receiver.begin(&receiver_channel);
+
+  uint32_t wrong = 0;
+  PiMessage message;
+  for (uint8_t frame = 0; frame < 3; frame++) {
+    // The third frame comes from the sender restarted
+    if (frame == 2) {
+      sender.begin(&sender_channel);
+    }
+    uint8_t body = frame;
+    sender.add_message(PI_MSG_HELLO, &body, 1);
+    sender.send_batch();
+    uint8_t delivered = 0;
+    while (receiver.poll(message)) {
+      delivered++;
+    }
+    if (delivered != 1) {
+      fprintf(stderr, "first frame %d delivered %d times\n", frame, delivered);
+      wrong++;
+    }
+  }
+  return wrong;
+}
+
+int main(int argc, char** argv) {
+  uint32_t move_count = argc > 1 ? atoi(argv[1]) : 500;
+  uint32_t baud = argc > 2 ? atoi(argv[2]) : 921600;
+  double error_rate = argc > 3 ? atof(argv[3]) : 0.01;
+
+  uint32_t wrong_first_frames = check_first_frames();
+
+  Pipe to_pi(baud, error_rate, 1);
+  Pipe to_board(baud, error_rate, 2);
+  PipeChannel board_channel(to_board, to_pi);
+  PipeChannel pi_channel(to_pi, to_board);
+  std::thread pi_thread(pi_side, &pi_channel);
+
+  PiLink link;
+  link.begin(&board_channel);
+  PiMessage message;
+  if (!link.wait_for(PI_MSG_HELLO, message, 1000)) {
+    fprintf(stderr, "no hello from the pi side\n");
+    running = false;
+    pi_thread.join();
+    return 1;
+  }
+
+  Board board;
+  LegalMoveList moves;
+  char fen[FEN_MAX_LENGTH];
+  std::mt19937 random(3);
+  uint32_t round_trips = 0;
+  uint32_t failures = 0;
+  uint32_t games = 0;
+  double total_ms = 0;
+  double worst_ms = 0;
+  bool new_game = true;
+  uint8_t position_id = 0;
+
+  while (round_trips + failures < move_count) {
+    if (new_game) {
+      // White is played here, black by the Pi: both configurations go in one frame
+      board.reset();
+      link.add_config(0, true, 0);
+      link.add_config(1, false, 10);
+      if (!link.send_batch()) {
+        fprintf(stderr, "configuration not acked\n");
+      }
+      new_game = false;
+      games++;
+    }
+    uint64_t checkers;
+    board.generate_legal_moves(board.side_to_move, moves, checkers);
+    if (moves.list.size() == 0 || board.draw_move_counter >= 50) {
+      new_game = true;
+      continue;
+    }
+    Move move = moves.list[std::uniform_int_distribution<size_t>(0, moves.list.size() - 1)(random)];
+    // A promotion to any piece, picked like promotion_joystick_selection and sent the way chess_game.ino does
+    int8_t selection = std::uniform_int_distribution<int>(0, 3)(random);
+    bool promotion = move_flags(move) & MOVE_PROMOTION;
+    board.play_move(move, promotion ? promotion_selection_type(selection) : EMPTY);
+    board.to_fen(fen);
+
+    Clock::time_point start = Clock::now();
+    link.add_move(move_from(move), move_to(move), promotion ? pi_promotion_code(promotion_selection_type(selection)) : 0);
+    link.add_fen(++position_id, fen);
+    bool sent = link.send_batch();
+    board.generate_legal_moves(board.side_to_move, moves, checkers);
+    if (moves.list.size() == 0) {
+      new_game = true;
+      continue;
+    }
+    if (!sent || !link.wait_for_engine_reply(position_id, message, 500)) {
+      failures++;
+      new_game = true;
+      continue;
+    }
+    double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    total_ms += ms;
+    worst_ms = ms > worst_ms ? ms : worst_ms;
+    round_trips++;
+
+    // Play the reply (it has to be legal here)
+    Move reply = 0;
+    for (uint16_t i = 0; i < moves.list.size(); i++) {
+      if (move_from(moves.list[i]) == message.body[0] && move_to(moves.list[i]) == message.body[1]) {
+        reply = moves.list[i];
+        break;
+      }
+    }
+    if (!reply) {
+      fprintf(stderr, "engine reply is not a legal move\n");
+      failures++;
+      new_game = true;
+      continue;
+    }
+    // Decoded like the engine replies in chess_game.ino
+    int8_t reply_selection = promotion_selection_of(pi_promotion_type(message.body[2]));
+    board.play_move(reply, (move_flags(reply) & MOVE_PROMOTION) ? promotion_selection_type(reply_selection) : EMPTY);
+  }
+  running = false;
+  pi_thread.join();
+
+  printf("%lu round trips in %lu games, %lu failed, %lu baud, %.1f%% writes corrupted\n", (unsigned long)round_trips,
+         (unsigned long)games, (unsigned long)failures, (unsigned long)baud, error_rate * 100);
+  printf("latency: %.2f ms average, %.2f ms worst (move + FEN sent, acked, reply received and acked)\n",
+         round_trips ? total_ms / round_trips : 0.0, worst_ms);
+  printf("board side: %lu frames sent, %lu retransmissions, %lu bad frames received\n", (unsigned long)link.frames_sent,
+         (unsigned long)link.retransmissions, (unsigned long)link.bad_frames);
+  printf("promotions: %lu checked, %lu played as another piece\n", (unsigned long)promotions,
+         (unsigned long)wrong_promotions);
+  printf("first frames resent without acks: %s\n", wrong_first_frames ? "delivered more than once" : "delivered once");
+  printf("bit-banged valid/ready link: about %d ms per round trip (move only, no position)\n", 2 * BIT_BANG_MS_PER_WORD);
+  return failures || wrong_promotions || wrong_first_frames ? 1 : 0;
+}
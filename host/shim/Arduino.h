@@ -0,0 +1,31 @@
+// Arduino.h shim for host builds
+// Only provides what the chess_game engine files (Board, Piece, Bitboard, Zobrist, Search, OpeningBook, Bitbase, PiLink, MotorQueue) use,
+// so they can be compiled unmodified on a PC. Never on the include path of the sketches.
+
+#ifndef HOST_ARDUINO_SHIM_H
+#define HOST_ARDUINO_SHIM_H
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+
+using std::min;
+using std::max;
+
+// Constant data is in flash on the ESP32 (read in place), plain memory on a PC
+#define PROGMEM
+
+// Milliseconds / microseconds since the program started, like on the board
+inline unsigned long millis() {
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline unsigned long micros() {
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+#endif
@@ -1,231 +1,217 @@
-import RPi.GPIO as GPIO
+import serial
 import time
 from stockfish import Stockfish
 
-# Pin Definitions (Global Constants)
-CLK_PIN = 2
-RVALID_PIN = 17
-RREADY_PIN = 27
-RDATA_PIN = 9
-WVALID_PIN = 22
-WREADY_PIN = 10
-WDATA_PIN = 11
-OVERWRITE_PIN = 0
+# Pi side of the board's framed link (chess_game/PiLink.h), on the Pi's UART wired to the ESP32's UART2
+#
+# Frame: sync (0xA5), kind, sequence number, payload length, payload, CRC-16 (CCITT, of kind up to the payload, low
+# byte first). A data frame's payload is a batch of messages, each one type, length and body. Every data frame is
+# acked with an ack frame carrying its sequence number; a frame without an ack is sent again up to PI_LINK_MAX_RETRIES
+# times, and a frame received twice (its ack was lost) is acked again but only handled once.
+
+PI_LINK_PORT = "/dev/serial0"
+PI_LINK_BAUD = 921600
+PI_LINK_SYNC = 0xA5
+PI_LINK_MAX_PAYLOAD = 240
+PI_LINK_ACK_TIMEOUT_S = 0.05
+PI_LINK_MAX_RETRIES = 5
+PI_LINK_BYTE_TIMEOUT_S = 0.01  # a frame whose bytes stop coming for this long is dropped
+HELLO_INTERVAL_S = 1.0         # the board may not be listening yet, say hello again until it acks
+
+# Frame kinds
+PI_FRAME_DATA = 1
+PI_FRAME_ACK = 2
+PI_FRAME_FIRST = 0x80  # flag on the first data frame of a session: the receiver takes its sequence number as new
+
+# Message types
+PI_MSG_HELLO = 1         # (no body) once stockfish is running
+PI_MSG_CONFIG = 2        # color, is_human, difficulty
+PI_MSG_MOVE = 3          # from, to, promotion: a move that was played
+PI_MSG_FEN = 4           # position id, FEN string: the position now
+PI_MSG_ENGINE_REPLY = 5  # from, to, promotion, position id: stockfish's move in the position of that id
+
+# Promotion piece of a move on the link (0 none), the same codes both ways
+PROMOTION_CODES = {'q': 1, 'r': 2, 'b': 3, 'n': 4}
+PROMOTION_LETTERS = {code: letter for letter, code in PROMOTION_CODES.items()}
 
 # Global Game State
 stockfish = [None, None]
 is_computer = [False, False]
 difficulty = [0, 0]
-turn = 0
-first_write = 1
 
-def move_to_bits(move_str):
-    if len(move_str) != 4 and len(move_str) != 5:
-        raise ValueError("Move string must be 4 characters (e.g., 'e1e3') or 5 characters (e.g., 'e1e3q')")
-    #convert string to lowercase
+def crc16(data):
+    # CRC-16/CCITT-FALSE, like pi_link_crc16
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+def square_name(square):
+    # Squares are y * 8 + x, x the file and y the rank
+    return chr(ord('a') + square % 8) + str(square // 8 + 1)
+
+def square_index(name):
+    return (int(name[1]) - 1) * 8 + ord(name[0]) - ord('a')
+
+def move_to_message(move_str, position_id):
     move_str = move_str.lower()
+    promotion = PROMOTION_CODES[move_str[4]] if len(move_str) == 5 else 0
+    return bytes([square_index(move_str[0:2]), square_index(move_str[2:4]), promotion, position_id])
 
-    start_x = ord(move_str[0]) - ord('a')
-    start_y = int(move_str[1]) - 1
-    end_x = ord(move_str[2]) - ord('a')
-    end_y = int(move_str[3]) - 1
-    if len(move_str) == 5:
-        promotion = move_str[4].lower()
-        if promotion == 'q':
-            promotion = 0
-        elif promotion == 'r':
-            promotion = 3
-        elif promotion == 'b':
-            promotion = 2
-        elif promotion == 'n':
-            promotion = 1
-        else:
-            raise ValueError("Invalid promotion piece. Use 'q', 'r', 'b', or 'n'.")
-    else:
-        promotion = 0
-    
-    # Convert to bits: in format of start_y, start_x, end_y, end_x, promotion (start_y has most significant bit)
-    binary_representation = (
-        (start_y & 0b111) << 11 |  # Start rank
-        (start_x & 0b111) << 8 |   # Start file
-        (end_y & 0b111) << 5 |     # End rank
-        (end_x & 0b111) << 2 |     # End file
-        (promotion & 0b111)        # Promotion
-    )
-    return binary_representation
+def message_to_move(body):
+    move_str = square_name(body[0]) + square_name(body[1])
+    if body[2] in PROMOTION_LETTERS:
+        move_str += PROMOTION_LETTERS[body[2]]
+    return move_str
 
-def bits_to_move(bits, is_promotion=False):
-    start_y = (bits >> 11) & 0b111
-    start_x = (bits >> 8) & 0b111
-    end_y = (bits >> 5) & 0b111
-    end_x = (bits >> 2) & 0b111
-    promotion = bits & 0b11
-    start_x = chr(start_x + ord('a'))
-    start_y = str(start_y + 1)
-    end_x = chr(end_x + ord('a'))
-    end_y = str(end_y + 1)
-    if is_promotion:
-        if promotion == 0:
-            promotion = 'q'
-        elif promotion == 3:        
-            promotion = 'r'
-        elif promotion == 2:
-            promotion = 'b'
-        elif promotion == 1:
-            promotion = 'n'
-        else:
-            raise ValueError("Invalid promotion piece. Use 'q', 'r', 'b', or 'n'.")
-        return start_x + start_y + end_x + end_y + promotion
-    else:
-        return start_x + start_y + end_x + end_y
+class PiLink:
+    def __init__(self, port):
+        self.port = port
+        self.rx_frame = bytearray()
+        self.rx_last_byte = 0
+        self.send_sequence = 0
+        self.first_frame_sent = False
+        self.receive_sequence = None  # last data frame handled
+        self.receive_first = False    # whether it was flagged first
+        self.ack_sequence = None
+        self.inbox = []
+        self.bad_frames = 0
 
-def read_from_arduino():
-  # Variables
-    last_clk = GPIO.input(CLK_PIN)  # Store the last clock state
-    receiving = False               # Flag to indicate if data is being received
-    databank = []                   # List to store received data
-    i = 0                           # Counter for received data bits
+    def write_frame(self, kind, sequence, payload=b""):
+        frame = bytes([kind, sequence, len(payload)]) + payload
+        crc = crc16(frame)
+        self.port.write(bytes([PI_LINK_SYNC]) + frame + bytes([crc & 0xFF, crc >> 8]))
 
-    # Set initial state of READY signal
-    GPIO.output(RREADY_PIN, GPIO.HIGH)  # Ready to receive data
-    valid = 0
-    while True:
-        # read the current data value, before clock edge.
-        current_data = GPIO.input(RDATA_PIN)
-        # Read current clock state
-        current_clk = GPIO.input(CLK_PIN)
-        # Read valid signal
-        temp_valid = GPIO.input(RVALID_PIN)
-        valid = temp_valid
+    def send(self, messages):
+        # Sends a batch of (type, body) messages as one frame and waits for its ack, retrying, returns False if it
+        # was never acked. Messages arriving in the meantime are kept in the inbox
+        payload = b"".join(bytes([message_type, len(body)]) + body for message_type, body in messages)
+        if len(payload) > PI_LINK_MAX_PAYLOAD:
+            raise ValueError("Batch doesn't fit in a frame")
+        kind = PI_FRAME_DATA | (0 if self.first_frame_sent else PI_FRAME_FIRST)
+        acked = False
+        for attempt in range(PI_LINK_MAX_RETRIES + 1):
+            self.ack_sequence = None
+            self.write_frame(kind, self.send_sequence, payload)
+            start = time.monotonic()
+            while time.monotonic() - start < PI_LINK_ACK_TIMEOUT_S:
+                self.receive()
+                if self.ack_sequence == self.send_sequence:
+                    acked = True
+                    break
+            if acked:
+                break
+        # The next frame gets a new number either way, so a lost batch isn't taken for a repeat of it
+        self.send_sequence = (self.send_sequence + 1) & 0xFF
+        if acked:
+            self.first_frame_sent = True
+        return acked
 
-        # Check for clock edge (rising edge: last_clk = 0, current_clk = 1)
-        if last_clk == GPIO.LOW and current_clk == GPIO.HIGH:
-            if valid == GPIO.HIGH:
-                # Start receiving data
-                #print("VALID IS HIGH")
-                receiving = True
-                GPIO.output(RREADY_PIN, GPIO.LOW)  # Not ready for new data
-            if receiving:
-                #print("Receiving Bit", i, current_data)
-                databank.append(current_data)  # Store data in databank
-                i += 1
-                #print(current_data)
+    def poll(self, timeout):
+        # Received messages (type, body), waiting up to timeout for the first one
+        start = time.monotonic()
+        while not self.inbox and time.monotonic() - start < timeout:
+            self.receive()
+        messages = self.inbox
+        self.inbox = []
+        return messages
 
-        # Check if 16 bits have been received
-        if i >= 16:
-            GPIO.output(RREADY_PIN, GPIO.LOW)
-            GPIO.output(WVALID_PIN, GPIO.LOW)
-            return databank
+    def receive(self):
+        # A frame cut short would wait for bytes that only come with the next frames
+        if self.rx_frame and time.monotonic() - self.rx_last_byte > PI_LINK_BYTE_TIMEOUT_S:
+            self.drop_frame()
+            self.check_frame()
+        data = self.port.read(max(1, self.port.in_waiting))
+        if not data:
+            return
+        self.rx_last_byte = time.monotonic()
+        for byte in data:
+            if not self.rx_frame and byte != PI_LINK_SYNC:
+                continue
+            self.rx_frame.append(byte)
+            self.check_frame()
 
-        # Update last clock state
-        last_clk = current_clk
+    def drop_frame(self):
+        self.bad_frames += 1
+        next_sync = self.rx_frame.find(PI_LINK_SYNC, 1)
+        self.rx_frame = self.rx_frame[next_sync:] if next_sync > 0 else bytearray()
 
-def write_to_arduino(data_bits):
-    global first_write
-    i = 0  # Bit index
-    last_clk_state = GPIO.input(CLK_PIN)  # Store the last clock state
-    
-    GPIO.output(WVALID_PIN, GPIO.HIGH)
-    # Send the first bit
-    GPIO.output(WDATA_PIN, data_bits[i])
-    if first_write:
-        first_write = 0
-        first_data_bit = False
-        in_writing = False
-        while GPIO.input(OVERWRITE_PIN) == GPIO.LOW:
-            #print("OVERWRITE LOW")
-            current_clk = GPIO.input(CLK_PIN)
-            if last_clk_state == GPIO.LOW and current_clk == GPIO.HIGH:
-                print("OVERWRITE LOW CLOCK FLASH", first_data_bit)
-                GPIO.output(WDATA_PIN, first_data_bit)
-                if GPIO.input(WREADY_PIN) == GPIO.HIGH:
-                    in_writing = True
-                if in_writing:
-                    first_data_bit = not first_data_bit
-            last_clk_state = current_clk
-    else:
-        in_writing = False
-        while True:
-            # Read the current clock state
-            current_clk = GPIO.input(CLK_PIN)
-            
-            # Check for rising edge (LOW -> HIGH transition)
-            if last_clk_state == GPIO.LOW and current_clk == GPIO.HIGH:
-                # Check if the Arduino is ready to receive the next bit
-                if GPIO.input(WREADY_PIN) == GPIO.HIGH:
-                    in_writing = True
-                if in_writing:
-                    i += 1  # Move to the next bit
-                    if i >= len(data_bits):  # Stop if all bits are sent
-                        break
-                    # Send the next bit
-                    GPIO.output(WDATA_PIN, data_bits[i])
-            
-            # Update the last clock state
-            last_clk_state = current_clk
-    GPIO.output(RREADY_PIN, GPIO.LOW)
-    GPIO.output(WVALID_PIN, GPIO.LOW)
-    print("Wrote:", data_bits)
+    def check_frame(self):
+        while len(self.rx_frame) >= 4:
+            length = self.rx_frame[3]
+            if length <= PI_LINK_MAX_PAYLOAD:
+                if len(self.rx_frame) < 4 + length + 2:
+                    return
+                crc = crc16(self.rx_frame[1:4 + length])
+                if crc == self.rx_frame[4 + length] | (self.rx_frame[5 + length] << 8):
+                    self.handle_frame(self.rx_frame[1], self.rx_frame[2], bytes(self.rx_frame[4:4 + length]))
+                    self.rx_frame = bytearray()
+                    return
+            # Not a frame (a corrupted length would otherwise swallow the frames after it)
+            self.drop_frame()
 
-def process_received_bits(bits):
-    global turn
-    if not bits:
-        return None
+    def handle_frame(self, kind, sequence, payload):
+        first = bool(kind & PI_FRAME_FIRST)
+        kind &= ~PI_FRAME_FIRST
+        if kind == PI_FRAME_ACK:
+            self.ack_sequence = sequence
+            return
+        if kind != PI_FRAME_DATA:
+            self.bad_frames += 1
+            return
+        # Already handled (our ack was lost): ack it again. A first frame starts a new session (the board was
+        # restarted) unless it's the first frame of this one coming again
+        if sequence == self.receive_sequence and (not first or self.receive_first):
+            self.write_frame(PI_FRAME_ACK, sequence)
+            return
+        messages = []
+        offset = 0
+        while offset + 2 <= len(payload):
+            length = payload[offset + 1]
+            if offset + 2 + length > len(payload):
+                self.bad_frames += 1
+                return
+            messages.append((payload[offset], payload[offset + 2:offset + 2 + length]))
+            offset += 2 + length
+        self.inbox.extend(messages)
+        self.receive_sequence = sequence
+        self.receive_first = first
+        self.write_frame(PI_FRAME_ACK, sequence)
 
-    is_move = bits[0] == 0
-    color = bits[1]
-    payload = bits[2:]
-    
-    if is_move: #actual move
-        if all(bit == 0 for bit in payload): #arduino telling pi to make the first move     
-            stockfish[turn].set_position()
-            best_move = stockfish[turn].get_best_move()
-            turn = 1
-            return move_to_bits(best_move)
-        
-        move_bits = int(''.join(map(str, payload)), 2)
-        print("Payload:", payload)
-        move_str = bits_to_move(move_bits, is_promotion=bits[1])
-        print("Move string:", move_str)
-        stockfish[0].make_moves_from_current_position([move_str])
-        stockfish[1].make_moves_from_current_position([move_str])
-        
-        if is_computer[1-turn]:
-            best_move = stockfish[1-turn].get_best_move()
-            return move_to_bits(best_move)
-        turn = 1 - turn
-    else: #setup
-        stockfish[color].set_position() #clearing stockfish board
-        is_human = all(bit == 1 for bit in payload[:14]) #is_human is true if 
-        difficulty = int(''.join(map(str, payload[:14])), 2) #takes 14 bit payload, converts into individual strings, then join concatenates, then int converts binary into int
+def process_message(link, message_type, body):
+    if message_type == PI_MSG_CONFIG:
+        color, is_human, level = body[0], body[1], body[2]
         is_computer[color] = not is_human
+        difficulty[color] = level
         if not is_human:
-            stockfish[color].update_engine_parameters({"Skill Level": difficulty})
-        turn = 0
-    return None
+            stockfish[color].update_engine_parameters({"Skill Level": level})
+        print("Config: color", color, "computer" if is_computer[color] else "human", "difficulty", level)
+    elif message_type == PI_MSG_MOVE:
+        # The FEN after it comes in the same frame, that's what the engines are set to
+        print("Move:", message_to_move(body))
+    elif message_type == PI_MSG_FEN:
+        position_id = body[0]
+        fen = body[1:].decode("ascii")
+        print("Position", position_id, fen)
+        stockfish[0].set_fen_position(fen)
+        stockfish[1].set_fen_position(fen)
+        color = 0 if fen.split(" ")[1] == "w" else 1
+        if is_computer[color]:
+            best_move = stockfish[color].get_best_move()
+            if best_move is None:
+                return  # game over, the board sees it too
+            print("Engine reply:", best_move)
+            if not link.send([(PI_MSG_ENGINE_REPLY, move_to_message(best_move, position_id))]):
+                print("Engine reply not acked")
+    else:
+        print("Unknown message", message_type)
 
 def main():
-    global stockfish, turn, first_write
-    global first_write
-    first_write = 1
-    # Initialize GPIO
-    GPIO.setmode(GPIO.BCM)
-    
-    # Input Pins
-    GPIO.setup(CLK_PIN, GPIO.IN)
-    GPIO.setup(RREADY_PIN, GPIO.OUT)
-    GPIO.setup(WDATA_PIN, GPIO.OUT)
-    GPIO.setup(OVERWRITE_PIN, GPIO.IN)
-    
-    # Output Pins (Initialized to LOW)
-    GPIO.setup(RVALID_PIN, GPIO.IN)
-    GPIO.setup(RDATA_PIN, GPIO.IN)
-    GPIO.setup(WREADY_PIN, GPIO.IN)
-    GPIO.setup(WVALID_PIN, GPIO.OUT)
-    GPIO.output(RREADY_PIN, GPIO.LOW)
-    GPIO.output(WDATA_PIN, GPIO.LOW)
-    GPIO.output(WVALID_PIN, GPIO.LOW)
-    
+    global stockfish
+
     # Initialize Stockfish
     stockfish = [Stockfish(
         path="/home/spark/Stockfish/src/stockfish",
@@ -236,25 +222,21 @@ def main():
         depth=18,
         parameters={"Threads": 2, "Minimum Thinking Time": 30}
     )]
-    
-    # Initial sequence
-    initial_sequence = [1,0,1,0,1,0,1,0,1,0,1,0,1,0]
-    write_to_arduino(initial_sequence)
     stockfish[0].set_position()
     stockfish[1].set_position()
-    
+
+    port = serial.Serial(PI_LINK_PORT, PI_LINK_BAUD, timeout=0.001)
+    link = PiLink(port)
+
+    # Stockfish is running: tell the board
+    while not link.send([(PI_MSG_HELLO, b"")]):
+        link.poll(HELLO_INTERVAL_S)
+    print("Board acked hello")
+
     # Main loop
     while True:
-        received_bits = read_from_arduino()
-        print("Received bits:", received_bits)
-        response_bits = process_received_bits(received_bits)
-        
-        if response_bits is not None:
-            print("writing to arduino", [int(b) for b in format(response_bits, '014b')])
-            write_to_arduino([int(b) for b in format(response_bits, '014b')])
+        for message_type, body in link.poll(1.0):
+            process_message(link, message_type, body)
 
 if __name__ == "__main__":
-    try:
-        main()
-    finally:
-        GPIO.cleanup()
\ No newline at end of file
+    main()